@@ -15,6 +15,7 @@
 
 // NOLINTNEXTLINE(misc-include-cleaner)
 #include "nghttp2_adapters.hpp"
+#include "sessions.hpp"
 
 #include <nghttp2/nghttp2.h>
 #include <unistd.h>
@@ -297,29 +298,46 @@ class HTTP2Connection :
             std::make_shared<bmcweb::AsyncResp>(std::move(it->second.res));
         if constexpr (!BMCWEB_INSECURE_DISABLE_AUTH)
         {
-            thisReq.session = crow::authentication::authenticate(
-                {}, asyncResp->res, thisReq.method(), thisReq.req, nullptr);
-            if (!crow::authentication::isOnAllowlist(thisReq.url().path(),
-                                                     thisReq.method()) &&
-                thisReq.session == nullptr)
+            // Basic auth may need PAM, which completes asynchronously
+            crow::authentication::authenticate(
+                {}, asyncResp->res, thisReq.method(), thisReq.req, nullptr,
+                [self(shared_from_this()), req(it->second.req),
+                 asyncResp](std::shared_ptr<persistent_data::UserSession>
+                                session) {
+                    req->session = std::move(session);
+                    self->afterAuthenticate(req, asyncResp);
+                });
+            return 0;
+        }
+        afterAuthenticate(it->second.req, asyncResp);
+        return 0;
+    }
+
+    void afterAuthenticate(const std::shared_ptr<Request>& req,
+                           const std::shared_ptr<bmcweb::AsyncResp>& asyncResp)
+    {
+        if constexpr (!BMCWEB_INSECURE_DISABLE_AUTH)
+        {
+            if (!crow::authentication::isOnAllowlist(req->url().path(),
+                                                     req->method()) &&
+                req->session == nullptr)
             {
                 BMCWEB_LOG_WARNING("Authentication failed");
                 forward_unauthorized::sendUnauthorized(
-                    thisReq.url().encoded_path(),
-                    thisReq.getHeaderValue("X-Requested-With"),
-                    thisReq.getHeaderValue("Accept"), asyncResp->res);
-                return 0;
+                    req->url().encoded_path(),
+                    req->getHeaderValue("X-Requested-With"),
+                    req->getHeaderValue("Accept"), asyncResp->res);
+                return;
             }
         }
         std::string_view expected =
-            thisReq.getHeaderValue(boost::beast::http::field::if_none_match);
+            req->getHeaderValue(boost::beast::http::field::if_none_match);
         BMCWEB_LOG_DEBUG("Setting expected hash {}", expected);
         if (!expected.empty())
         {
             asyncResp->res.setExpectedHash(expected);
         }
-        handler->handle(it->second.req, asyncResp);
-        return 0;
+        handler->handle(req, asyncResp);
     }
 
     int onDataChunkRecvCallback(uint8_t /*flags*/, int32_t streamId,
@@ -7,6 +7,10 @@
 #include "utility.hpp"
 
 #include <fcntl.h>
+#include <openssl/evp.h>
+#include <sys/mman.h>
+#include <sys/sendfile.h>
+#include <sys/stat.h>
 
 #include <boost/asio/buffer.hpp>
 #include <boost/beast/core/buffer_traits.hpp>
@@ -21,9 +25,11 @@
 
 #include <algorithm>
 #include <array>
+#include <cerrno>
 #include <cstddef>
 #include <cstdint>
 #include <limits>
+#include <memory>
 #include <optional>
 #include <string>
 #include <string_view>
@@ -54,6 +60,8 @@ class HttpBody::value_type
     DuplicatableFileHandle fileHandle;
     std::optional<size_t> fileSize;
     std::string strBody;
+    std::string sha256Digest;
+    std::function<void(std::string_view)> chunkHandler;
 
   public:
     value_type() = default;
@@ -66,6 +74,11 @@ class HttpBody::value_type
         return fileHandle.fileHandle;
     }
 
+    boost::beast::file_posix& file()
+    {
+        return fileHandle.fileHandle;
+    }
+
     std::string& str()
     {
         return strBody;
@@ -92,15 +105,83 @@ class HttpBody::value_type
         return fileSize;
     }
 
+    // True when the body is a regular file of known size sent as is, which
+    // can be handed to sendfile(2) instead of being read through a buffer
+    bool isSendableFile() const
+    {
+        if (!fileHandle.fileHandle.is_open() || !fileSize ||
+            encodingType != EncodingType::Raw)
+        {
+            return false;
+        }
+        struct stat st{};
+        if (fstat(fileHandle.fileHandle.native_handle(), &st) != 0)
+        {
+            return false;
+        }
+        return S_ISREG(st.st_mode);
+    }
+
     void clear()
     {
         strBody.clear();
         strBody.shrink_to_fit();
         fileHandle.fileHandle = boost::beast::file_posix();
         fileSize = std::nullopt;
+        sha256Digest.clear();
+        chunkHandler = nullptr;
         encodingType = EncodingType::Raw;
     }
 
+    // Has a request body written to an anonymous memory file as it arrives,
+    // instead of being collected in str().  Used for large uploads, so they
+    // are never held in memory twice.
+    void spoolToMemfd(boost::system::error_code& ec)
+    {
+        int fd = memfd_create("bmcweb-body", MFD_CLOEXEC);
+        if (fd < 0)
+        {
+            ec = boost::system::error_code(errno,
+                                           boost::system::system_category());
+            return;
+        }
+        fileHandle.fileHandle.native_handle(fd);
+        fileSize = 0;
+        ec = {};
+    }
+
+    void append(std::string_view data, boost::system::error_code& ec)
+    {
+        fileHandle.fileHandle.write(data.data(), data.size(), ec);
+        if (!ec)
+        {
+            fileSize = fileSize.value_or(0) + data.size();
+        }
+    }
+
+    // Passes a request body to a handler piece by piece as it arrives, instead
+    // of collecting it in str()
+    void handleChunks(std::function<void(std::string_view)> handler)
+    {
+        chunkHandler = std::move(handler);
+    }
+
+    const std::function<void(std::string_view)>& getChunkHandler() const
+    {
+        return chunkHandler;
+    }
+
+    // Hex SHA-256 of a spooled request body, once all of it has arrived
+    const std::string& sha256() const
+    {
+        return sha256Digest;
+    }
+
+    void setSha256(std::string digest)
+    {
+        sha256Digest = std::move(digest);
+    }
+
     void open(const char* path, boost::beast::file_mode mode,
               boost::system::error_code& ec)
     {
@@ -242,6 +323,9 @@ class HttpBody::writer
 class HttpBody::reader
 {
     value_type& value;
+    // Only used while spooling to a file
+    std::unique_ptr<EVP_MD_CTX, decltype(&EVP_MD_CTX_free)> hash{
+        nullptr, EVP_MD_CTX_free};
 
   public:
     template <bool IsRequest, class Fields>
@@ -252,16 +336,29 @@ class HttpBody::reader
     void init(const boost::optional<std::uint64_t>& contentLength,
               boost::beast::error_code& ec)
     {
-        if (contentLength)
+        if (value.getChunkHandler())
         {
-            if (!value.file().is_open())
+            // Nothing is stored
+        }
+        else if (value.file().is_open())
+        {
+            hash.reset(EVP_MD_CTX_new());
+            if (hash != nullptr &&
+                EVP_DigestInit_ex(hash.get(), EVP_sha256(), nullptr) != 1)
             {
-                value.str().reserve(static_cast<size_t>(*contentLength));
+                hash = nullptr;
             }
         }
+        else if (contentLength)
+        {
+            value.str().reserve(static_cast<size_t>(*contentLength));
+        }
         ec = {};
     }
 
+    // When spooling, each chunk is written out before the parser asks the
+    // socket for more, so a slow disk slows the client down rather than
+    // piling data up in memory.
     template <class ConstBufferSequence>
     std::size_t put(const ConstBufferSequence& buffers,
                     boost::system::error_code& ec)
@@ -269,19 +366,90 @@ class HttpBody::reader
         size_t extra = boost::beast::buffer_bytes(buffers);
         for (const auto b : boost::beast::buffers_range_ref(buffers))
         {
-            const char* ptr = static_cast<const char*>(b.data());
-            value.str() += std::string_view(ptr, b.size());
+            std::string_view chunk(static_cast<const char*>(b.data()),
+                                   b.size());
+            if (value.getChunkHandler())
+            {
+                value.getChunkHandler()(chunk);
+                continue;
+            }
+            if (!value.file().is_open())
+            {
+                value.str() += chunk;
+                continue;
+            }
+            value.append(chunk, ec);
+            if (ec)
+            {
+                BMCWEB_LOG_ERROR("Failed to spool body {}", ec.message());
+                return 0;
+            }
+            if (hash != nullptr &&
+                EVP_DigestUpdate(hash.get(), chunk.data(), chunk.size()) != 1)
+            {
+                hash = nullptr;
+            }
         }
         ec = {};
         return extra;
     }
 
-    static void finish(boost::system::error_code& ec)
+    void finish(boost::system::error_code& ec)
     {
+        if (hash != nullptr)
+        {
+            std::array<unsigned char, EVP_MAX_MD_SIZE> md{};
+            unsigned int mdLen = 0;
+            if (EVP_DigestFinal_ex(hash.get(), md.data(), &mdLen) == 1)
+            {
+                std::string digest;
+                digest.reserve(static_cast<size_t>(mdLen) * 2);
+                for (unsigned int i = 0; i < mdLen; i++)
+                {
+                    constexpr std::string_view hexDigits = "0123456789abcdef";
+                    digest += hexDigits[md[i] >> 4U];
+                    digest += hexDigits[md[i] & 0xFU];
+                }
+                value.setSha256(std::move(digest));
+            }
+            hash = nullptr;
+        }
         ec = {};
     }
 };
 
+// Copies the whole of a file to another file descriptor within the kernel.
+// The offset of the source file is left untouched.
+inline bool copyFileContents(const boost::beast::file_posix& in, int outFd)
+{
+    boost::system::error_code ec;
+    uint64_t remaining = in.size(ec);
+    if (ec)
+    {
+        BMCWEB_LOG_ERROR("Failed to get file size {}", ec.message());
+        return false;
+    }
+    off_t offset = 0;
+    while (remaining > 0)
+    {
+        ssize_t sent =
+            sendfile(outFd, in.native_handle(), &offset,
+                     static_cast<size_t>(std::min<uint64_t>(
+                         remaining, std::numeric_limits<int32_t>::max())));
+        if (sent < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        if (sent <= 0)
+        {
+            BMCWEB_LOG_ERROR("Failed to copy file, errno {}", errno);
+            return false;
+        }
+        remaining -= static_cast<uint64_t>(sent);
+    }
+    return true;
+}
+
 inline std::uint64_t HttpBody::size(const value_type& body)
 {
     std::optional<size_t> payloadSize = body.payloadSize();
@@ -14,13 +14,19 @@
 #include "http_response.hpp"
 #include "http_utility.hpp"
 #include "logging.hpp"
+#include "multipart_parser.hpp"
 #include "mutual_tls.hpp"
 #include "sessions.hpp"
 #include "str_utility.hpp"
 #include "utility.hpp"
 
+#include <sys/sendfile.h>
+#include <sys/types.h>
+#include <unistd.h>
+
 #include <boost/asio/error.hpp>
 #include <boost/asio/ip/tcp.hpp>
+#include <boost/asio/socket_base.hpp>
 #include <boost/asio/ssl/stream.hpp>
 #include <boost/asio/ssl/stream_base.hpp>
 #include <boost/asio/ssl/verify_context.hpp>
@@ -36,12 +42,16 @@
 #include <boost/beast/http/parser.hpp>
 #include <boost/beast/http/read.hpp>
 #include <boost/beast/http/rfc7230.hpp>
+#include <boost/beast/http/serializer.hpp>
 #include <boost/beast/http/status.hpp>
 #include <boost/beast/http/verb.hpp>
+#include <boost/beast/http/write.hpp>
 #include <boost/none.hpp>
 #include <boost/optional/optional.hpp>
 
+#include <algorithm>
 #include <bit>
+#include <cerrno>
 #include <chrono>
 #include <cstddef>
 #include <cstdint>
@@ -67,6 +77,49 @@ constexpr uint64_t loggedOutPostBodyLimit = 4096U;
 
 constexpr uint32_t httpHeaderLimit = 8192U;
 
+// Largest part other than the image that a streamed multipart update may have
+constexpr size_t streamedMultipartPartLimit = 64UL * 1024UL;
+
+// Largest piece of a file response handed to sendfile(2) per event loop turn
+constexpr size_t sendFileChunkSize = 1024UL * 1024UL;
+
+inline std::string_view uploadTargetPath(boost::beast::http::verb method,
+                                         std::string_view target)
+{
+    if (method != boost::beast::http::verb::post &&
+        method != boost::beast::http::verb::put)
+    {
+        return {};
+    }
+    std::string_view path = target.substr(0, target.find('?'));
+    if (path.ends_with('/'))
+    {
+        path.remove_suffix(1);
+    }
+    return path;
+}
+
+// Firmware images are written to a memory file as they arrive instead of being
+// collected in a string, because they can be a sizeable fraction of the BMC's
+// memory.  The handlers for these targets know to read Request::bodyFile().
+inline bool isStreamedUploadTarget(boost::beast::http::verb method,
+                                   std::string_view target)
+{
+    std::string_view path = uploadTargetPath(method, target);
+    return path == "/redfish/v1/UpdateService/update" ||
+           path == "/upload/image" || path.starts_with("/upload/image/");
+}
+
+// Multipart firmware updates are parsed as they arrive, with the UpdateFile
+// part going to a memory file.  The handler reads
+// Request::streamedMultipart.
+inline bool isStreamedMultipartTarget(boost::beast::http::verb method,
+                                      std::string_view target)
+{
+    return uploadTargetPath(method, target) ==
+           "/redfish/v1/UpdateService/update-multipart";
+}
+
 template <typename Adaptor, typename Handler>
 class Connection :
     public std::enable_shared_from_this<Connection<Adaptor, Handler>>
@@ -93,6 +146,8 @@ class Connection :
     {
         res.releaseCompleteRequestHandler();
         cancelDeadlineTimer();
+        // However the connection ended, it no longer uses its TLS session
+        releaseMtls();
 
         connectionCount--;
         BMCWEB_LOG_DEBUG("{} Connection closed, total {}", logPtr(this),
@@ -111,9 +166,12 @@ class Connection :
                          logPtr(this), preverified);
         if (preverified)
         {
-            mtlsSession = verifyMtlsUser(ip, ctx);
-            if (mtlsSession)
+            std::shared_ptr<persistent_data::UserSession> session =
+                verifyMtlsUser(ip, ctx);
+            if (session)
             {
+                releaseMtls();
+                mtlsSession = std::move(session);
                 BMCWEB_LOG_DEBUG("{} Generated TLS session: {}", logPtr(this),
                                  mtlsSession->uniqueId);
             }
@@ -278,6 +336,7 @@ class Connection :
         // Initially set no body limit. We don't yet know if the user is
         // authenticated.
         instance.body_limit(boost::none);
+        streamedMultipart = nullptr;
     }
 
     void upgradeToHttp2()
@@ -382,6 +441,7 @@ class Connection :
             return;
         }
         req->session = userSession;
+        req->streamedMultipart = std::move(streamedMultipart);
         accept = req->getHeaderValue("Accept");
         // Fetch the client IP address
         req->ipAddress = ip;
@@ -444,6 +504,20 @@ class Connection :
         handler->handle(req, asyncResp);
     }
 
+    // Gives up this connection's use of its TLS session.  Safe to call more
+    // than once; only the first call releases it.
+    void releaseMtls()
+    {
+        if (mtlsSession == nullptr)
+        {
+            return;
+        }
+        BMCWEB_LOG_DEBUG("{} Removing TLS session: {}", logPtr(this),
+                         mtlsSession->uniqueId);
+        releaseMtlsSession(mtlsSession);
+        mtlsSession = nullptr;
+    }
+
     void hardClose()
     {
         BMCWEB_LOG_DEBUG("{} Closing socket", logPtr(this));
@@ -467,14 +541,7 @@ class Connection :
 
         if (httpType == HttpType::HTTPS)
         {
-            if (mtlsSession != nullptr)
-            {
-                BMCWEB_LOG_DEBUG("{} Removing TLS session: {}", logPtr(this),
-                                 mtlsSession->uniqueId);
-                persistent_data::SessionStore::getInstance().removeSession(
-                    mtlsSession);
-            }
-
+            releaseMtls();
             adaptor.async_shutdown(std::bind_front(
                 &self_type::tlsShutdownComplete, this, shared_from_this()));
         }
@@ -630,14 +697,50 @@ class Connection :
             BMCWEB_LOG_ERROR("Parser was unexpectedly null");
             return;
         }
-        auto& parse = *parser;
         const auto& value = parser->get();
 
         if (authenticationEnabled)
         {
+            // Basic auth may need PAM, which completes asynchronously
             boost::beast::http::verb method = value.method();
-            userSession = authentication::authenticate(
-                ip, res, method, value.base(), mtlsSession);
+            authentication::authenticate(
+                ip, res, method, value.base(), mtlsSession,
+                std::bind_front(&self_type::afterAuthenticate, this,
+                                shared_from_this()));
+            return;
+        }
+
+        afterAuthenticate(shared_from_this(), nullptr);
+    }
+
+    void afterAuthenticate(
+        const std::shared_ptr<self_type>& /*self*/,
+        const std::shared_ptr<persistent_data::UserSession>& session)
+    {
+        userSession = session;
+        if (!parser)
+        {
+            BMCWEB_LOG_ERROR("Parser was unexpectedly null");
+            return;
+        }
+        auto& parse = *parser;
+        const auto& value = parser->get();
+
+        if (!parse.is_done() &&
+            isStreamedUploadTarget(value.method(), value.target()))
+        {
+            boost::system::error_code ec;
+            parse.get().body().spoolToMemfd(ec);
+            if (ec)
+            {
+                BMCWEB_LOG_WARNING("{} Failed to create upload file {}",
+                                   logPtr(this), ec.message());
+            }
+        }
+        else if (!parse.is_done() &&
+                 isStreamedMultipartTarget(value.method(), value.target()))
+        {
+            startStreamedMultipart();
         }
 
         std::string_view expect = value[boost::beast::http::field::expect];
@@ -664,6 +767,27 @@ class Connection :
         doRead();
     }
 
+    void startStreamedMultipart()
+    {
+        if (!parser)
+        {
+            return;
+        }
+        auto multipart = std::make_shared<MultipartParser>();
+        std::string_view contentType =
+            parser->get()[boost::beast::http::field::content_type];
+        if (multipart->begin(contentType) != ParserError::PARSER_SUCCESS)
+        {
+            // Leave the body buffered for the handler to reject
+            return;
+        }
+        multipart->spoolPart("UpdateFile");
+        multipart->limitPartSize(streamedMultipartPartLimit);
+        parser->get().body().handleChunks(
+            [multipart](std::string_view chunk) { multipart->feed(chunk); });
+        streamedMultipart = std::move(multipart);
+    }
+
     void doReadHeaders()
     {
         BMCWEB_LOG_DEBUG("{} doReadHeaders", logPtr(this));
@@ -828,6 +952,15 @@ class Connection :
         res.preparePayload();
 
         startDeadline();
+        if constexpr (std::is_same_v<Adaptor, boost::asio::ip::tcp::socket>)
+        {
+            if (httpType == HttpType::HTTP && !res.response.chunked() &&
+                res.response.body().isSendableFile())
+            {
+                doWriteFile();
+                return;
+            }
+        }
         if (httpType == HttpType::HTTP)
         {
             boost::beast::async_write(
@@ -846,6 +979,91 @@ class Connection :
         }
     }
 
+    // Plaintext responses backed by a regular file are sent with sendfile(2),
+    // so the file contents never pass through userspace.  Headers go out
+    // through the serializer first.  TLS connections can't do this, as the
+    // ssl stream encrypts through memory BIOs rather than the socket.
+    void doWriteFile()
+    {
+        int fd = res.response.body().file().native_handle();
+        off_t start = lseek(fd, 0, SEEK_CUR);
+        fileOffset = start < 0 ? 0 : start;
+        fileRemaining = bmcweb::HttpBody::size(res.response.body());
+        fileSent = 0;
+        fileSerializer.emplace(res.response);
+        boost::beast::http::async_write_header(
+            adaptor.next_layer(), *fileSerializer,
+            std::bind_front(&self_type::afterWriteFileHeader, this,
+                            shared_from_this()));
+    }
+
+    void afterWriteFileHeader(const std::shared_ptr<self_type>& self,
+                              const boost::system::error_code& ec,
+                              std::size_t bytesTransferred)
+    {
+        fileSent = bytesTransferred;
+        if (ec)
+        {
+            finishWriteFile(self, ec);
+            return;
+        }
+        boost::system::error_code nbEc;
+        adaptor.next_layer().non_blocking(true, nbEc);
+        sendFileChunk(self, nbEc);
+    }
+
+    // Sends at most one chunk each time the socket is writable, so that a large
+    // download doesn't keep other connections waiting
+    void sendFileChunk(const std::shared_ptr<self_type>& self,
+                       const boost::system::error_code& ec)
+    {
+        if (ec)
+        {
+            finishWriteFile(self, ec);
+            return;
+        }
+        if (fileRemaining == 0)
+        {
+            finishWriteFile(self, {});
+            return;
+        }
+        boost::asio::ip::tcp::socket& socket = adaptor.next_layer();
+        ssize_t sent = sendfile(socket.native_handle(),
+                                res.response.body().file().native_handle(),
+                                &fileOffset,
+                                std::min(fileRemaining, sendFileChunkSize));
+        if (sent < 0 && errno != EAGAIN && errno != EWOULDBLOCK &&
+            errno != EINTR)
+        {
+            finishWriteFile(self, boost::system::error_code(
+                                      errno, boost::system::system_category()));
+            return;
+        }
+        if (sent == 0)
+        {
+            // The file was truncated after the headers were sent
+            BMCWEB_LOG_ERROR("{} File ended {} bytes early", logPtr(this),
+                             fileRemaining);
+            finishWriteFile(self, boost::asio::error::eof);
+            return;
+        }
+        if (sent > 0)
+        {
+            fileRemaining -= static_cast<size_t>(sent);
+            fileSent += static_cast<size_t>(sent);
+        }
+        socket.async_wait(boost::asio::socket_base::wait_write,
+                          std::bind_front(&self_type::sendFileChunk, this,
+                                          self));
+    }
+
+    void finishWriteFile(const std::shared_ptr<self_type>& self,
+                         const boost::system::error_code& ec)
+    {
+        fileSerializer.reset();
+        afterDoWrite(self, ec, fileSent);
+    }
+
     void cancelDeadlineTimer()
     {
         timer.cancel();
@@ -921,9 +1139,17 @@ class Connection :
     // Making this a std::optional allows it to be efficiently destroyed and
     // re-created on Connection reset
     std::optional<boost::beast::http::request_parser<bmcweb::HttpBody>> parser;
+    std::shared_ptr<MultipartParser> streamedMultipart;
 
     boost::beast::flat_static_buffer<8192> buffer;
 
+    // State of a response body being sent with sendfile(2)
+    std::optional<boost::beast::http::response_serializer<bmcweb::HttpBody>>
+        fileSerializer;
+    off_t fileOffset = 0;
+    size_t fileRemaining = 0;
+    size_t fileSent = 0;
+
     std::shared_ptr<crow::Request> req;
     std::string accept;
     std::string http2settings;
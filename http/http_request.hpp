@@ -6,6 +6,7 @@
 #include "sessions.hpp"
 
 #include <boost/asio/ip/address.hpp>
+#include <boost/beast/core/file_posix.hpp>
 #include <boost/beast/http/field.hpp>
 #include <boost/beast/http/fields.hpp>
 #include <boost/beast/http/message.hpp>
@@ -21,6 +22,8 @@
 #include <system_error>
 #include <utility>
 
+class MultipartParser;
+
 namespace crow
 {
 
@@ -40,6 +43,11 @@ struct Request
     std::shared_ptr<persistent_data::UserSession> session;
 
     std::string userRole;
+
+    // Set when a multipart body was parsed while it arrived rather than
+    // collected in body().  finish() has not been called on it yet.
+    std::shared_ptr<MultipartParser> streamedMultipart;
+
     Request(Body&& reqIn, std::error_code& ec) : req(std::move(reqIn))
     {
         if (!setUrlInfo())
@@ -81,6 +89,7 @@ struct Request
         ipAddress = boost::asio::ip::address();
         session = nullptr;
         userRole = "";
+        streamedMultipart = nullptr;
     }
 
     boost::beast::http::verb method() const
@@ -143,6 +152,19 @@ struct Request
         return req.body().str();
     }
 
+    // Large uploads are written to this file as they arrive, in which case
+    // body() is empty
+    const boost::beast::file_posix& bodyFile() const
+    {
+        return req.body().file();
+    }
+
+    // Hex SHA-256 of a body that was written to bodyFile()
+    const std::string& bodySha256() const
+    {
+        return req.body().sha256();
+    }
+
     bool target(std::string_view target)
     {
         req.target(target);
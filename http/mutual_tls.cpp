@@ -5,9 +5,11 @@
 #include "bmcweb_config.h"
 
 #include "identity.hpp"
+#include "mutual_tls_cache.hpp"
 #include "mutual_tls_private.hpp"
 #include "sessions.hpp"
 
+#include <array>
 #include <bit>
 #include <cstddef>
 #include <cstdint>
@@ -17,6 +19,7 @@
 extern "C"
 {
 #include <openssl/asn1.h>
+#include <openssl/evp.h>
 #include <openssl/obj_mac.h>
 #include <openssl/objects.h>
 #include <openssl/types.h>
@@ -144,6 +147,17 @@ std::string getUPNFromCert(X509* peerCert, std::string_view hostname)
     return ret;
 }
 
+std::string getCertFingerprint(X509* cert)
+{
+    std::array<unsigned char, EVP_MAX_MD_SIZE> md{};
+    unsigned int mdLen = 0;
+    if (X509_digest(cert, EVP_sha256(), md.data(), &mdLen) != 1)
+    {
+        return "";
+    }
+    return {md.begin(), md.begin() + mdLen};
+}
+
 std::string getUsernameFromCert(X509* cert)
 {
     const persistent_data::AuthConfigMethods& authMethodsConfig =
@@ -232,6 +246,29 @@ std::shared_ptr<persistent_data::UserSession> verifyMtlsUser(
         return nullptr;
     }
 
+    // The username found in a certificate only depends on the certificate
+    // itself, except in UPN mode where it also depends on our hostname
+    std::string cacheKey = getCertFingerprint(peerCert);
+    if (!cacheKey.empty() &&
+        persistent_data::SessionStore::getInstance()
+                .getAuthMethodsConfig()
+                .mTLSCommonNameParsingMode ==
+            persistent_data::MTLSCommonNameParseMode::UserPrincipalName)
+    {
+        cacheKey += getHostName();
+    }
+    bmcweb::MutualTlsIdentityCache& cache =
+        bmcweb::MutualTlsIdentityCache::getInstance();
+    if (!cacheKey.empty())
+    {
+        std::shared_ptr<persistent_data::UserSession> session =
+            cache.acquire(cacheKey, clientIp);
+        if (session != nullptr)
+        {
+            return session;
+        }
+    }
+
     std::string sslUser = getUsernameFromCert(peerCert);
     if (sslUser.empty())
     {
@@ -240,7 +277,24 @@ std::shared_ptr<persistent_data::UserSession> verifyMtlsUser(
     }
 
     std::string unsupportedClientId;
-    return persistent_data::SessionStore::getInstance().generateUserSession(
-        sslUser, clientIp, unsupportedClientId,
-        persistent_data::SessionType::MutualTLS);
+    std::shared_ptr<persistent_data::UserSession> session =
+        persistent_data::SessionStore::getInstance().generateUserSession(
+            sslUser, clientIp, unsupportedClientId,
+            persistent_data::SessionType::MutualTLS);
+    if (session != nullptr && !cacheKey.empty())
+    {
+        cache.insert(cacheKey, session);
+    }
+    return session;
+}
+
+void releaseMtlsSession(
+    const std::shared_ptr<persistent_data::UserSession>& session)
+{
+    if (bmcweb::MutualTlsIdentityCache::getInstance().release(session))
+    {
+        BMCWEB_LOG_DEBUG("TLS session {} still in use", session->uniqueId);
+        return;
+    }
+    persistent_data::SessionStore::getInstance().removeSession(session);
 }
@@ -12,3 +12,8 @@
 std::shared_ptr<persistent_data::UserSession> verifyMtlsUser(
     const boost::asio::ip::address& clientIp,
     boost::asio::ssl::verify_context& ctx);
+
+// Called when a connection authenticated with mutual TLS closes.  Removes the
+// session unless other connections presenting the same certificate share it.
+void releaseMtlsSession(
+    const std::shared_ptr<persistent_data::UserSession>& session);
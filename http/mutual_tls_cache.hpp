@@ -0,0 +1,159 @@
+// SPDX-License-Identifier: Apache-2.0
+// SPDX-FileCopyrightText: Copyright OpenBMC Authors
+#pragma once
+
+#include "logging.hpp"
+#include "sessions.hpp"
+#include "utils/ip_utils.hpp"
+
+#include <boost/asio/ip/address.hpp>
+#include <boost/container/flat_map.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+
+namespace bmcweb
+{
+
+// Remembers which user a recently seen client certificate resolved to, so
+// clients that reconnect with the same certificate skip parsing it again.
+// Connections that overlap and present the same certificate from the same
+// address also share one session rather than each creating their own.
+// Entries are keyed on the certificate fingerprint, and everything is dropped
+// whenever the authentication methods configuration changes.
+class MutualTlsIdentityCache
+{
+  public:
+    explicit MutualTlsIdentityCache(size_t maxEntriesIn = 64) :
+        maxEntries(maxEntriesIn)
+    {}
+
+    // Returns the session for a new connection presenting the certificate
+    // with this fingerprint, or nullptr if the certificate isn't known.
+    std::shared_ptr<persistent_data::UserSession> acquire(
+        std::string_view fingerprint, const boost::asio::ip::address& clientIp)
+    {
+        persistent_data::SessionStore& store =
+            persistent_data::SessionStore::getInstance();
+        if (generation != store.getAuthMethodsGeneration())
+        {
+            entries.clear();
+            generation = store.getAuthMethodsGeneration();
+        }
+        auto it = entries.find(fingerprint);
+        if (it == entries.end())
+        {
+            return nullptr;
+        }
+        Entry& entry = it->second;
+        std::string ip = redfish::ip_util::toString(clientIp);
+
+        if (entry.session != nullptr &&
+            store.getSessionByUid(entry.session->uniqueId) != entry.session)
+        {
+            // Logged out or expired while still connected
+            entry.session = nullptr;
+            entry.connections = 0;
+        }
+        if (entry.session != nullptr && entry.session->clientIp == ip)
+        {
+            entry.connections++;
+            entry.session->lastUpdated = std::chrono::steady_clock::now();
+            BMCWEB_LOG_DEBUG("Reusing TLS session {} for {}",
+                             entry.session->uniqueId, entry.username);
+            return entry.session;
+        }
+
+        std::string unsupportedClientId;
+        std::shared_ptr<persistent_data::UserSession> session =
+            store.generateUserSession(entry.username, clientIp,
+                                      unsupportedClientId,
+                                      persistent_data::SessionType::MutualTLS);
+        if (session != nullptr && entry.session == nullptr)
+        {
+            entry.session = session;
+            entry.connections = 1;
+        }
+        return session;
+    }
+
+    // Remembers the session created for a certificate that acquire() didn't
+    // know about
+    void insert(std::string_view fingerprint,
+                const std::shared_ptr<persistent_data::UserSession>& session)
+    {
+        if (maxEntries == 0 || entries.contains(fingerprint))
+        {
+            return;
+        }
+        if (entries.size() >= maxEntries)
+        {
+            auto idle = std::ranges::find_if(entries, [](const auto& item) {
+                return item.second.connections == 0;
+            });
+            if (idle == entries.end())
+            {
+                return;
+            }
+            entries.erase(idle);
+        }
+        Entry& entry = entries[std::string(fingerprint)];
+        entry.username = session->username;
+        entry.session = session;
+        entry.connections = 1;
+    }
+
+    // Called when a connection using the session closes.  Returns true while
+    // other connections still use the session, in which case it must stay in
+    // the session store.
+    bool release(const std::shared_ptr<persistent_data::UserSession>& session)
+    {
+        for (auto& [fingerprint, entry] : entries)
+        {
+            if (entry.session != session)
+            {
+                continue;
+            }
+            if (entry.connections > 1)
+            {
+                entry.connections--;
+                return true;
+            }
+            entry.session = nullptr;
+            entry.connections = 0;
+            return false;
+        }
+        return false;
+    }
+
+    size_t size() const
+    {
+        return entries.size();
+    }
+
+    static MutualTlsIdentityCache& getInstance()
+    {
+        static MutualTlsIdentityCache cache;
+        return cache;
+    }
+
+  private:
+    struct Entry
+    {
+        std::string username;
+        std::shared_ptr<persistent_data::UserSession> session;
+        size_t connections = 0;
+    };
+
+    size_t maxEntries;
+    std::optional<size_t> generation;
+    boost::container::flat_map<std::string, Entry, std::less<>> entries;
+};
+
+} // namespace bmcweb
@@ -11,6 +11,8 @@ std::string getCommonNameFromCert(X509* cert);
 
 std::string getUPNFromCert(X509* peerCert, std::string_view hostname);
 
+std::string getCertFingerprint(X509* cert);
+
 std::string getUsernameFromCert(X509* cert);
 
 bool isUPNMatch(std::string_view upn, std::string_view hostname);
@@ -67,23 +67,15 @@ class BaseRule
         return methodsBitfield;
     }
 
-    bool checkPrivileges(const redfish::Privileges& userPrivileges)
+    bool checkPrivileges(const redfish::Privileges& userPrivileges) const
     {
-        // If there are no privileges assigned, assume no privileges
-        // required
-        if (privilegesSet.empty())
-        {
-            return true;
-        }
+        return compiledPrivileges.isAllowed(userPrivileges);
+    }
 
-        for (const redfish::Privileges& requiredPrivileges : privilegesSet)
-        {
-            if (userPrivileges.isSupersetOf(requiredPrivileges))
-            {
-                return true;
-            }
-        }
-        return false;
+    void setPrivileges(std::vector<redfish::Privileges> privileges)
+    {
+        privilegesSet = std::move(privileges);
+        compiledPrivileges = redfish::CompiledPrivileges(privilegesSet);
     }
 
     size_t methodsBitfield{1 << static_cast<size_t>(HttpVerb::Get)};
@@ -95,12 +87,18 @@ class BaseRule
     bool isMethodNotAllowed = false;
     bool isUpgrade = false;
 
-    std::vector<redfish::Privileges> privilegesSet;
-
     std::string rule;
 
     std::unique_ptr<BaseRule> ruleToUpgrade;
 
+  private:
+    // Only written through setPrivileges(), which keeps compiledPrivileges in
+    // step.  A default CompiledPrivileges requires nothing, so assigning
+    // privilegesSet alone would open the route to everyone.
+    std::vector<redfish::Privileges> privilegesSet;
+    // privilegesSet, in the form checked on each request
+    redfish::CompiledPrivileges compiledPrivileges;
+
     friend class Router;
     template <typename T>
     friend struct RuleParameterTraits;
@@ -13,6 +13,8 @@
 #include <cstddef>
 #include <initializer_list>
 #include <optional>
+#include <utility>
+#include <vector>
 
 namespace crow
 {
@@ -29,7 +31,7 @@ struct RuleParameterTraits
     {
         self_t* self = static_cast<self_t*>(this);
         WebSocketRule* p = new WebSocketRule(self->rule);
-        p->privilegesSet = self->privilegesSet;
+        p->setPrivileges(self->privilegesSet);
         self->ruleToUpgrade.reset(p);
         return *p;
     }
@@ -86,10 +88,12 @@ struct RuleParameterTraits
         const std::initializer_list<std::initializer_list<const char*>>& p)
     {
         self_t* self = static_cast<self_t*>(this);
+        std::vector<redfish::Privileges> privilegesSet = self->privilegesSet;
         for (const std::initializer_list<const char*>& privilege : p)
         {
-            self->privilegesSet.emplace_back(privilege);
+            privilegesSet.emplace_back(privilege);
         }
+        self->setPrivileges(std::move(privilegesSet));
         return *self;
     }
 
@@ -97,10 +101,12 @@ struct RuleParameterTraits
     self_t& privileges(const std::array<redfish::Privileges, N>& p)
     {
         self_t* self = static_cast<self_t*>(this);
+        std::vector<redfish::Privileges> privilegesSet = self->privilegesSet;
         for (const redfish::Privileges& privilege : p)
         {
-            self->privilegesSet.emplace_back(privilege);
+            privilegesSet.emplace_back(privilege);
         }
+        self->setPrivileges(std::move(privilegesSet));
         return *self;
     }
 };
@@ -1,18 +1,68 @@
 // SPDX-License-Identifier: Apache-2.0
 // SPDX-FileCopyrightText: Copyright OpenBMC Authors
 #pragma once
+#include "bmcweb_config.h"
+
 #include "boost_formatters.hpp"
+#include "slow_consumer.hpp"
 
 #include <boost/beast/http/write.hpp>
 
+#include <cstddef>
 #include <memory>
+#include <string>
 #include <string_view>
+#include <utility>
 
 namespace crow
 {
 
 namespace sse_socket
 {
+
+// A fully formatted SSE frame ("id: ...\ndata: ...\n\n").  Frames are
+// immutable once built, so a single event can be queued on any number of
+// connections, each of which only holds a reference and a write cursor.
+using SseEvent = std::shared_ptr<const std::string>;
+
+inline SseEvent formatSseEvent(std::string_view id, std::string_view msg)
+{
+    std::string rawData;
+    rawData.reserve(id.size() + msg.size() + 16);
+    if (!id.empty())
+    {
+        rawData += "id: ";
+        rawData.append(id);
+        rawData += "\n";
+    }
+
+    rawData += "data: ";
+    for (char character : msg)
+    {
+        rawData += character;
+        if (character == '\n')
+        {
+            rawData += "data: ";
+        }
+    }
+    rawData += "\n\n";
+    return std::make_shared<const std::string>(std::move(rawData));
+}
+
+using crow::ConnectionStats;
+using crow::SlowConsumerPolicy;
+
+// A client closed for falling behind can reconnect with Last-Event-Id
+struct BufferPolicy
+{
+    size_t maxQueuedBytes =
+        static_cast<size_t>(BMCWEB_SSE_BUFFER_LIMIT) * 1024U * 1024U;
+    SlowConsumerPolicy onOverflow =
+        BMCWEB_SSE_SLOW_CONSUMER_POLICY == "drop-oldest"
+            ? SlowConsumerPolicy::DropOldest
+            : SlowConsumerPolicy::Close;
+};
+
 struct Connection : public std::enable_shared_from_this<Connection>
 {
   public:
@@ -26,6 +76,8 @@ struct Connection : public std::enable_shared_from_this<Connection>
 
     virtual void close(std::string_view msg = "quit") = 0;
     virtual void sendSseEvent(std::string_view id, std::string_view msg) = 0;
+    virtual void sendSseEvent(const SseEvent& event) = 0;
+    virtual ConnectionStats getStats() const = 0;
 };
 } // namespace sse_socket
 } // namespace crow
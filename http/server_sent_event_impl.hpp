@@ -12,20 +12,22 @@
 #include <boost/asio/error.hpp>
 #include <boost/asio/steady_timer.hpp>
 #include <boost/beast/core/error.hpp>
-#include <boost/beast/core/multi_buffer.hpp>
 #include <boost/beast/http/field.hpp>
 #include <boost/beast/http/serializer.hpp>
 #include <boost/beast/http/write.hpp>
 
+#include <algorithm>
 #include <array>
 #include <chrono>
 #include <cstddef>
+#include <deque>
 #include <functional>
 #include <memory>
 #include <optional>
 #include <string>
 #include <string_view>
 #include <utility>
+#include <vector>
 
 namespace crow
 {
@@ -40,9 +42,10 @@ class ConnectionImpl : public Connection
     ConnectionImpl(
         Adaptor&& adaptorIn,
         std::function<void(Connection&, const Request&)> openHandlerIn,
-        std::function<void(Connection&)> closeHandlerIn) :
+        std::function<void(Connection&)> closeHandlerIn,
+        BufferPolicy policyIn = {}) :
         adaptor(std::move(adaptorIn)), timer(getIoContext()),
-        openHandler(std::move(openHandlerIn)),
+        policy(policyIn), openHandler(std::move(openHandlerIn)),
         closeHandler(std::move(closeHandlerIn))
 
     {
@@ -81,7 +84,12 @@ class ConnectionImpl : public Connection
         {
             closeHandler(*this);
         }
+        ConnectionStats current = getStats();
         BMCWEB_LOG_DEBUG("Closing SSE connection {} - {}", logPtr(this), msg);
+        BMCWEB_LOG_DEBUG("SSE connection {} sent {} events, dropped {}, "
+                         "{} left unsent",
+                         logPtr(this), current.sentMessages,
+                         current.droppedMessages, current.queuedMessages);
         boost::beast::get_lowest_layer(adaptor).close();
     }
 
@@ -134,18 +142,54 @@ class ConnectionImpl : public Connection
         {
             return;
         }
-        if (inputBuffer.size() == 0)
+        if (queue.empty())
         {
-            BMCWEB_LOG_DEBUG("inputBuffer is empty... Bailing out");
+            BMCWEB_LOG_DEBUG("Event queue is empty... Bailing out");
             return;
         }
         startTimeout();
         doingWrite = true;
 
+        // Gather as many queued frames as fit in one write.  The frames are
+        // owned by the queue, which is not trimmed below writingEvents until
+        // the write completes.
+        writeBuffers.clear();
+        size_t cursor = frontOffset;
+        for (const QueuedEvent& queued : queue)
+        {
+            if (writeBuffers.size() >= maxWriteBuffers)
+            {
+                break;
+            }
+            writeBuffers.emplace_back(
+                boost::asio::buffer(*queued.frame) + cursor);
+            cursor = 0;
+        }
+        writingEvents = writeBuffers.size();
+
         adaptor.async_write_some(
-            inputBuffer.data(),
-            std::bind_front(&ConnectionImpl::doWriteCallback, this,
-                            shared_from_this()));
+            writeBuffers, std::bind_front(&ConnectionImpl::doWriteCallback,
+                                          this, shared_from_this()));
+    }
+
+    void consume(size_t bytesTransferred)
+    {
+        stats.sentBytes += bytesTransferred;
+        while (bytesTransferred > 0 && !queue.empty())
+        {
+            size_t remaining = queue.front().frame->size() - frontOffset;
+            if (bytesTransferred < remaining)
+            {
+                frontOffset += bytesTransferred;
+                queuedBytes -= bytesTransferred;
+                return;
+            }
+            bytesTransferred -= remaining;
+            queuedBytes -= remaining;
+            frontOffset = 0;
+            queue.pop_front();
+            stats.sentMessages++;
+        }
     }
 
     void doWriteCallback(const std::shared_ptr<Connection>& /*self*/,
@@ -154,7 +198,8 @@ class ConnectionImpl : public Connection
     {
         timer.cancel();
         doingWrite = false;
-        inputBuffer.consume(bytesTransferred);
+        writingEvents = 0;
+        consume(bytesTransferred);
 
         if (ec == boost::asio::error::eof)
         {
@@ -183,42 +228,94 @@ class ConnectionImpl : public Connection
             return;
         }
 
-        dataFormat(id, msg);
-
-        doWrite();
+        sendSseEvent(formatSseEvent(id, msg));
     }
 
-    void dataFormat(std::string_view id, std::string_view msg)
+    void sendSseEvent(const SseEvent& event) override
     {
-        constexpr size_t bufferLimit = 10485760U; // 10MB
-        if (id.size() + msg.size() + inputBuffer.size() >= bufferLimit)
+        if (event == nullptr || event->empty())
         {
-            BMCWEB_LOG_ERROR("SSE Buffer overflow while waiting for client");
-            close("Buffer overflow");
+            BMCWEB_LOG_DEBUG("Empty data, bailing out.");
             return;
         }
-        std::string rawData;
-        if (!id.empty())
+        if (!enqueue(event))
         {
-            rawData += "id: ";
-            rawData.append(id);
-            rawData += "\n";
+            return;
         }
 
-        rawData += "data: ";
-        for (char character : msg)
+        doWrite();
+    }
+
+    ConnectionStats getStats() const override
+    {
+        ConnectionStats current = stats;
+        current.queuedMessages = queue.size();
+        current.queuedBytes = queuedBytes;
+        if (!queue.empty())
         {
-            rawData += character;
-            if (character == '\n')
+            current.lag =
+                std::chrono::steady_clock::now() - queue.front().queuedAt;
+        }
+        return current;
+    }
+
+    bool enqueue(const SseEvent& event)
+    {
+        if (event->size() + queuedBytes >= policy.maxQueuedBytes)
+        {
+            if (policy.onOverflow == SlowConsumerPolicy::Close)
+            {
+                BMCWEB_LOG_ERROR(
+                    "SSE Buffer overflow while waiting for client {}, lag {}ms",
+                    logPtr(this),
+                    std::chrono::duration_cast<std::chrono::milliseconds>(
+                        getStats().lag)
+                        .count());
+                close("Buffer overflow");
+                return false;
+            }
+            dropOldest(event->size());
+            if (event->size() + queuedBytes >= policy.maxQueuedBytes)
             {
-                rawData += "data: ";
+                BMCWEB_LOG_WARNING("SSE event of {} bytes exceeds budget",
+                                   event->size());
+                stats.droppedMessages++;
+                return false;
             }
         }
-        rawData += "\n\n";
+        queue.push_back(QueuedEvent{event, std::chrono::steady_clock::now()});
+        queuedBytes += event->size();
+        stats.peakQueuedBytes = std::max(stats.peakQueuedBytes, queuedBytes);
+        return true;
+    }
 
-        size_t copied = boost::asio::buffer_copy(
-            inputBuffer.prepare(rawData.size()), boost::asio::buffer(rawData));
-        inputBuffer.commit(copied);
+    // Makes room for an event of the given size by discarding the oldest
+    // events that are not part of the write currently in flight.
+    void dropOldest(size_t needed)
+    {
+        size_t firstDroppable = writingEvents;
+        if (!doingWrite && frontOffset != 0)
+        {
+            // Never drop a partially written frame, or the client would see
+            // a corrupt stream
+            firstDroppable = 1;
+        }
+        size_t dropped = 0;
+        while (queue.size() > firstDroppable &&
+               needed + queuedBytes >= policy.maxQueuedBytes)
+        {
+            auto it =
+                queue.begin() + static_cast<std::ptrdiff_t>(firstDroppable);
+            queuedBytes -= it->frame->size();
+            queue.erase(it);
+            dropped++;
+        }
+        if (dropped > 0)
+        {
+            stats.droppedMessages += dropped;
+            BMCWEB_LOG_WARNING("SSE client {} too slow, dropped {} events",
+                               logPtr(this), dropped);
+        }
     }
 
     void startTimeout()
@@ -259,7 +356,23 @@ class ConnectionImpl : public Connection
 
   private:
     std::array<char, 1> buffer{};
-    boost::beast::multi_buffer inputBuffer;
+
+    struct QueuedEvent
+    {
+        SseEvent frame;
+        std::chrono::steady_clock::time_point queuedAt;
+    };
+    // Events waiting to be written.  frontOffset is the write cursor into the
+    // first frame; the frames themselves may be shared with other clients.
+    std::deque<QueuedEvent> queue;
+    size_t frontOffset = 0;
+    size_t queuedBytes = 0;
+    // Number of frames at the front of the queue referenced by the write in
+    // flight
+    size_t writingEvents = 0;
+    static constexpr size_t maxWriteBuffers = 16;
+    std::vector<boost::asio::const_buffer> writeBuffers;
+    ConnectionStats stats;
 
     Adaptor adaptor;
 
@@ -268,6 +381,7 @@ class ConnectionImpl : public Connection
     std::optional<boost::beast::http::response_serializer<BodyType>> serializer;
     boost::asio::steady_timer timer;
     bool doingWrite = false;
+    BufferPolicy policy;
 
     std::function<void(Connection&, const Request&)> openHandler;
     std::function<void(Connection&)> closeHandler;
@@ -0,0 +1,39 @@
+// SPDX-License-Identifier: Apache-2.0
+// SPDX-FileCopyrightText: Copyright OpenBMC Authors
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+
+namespace crow
+{
+
+// Write side bookkeeping shared by the connections that push data to a
+// client (websocket and SSE), which queue what the client hasn't read yet
+
+// What to do when a client falls further behind than its write budget allows
+enum class SlowConsumerPolicy
+{
+    // Close the connection
+    Close,
+    // Discard the oldest messages that have not started sending yet
+    DropOldest,
+};
+
+// Per connection write counters, used to judge how far a client is lagging
+struct ConnectionStats
+{
+    size_t queuedMessages = 0;
+    size_t queuedBytes = 0;
+    size_t peakQueuedBytes = 0;
+    size_t sentMessages = 0;
+    size_t sentBytes = 0;
+    size_t droppedMessages = 0;
+    // Number of times the high-water mark was crossed, for connections that
+    // have one
+    size_t backpressureEvents = 0;
+    // Age of the oldest message that has not been fully written
+    std::chrono::steady_clock::duration lag{};
+};
+
+} // namespace crow
@@ -3,6 +3,10 @@
 #include <boost/asio/io_context.hpp>
 #include <boost/asio/ip/tcp.hpp>
 #include <boost/beast/_experimental/test/stream.hpp>
+#include <boost/beast/core/role.hpp>
+#include <boost/system/error_code.hpp>
+
+#include <utility>
 
 namespace crow
 {
@@ -27,4 +31,21 @@ struct TestStream : public boost::beast::test::stream
     }
 };
 
+// Websocket streams only know how to tear down the beast test stream itself,
+// so forward to it for the derived type
+inline void teardown(boost::beast::role_type role, TestStream& stream,
+                     boost::system::error_code& ec)
+{
+    boost::beast::test::stream& base = stream;
+    teardown(role, base, ec);
+}
+
+template <typename TeardownHandler>
+void async_teardown(boost::beast::role_type role, TestStream& stream,
+                    TeardownHandler&& handler)
+{
+    boost::beast::test::stream& base = stream;
+    async_teardown(role, base, std::forward<TeardownHandler>(handler));
+}
+
 } // namespace crow
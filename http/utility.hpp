@@ -107,6 +107,19 @@ constexpr std::array<char, 256> getDecodeTable(bool urlSafe)
     return decodeTable;
 }
 
+// Maps every 12 bit value to its two base64 characters, so that a 3 byte
+// group is encoded with two lookups
+constexpr std::array<char, 8192> getBase64PairTable()
+{
+    std::array<char, 8192> pairTable{};
+    for (size_t index = 0; index < 4096; index++)
+    {
+        pairTable[index * 2] = base64key[index >> 6];
+        pairTable[(index * 2) + 1] = base64key[index & 0x3F];
+    }
+    return pairTable;
+}
+
 class Base64Encoder
 {
     char overflow1 = '\0';
@@ -134,6 +147,33 @@ class Base64Encoder
         output += base64key[keyIndex];
     }
 
+    // Encodes a run of whole 3 character blocks, writing directly into the
+    // output rather than appending a character at a time
+    static void encodeTriples(std::string_view data, std::string& output)
+    {
+        static constexpr std::array<char, 8192> pairTable =
+            getBase64PairTable();
+
+        size_t outIndex = output.size();
+        output.resize(outIndex + (data.size() / 3 * 4));
+        for (size_t inIndex = 0; inIndex + 3 <= data.size(); inIndex += 3)
+        {
+            uint32_t group =
+                (static_cast<uint32_t>(static_cast<uint8_t>(data[inIndex]))
+                 << 16) |
+                (static_cast<uint32_t>(static_cast<uint8_t>(data[inIndex + 1]))
+                 << 8) |
+                static_cast<uint32_t>(static_cast<uint8_t>(data[inIndex + 2]));
+            size_t high = (group >> 12) * 2;
+            size_t low = (group & 0xFFF) * 2;
+            output[outIndex] = pairTable[high];
+            output[outIndex + 1] = pairTable[high + 1];
+            output[outIndex + 2] = pairTable[low];
+            output[outIndex + 3] = pairTable[low + 1];
+            outIndex += 4;
+        }
+    }
+
   public:
     // Accepts a partial string to encode, and writes the encoded characters to
     // the output stream. requires subsequently calling finalize to complete
@@ -160,11 +200,9 @@ class Base64Encoder
             }
         }
 
-        while (data.size() >= 3)
-        {
-            encodeTriple(data[0], data[1], data[2], output);
-            data.remove_prefix(3);
-        }
+        size_t whole = data.size() - (data.size() % 3);
+        encodeTriples(data.substr(0, whole), output);
+        data.remove_prefix(whole);
 
         if (!data.empty() && overflowCount == 0)
         {
@@ -237,7 +275,7 @@ inline bool base64Decode(std::string_view input, std::string& output)
 
     // allocate space for output string
     output.clear();
-    output.reserve(((inputLength + 2) / 3) * 4);
+    output.reserve((inputLength / 4 * 3) + 3);
 
     static constexpr auto decodingData = getDecodeTable(urlsafe);
 
@@ -249,11 +287,39 @@ inline bool base64Decode(std::string_view input, std::string& output)
         return decodingData[code];
     };
 
+    // Whole 4 character blocks that are followed by more input can't contain
+    // padding, so decode them directly into the output.  Anything unusual,
+    // including a misplaced '=', is left to the checks below.
+    size_t i = 0;
+    size_t outIndex = 0;
+    output.resize(inputLength / 4 * 3);
+    for (; i + 4 < inputLength; i += 4)
+    {
+        char code0 = getCodeValue(input[i]);
+        char code1 = getCodeValue(input[i + 1]);
+        char code2 = getCodeValue(input[i + 2]);
+        char code3 = getCodeValue(input[i + 3]);
+        // Every valid code fits in 6 bits, and nop has the top bit set
+        if (((code0 | code1 | code2 | code3) & 0x80) != 0)
+        {
+            break;
+        }
+        uint32_t group = (static_cast<uint32_t>(code0) << 18) |
+                         (static_cast<uint32_t>(code1) << 12) |
+                         (static_cast<uint32_t>(code2) << 6) |
+                         static_cast<uint32_t>(code3);
+        output[outIndex] = static_cast<char>(group >> 16);
+        output[outIndex + 1] = static_cast<char>((group >> 8) & 0xFF);
+        output[outIndex + 2] = static_cast<char>(group & 0xFF);
+        outIndex += 3;
+    }
+    output.resize(outIndex);
+
     // for each 4-bytes sequence from the input, extract 4 6-bits sequences by
     // dropping first two bits
     // and regenerate into 3 8-bits sequences
 
-    for (size_t i = 0; i < inputLength; i++)
+    for (; i < inputLength; i++)
     {
         char base64code0 = 0;
         char base64code1 = 0;
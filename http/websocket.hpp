@@ -1,8 +1,13 @@
 // SPDX-License-Identifier: Apache-2.0
 // SPDX-FileCopyrightText: Copyright OpenBMC Authors
 #pragma once
+#include "bmcweb_config.h"
+
+#include "slow_consumer.hpp"
+
 #include <boost/url/url_view.hpp>
 
+#include <cstddef>
 #include <functional>
 #include <memory>
 #include <string_view>
@@ -18,6 +23,22 @@ enum class MessageType
     Text,
 };
 
+using crow::ConnectionStats;
+using crow::SlowConsumerPolicy;
+
+struct WriteBufferPolicy
+{
+    size_t maxQueuedBytes =
+        static_cast<size_t>(BMCWEB_WEBSOCKET_BUFFER_LIMIT) * 1024U * 1024U;
+    // Past this the backpressure handler is told to hold off, and told to
+    // resume once the queue drains to half of it
+    size_t highWaterBytes = maxQueuedBytes / 2;
+    SlowConsumerPolicy onOverflow =
+        BMCWEB_WEBSOCKET_SLOW_CONSUMER_POLICY == "drop-oldest"
+            ? SlowConsumerPolicy::DropOldest
+            : SlowConsumerPolicy::Close;
+};
+
 struct Connection : std::enable_shared_from_this<Connection>
 {
   public:
@@ -35,6 +56,14 @@ struct Connection : std::enable_shared_from_this<Connection>
     virtual void close(std::string_view msg = "quit") = 0;
     virtual void deferRead() = 0;
     virtual void resumeRead() = 0;
+    // The write side counterpart of deferRead.  The handler is called with
+    // true once sendBinary/sendText have queued more than the high-water
+    // mark, and with false once the client has caught up, so producers that
+    // can pause their source do so instead of queueing more.
+    virtual void setBackpressureHandler(
+        std::function<void(bool congested)>&& handler) = 0;
+    virtual void setWriteBufferPolicy(const WriteBufferPolicy& policy) = 0;
+    virtual ConnectionStats getStats() const = 0;
     virtual ~Connection() = default;
     virtual boost::urls::url_view url() = 0;
 };
@@ -15,12 +15,12 @@
 #include <boost/asio/error.hpp>
 #include <boost/asio/ssl/error.hpp>
 #include <boost/beast/core/error.hpp>
-#include <boost/beast/core/multi_buffer.hpp>
 #include <boost/beast/core/role.hpp>
 #include <boost/beast/http/field.hpp>
 #include <boost/beast/http/message.hpp>
 #include <boost/beast/http/status.hpp>
 #include <boost/beast/websocket/error.hpp>
+#include <boost/beast/websocket/option.hpp>
 #include <boost/beast/websocket/rfc6455.hpp>
 #include <boost/beast/websocket/stream.hpp>
 #include <boost/beast/websocket/stream_base.hpp>
@@ -29,7 +29,10 @@
 // NOLINTNEXTLINE(misc-include-cleaner)
 #include <boost/beast/websocket/ssl.hpp>
 
+#include <algorithm>
+#include <chrono>
 #include <cstddef>
+#include <deque>
 #include <functional>
 #include <memory>
 #include <string>
@@ -69,9 +72,29 @@ class ConnectionImpl : public Connection
         /* Turn on the timeouts on websocket stream to server role */
         ws.set_option(boost::beast::websocket::stream_base::timeout::suggested(
             boost::beast::role_type::server));
+        if constexpr (BMCWEB_WEBSOCKET_DEFLATE)
+        {
+            boost::beast::websocket::permessage_deflate deflate;
+            deflate.server_enable = true;
+            ws.set_option(deflate);
+        }
         BMCWEB_LOG_DEBUG("Creating new connection {}", logPtr(this));
     }
 
+    ConnectionImpl(const ConnectionImpl&) = delete;
+    ConnectionImpl(ConnectionImpl&&) = delete;
+    ConnectionImpl& operator=(const ConnectionImpl&) = delete;
+    ConnectionImpl& operator=(ConnectionImpl&&) = delete;
+
+    ~ConnectionImpl() override
+    {
+        BMCWEB_LOG_DEBUG("Websocket {} sent {} messages ({} bytes), dropped "
+                         "{}, peak queue {} bytes, {} left unsent",
+                         logPtr(this), stats.sentMessages, stats.sentBytes,
+                         stats.droppedMessages, stats.peakQueuedBytes,
+                         queue.size());
+    }
+
     void start(const crow::Request& req)
     {
         BMCWEB_LOG_DEBUG("starting connection {}", logPtr(this));
@@ -127,9 +150,10 @@ class ConnectionImpl : public Connection
 
     void sendBinary(std::string_view msg) override
     {
-        ws.binary(true);
-        outBuffer.commit(boost::asio::buffer_copy(outBuffer.prepare(msg.size()),
-                                                  boost::asio::buffer(msg)));
+        if (!enqueue(MessageType::Binary, msg))
+        {
+            return;
+        }
         doWrite();
     }
 
@@ -146,14 +170,21 @@ class ConnectionImpl : public Connection
         ws.binary(type == MessageType::Binary);
 
         ws.async_write(boost::asio::buffer(msg),
-                       [weak(weak_from_this()), onDone{std::move(onDone)}](
-                           const boost::beast::error_code& ec, size_t) {
+                       [this, weak(weak_from_this()),
+                        onDone{std::move(onDone)}](
+                           const boost::beast::error_code& ec,
+                           size_t bytesSent) {
                            std::shared_ptr<Connection> self = weak.lock();
                            if (!self)
                            {
                                BMCWEB_LOG_ERROR("Connection went away");
                                return;
                            }
+                           if (!ec)
+                           {
+                               stats.sentMessages++;
+                               stats.sentBytes += bytesSent;
+                           }
 
                            // Call the done handler regardless of whether we
                            // errored, but before we close things out
@@ -170,12 +201,37 @@ class ConnectionImpl : public Connection
 
     void sendText(std::string_view msg) override
     {
-        ws.text(true);
-        outBuffer.commit(boost::asio::buffer_copy(outBuffer.prepare(msg.size()),
-                                                  boost::asio::buffer(msg)));
+        if (!enqueue(MessageType::Text, msg))
+        {
+            return;
+        }
         doWrite();
     }
 
+    void setBackpressureHandler(
+        std::function<void(bool congested)>&& handler) override
+    {
+        backpressureHandler = std::move(handler);
+    }
+
+    void setWriteBufferPolicy(const WriteBufferPolicy& policyIn) override
+    {
+        policy = policyIn;
+    }
+
+    ConnectionStats getStats() const override
+    {
+        ConnectionStats current = stats;
+        current.queuedMessages = queue.size();
+        current.queuedBytes = queuedBytes;
+        if (!queue.empty())
+        {
+            current.lag =
+                std::chrono::steady_clock::now() - queue.front().queuedAt;
+        }
+        return current;
+    }
+
     void close(std::string_view msg) override
     {
         ws.async_close(
@@ -273,34 +329,136 @@ class ConnectionImpl : public Connection
             return;
         }
 
-        if (outBuffer.size() == 0)
+        if (queue.empty())
         {
             // Done for now
             return;
         }
         doingWrite = true;
-        ws.async_write(outBuffer.data(), [this, self(shared_from_this())](
-                                             const boost::beast::error_code& ec,
-                                             size_t bytesSent) {
-            doingWrite = false;
-            outBuffer.consume(bytesSent);
-            if (ec == boost::beast::websocket::error::closed)
+        // Each queued message goes out as its own websocket message.  The
+        // front of the queue is not dropped while the write is in flight.
+        const QueuedMessage& front = queue.front();
+        ws.binary(front.type == MessageType::Binary);
+        ws.async_write(boost::asio::buffer(front.data),
+                       [this, self(shared_from_this())](
+                           const boost::beast::error_code& ec,
+                           size_t bytesSent) {
+                           doingWrite = false;
+                           queuedBytes -= queue.front().data.size();
+                           queue.pop_front();
+                           if (!ec)
+                           {
+                               stats.sentMessages++;
+                               stats.sentBytes += bytesSent;
+                           }
+                           updateBackpressure();
+                           if (ec == boost::beast::websocket::error::closed)
+                           {
+                               // Do nothing here.  doRead handler will call
+                               // the closeHandler.
+                               close("Write error");
+                               return;
+                           }
+                           if (ec)
+                           {
+                               BMCWEB_LOG_ERROR("Error in ws.async_write {}",
+                                                ec);
+                               return;
+                           }
+                           doWrite();
+                       });
+    }
+
+  private:
+    bool enqueue(MessageType type, std::string_view msg)
+    {
+        if (overflowed)
+        {
+            // Already closing because the client fell too far behind
+            return false;
+        }
+        if (msg.size() + queuedBytes > policy.maxQueuedBytes)
+        {
+            if (policy.onOverflow == SlowConsumerPolicy::Close)
             {
-                // Do nothing here.  doRead handler will call the
-                // closeHandler.
-                close("Write error");
-                return;
+                BMCWEB_LOG_ERROR(
+                    "Websocket {} write buffer overflow, {} bytes queued",
+                    logPtr(this), queuedBytes);
+                overflowed = true;
+                // Keep only the message being written
+                while (queue.size() > (doingWrite ? 1U : 0U))
+                {
+                    queuedBytes -= queue.back().data.size();
+                    queue.pop_back();
+                    stats.droppedMessages++;
+                }
+                stats.droppedMessages++;
+                close("Write buffer overflow");
+                return false;
             }
-            if (ec)
+            dropOldest(msg.size());
+            if (msg.size() + queuedBytes > policy.maxQueuedBytes)
             {
-                BMCWEB_LOG_ERROR("Error in ws.async_write {}", ec);
-                return;
+                BMCWEB_LOG_WARNING("Websocket message of {} bytes exceeds "
+                                   "write budget",
+                                   msg.size());
+                stats.droppedMessages++;
+                return false;
             }
-            doWrite();
-        });
+        }
+        queue.emplace_back(QueuedMessage{std::string(msg), type,
+                                         std::chrono::steady_clock::now()});
+        queuedBytes += msg.size();
+        stats.peakQueuedBytes = std::max(stats.peakQueuedBytes, queuedBytes);
+        updateBackpressure();
+        return true;
+    }
+
+    // Makes room for a message of the given size by discarding the oldest
+    // messages that are not being written
+    void dropOldest(size_t needed)
+    {
+        size_t firstDroppable = doingWrite ? 1 : 0;
+        size_t dropped = 0;
+        while (queue.size() > firstDroppable &&
+               needed + queuedBytes > policy.maxQueuedBytes)
+        {
+            auto it =
+                queue.begin() + static_cast<std::ptrdiff_t>(firstDroppable);
+            queuedBytes -= it->data.size();
+            queue.erase(it);
+            dropped++;
+        }
+        if (dropped > 0)
+        {
+            stats.droppedMessages += dropped;
+            BMCWEB_LOG_WARNING("Websocket client {} too slow, dropped {} "
+                               "messages",
+                               logPtr(this), dropped);
+        }
+    }
+
+    void updateBackpressure()
+    {
+        bool nowCongested = congested ? queuedBytes > policy.highWaterBytes / 2
+                                      : queuedBytes > policy.highWaterBytes;
+        if (nowCongested == congested)
+        {
+            return;
+        }
+        congested = nowCongested;
+        if (congested)
+        {
+            stats.backpressureEvents++;
+            BMCWEB_LOG_DEBUG("Websocket {} congested, {} bytes queued",
+                             logPtr(this), queuedBytes);
+        }
+        if (backpressureHandler)
+        {
+            backpressureHandler(congested);
+        }
     }
 
-  private:
     void handleMessage(size_t bytesRead)
     {
         if (messageExHandler)
@@ -342,8 +500,22 @@ class ConnectionImpl : public Connection
                                        std::string::allocator_type>
         inBuffer;
 
-    boost::beast::multi_buffer outBuffer;
+    struct QueuedMessage
+    {
+        std::string data;
+        MessageType type;
+        std::chrono::steady_clock::time_point queuedAt;
+    };
+    // Messages waiting to be written.  The front message is the one being
+    // written while doingWrite is set.
+    std::deque<QueuedMessage> queue;
+    size_t queuedBytes = 0;
     bool doingWrite = false;
+    bool congested = false;
+    bool overflowed = false;
+    WriteBufferPolicy policy;
+    ConnectionStats stats;
+    std::function<void(bool)> backpressureHandler;
 
     std::function<void(Connection&)> openHandler;
     std::function<void(Connection&, const std::string&, bool)> messageHandler;
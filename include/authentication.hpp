@@ -4,15 +4,17 @@
 
 #include "bmcweb_config.h"
 
+#include "basic_auth_cache.hpp"
 #include "http_response.hpp"
 #include "logging.hpp"
 #include "ossl_random.hpp"
-#include "pam_authenticate.hpp"
+#include "pam_worker_pool.hpp"
 #include "sessions.hpp"
 #include "utility.hpp"
 #include "utils/ip_utils.hpp"
 #include "webroutes.hpp"
 
+#include <openssl/crypto.h>
 #include <security/_pam_types.h>
 
 #include <boost/asio/ip/address.hpp>
@@ -23,6 +25,7 @@
 
 #include <cstddef>
 #include <cstring>
+#include <functional>
 #include <memory>
 #include <optional>
 #include <string>
@@ -35,14 +38,54 @@ namespace crow
 namespace authentication
 {
 
-inline std::shared_ptr<persistent_data::UserSession> performBasicAuth(
-    const boost::asio::ip::address& clientIp, std::string_view authHeader)
+using AuthCallback =
+    std::function<void(std::shared_ptr<persistent_data::UserSession>)>;
+
+inline std::shared_ptr<persistent_data::UserSession> getBasicAuthSession(
+    const boost::asio::ip::address& clientIp, const std::string& user,
+    int pamrc)
+{
+    bool isConfigureSelfOnly = pamrc == PAM_NEW_AUTHTOK_REQD;
+    if ((pamrc != PAM_SUCCESS) && !isConfigureSelfOnly)
+    {
+        return nullptr;
+    }
+
+    // Attempt to locate an existing Basic Auth session from the same ip address
+    // and user
+    for (auto& session :
+         persistent_data::SessionStore::getInstance().getSessions())
+    {
+        if (session->sessionType != persistent_data::SessionType::Basic)
+        {
+            continue;
+        }
+        if (session->clientIp != redfish::ip_util::toString(clientIp))
+        {
+            continue;
+        }
+        if (session->username != user)
+        {
+            continue;
+        }
+        return session;
+    }
+
+    return persistent_data::SessionStore::getInstance().generateUserSession(
+        user, clientIp, std::nullopt, persistent_data::SessionType::Basic,
+        isConfigureSelfOnly);
+}
+
+inline void performBasicAuth(const boost::asio::ip::address& clientIp,
+                             std::string_view authHeader,
+                             AuthCallback&& callback)
 {
     BMCWEB_LOG_DEBUG("[AuthMiddleware] Basic authentication");
 
     if (!authHeader.starts_with("Basic "))
     {
-        return nullptr;
+        callback(nullptr);
+        return;
     }
 
     std::string_view param = authHeader.substr(strlen("Basic "));
@@ -50,56 +93,50 @@ inline std::shared_ptr<persistent_data::UserSession> performBasicAuth(
 
     if (!crow::utility::base64Decode(param, authData))
     {
-        return nullptr;
+        callback(nullptr);
+        return;
     }
     std::size_t separator = authData.find(':');
     if (separator == std::string::npos)
     {
-        return nullptr;
+        callback(nullptr);
+        return;
     }
 
     std::string user = authData.substr(0, separator);
     separator += 1;
     if (separator > authData.size())
     {
-        return nullptr;
+        callback(nullptr);
+        return;
     }
-    std::string pass = authData.substr(separator);
+    std::string_view pass = std::string_view(authData).substr(separator);
 
     BMCWEB_LOG_DEBUG("[AuthMiddleware] Authenticating user: {}", user);
     BMCWEB_LOG_DEBUG("[AuthMiddleware] User IPAddress: {}",
                      clientIp.to_string());
 
-    int pamrc = pamAuthenticateUser(user, pass, std::nullopt);
-    bool isConfigureSelfOnly = pamrc == PAM_NEW_AUTHTOK_REQD;
-    if ((pamrc != PAM_SUCCESS) && !isConfigureSelfOnly)
+    bmcweb::BasicAuthCache& cache = bmcweb::BasicAuthCache::getInstance();
+    std::optional<int> cached = cache.lookup(user, pass);
+    if (cached)
     {
-        return nullptr;
-    }
-
-    // Attempt to locate an existing Basic Auth session from the same ip address
-    // and user
-    for (auto& session :
-         persistent_data::SessionStore::getInstance().getSessions())
-    {
-        if (session->sessionType != persistent_data::SessionType::Basic)
-        {
-            continue;
-        }
-        if (session->clientIp != redfish::ip_util::toString(clientIp))
-        {
-            continue;
-        }
-        if (session->username != user)
-        {
-            continue;
-        }
-        return session;
+        BMCWEB_LOG_DEBUG("[AuthMiddleware] Using cached credentials for {}",
+                         user);
+        callback(getBasicAuthSession(clientIp, user, *cached));
+        return;
     }
 
-    return persistent_data::SessionStore::getInstance().generateUserSession(
-        user, clientIp, std::nullopt, persistent_data::SessionType::Basic,
-        isConfigureSelfOnly);
+    bmcweb::pamAuthenticateUserAsync(
+        user, pass, std::nullopt,
+        [clientIp, user,
+         pass = cache.enabled() ? std::string(pass) : std::string(),
+         generation = cache.generation(),
+         callback = std::move(callback)](int pamrc) mutable {
+            bmcweb::BasicAuthCache::getInstance().store(user, pass, pamrc,
+                                                        generation);
+            OPENSSL_cleanse(pass.data(), pass.size());
+            callback(getBasicAuthSession(clientIp, user, pamrc));
+        });
 }
 
 inline std::shared_ptr<persistent_data::UserSession> performTokenAuth(
@@ -252,13 +289,17 @@ inline bool isOnAllowlist(std::string_view url, boost::beast::http::verb method)
     return false;
 }
 
-inline std::shared_ptr<persistent_data::UserSession> authenticate(
+// Resolves the session for a request.  Session, cookie and TLS based methods
+// complete immediately; Basic auth has to consult PAM, so the callback may run
+// later from the event loop.
+inline void authenticate(
     const boost::asio::ip::address& ipAddress [[maybe_unused]],
     Response& res [[maybe_unused]],
     boost::beast::http::verb method [[maybe_unused]],
     const boost::beast::http::header<true>& reqHeader,
     [[maybe_unused]] const std::shared_ptr<persistent_data::UserSession>&
-        session)
+        session,
+    AuthCallback&& callback)
 {
     const persistent_data::AuthConfigMethods& authMethodsConfig =
         persistent_data::SessionStore::getInstance().getAuthMethodsConfig();
@@ -298,15 +339,11 @@ inline std::shared_ptr<persistent_data::UserSession> authenticate(
     {
         if (sessionOut == nullptr && authMethodsConfig.basic)
         {
-            sessionOut = performBasicAuth(ipAddress, authHeader);
+            performBasicAuth(ipAddress, authHeader, std::move(callback));
+            return;
         }
     }
-    if (sessionOut != nullptr)
-    {
-        return sessionOut;
-    }
-
-    return nullptr;
+    callback(std::move(sessionOut));
 }
 
 } // namespace authentication
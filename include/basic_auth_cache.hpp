@@ -0,0 +1,198 @@
+// SPDX-License-Identifier: Apache-2.0
+// SPDX-FileCopyrightText: Copyright OpenBMC Authors
+#pragma once
+
+#include "bmcweb_config.h"
+
+#include "logging.hpp"
+#include "ossl_random.hpp"
+
+#include <openssl/crypto.h>
+#include <openssl/evp.h>
+
+#include <security/_pam_types.h>
+
+#include <boost/container/flat_map.hpp>
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+
+namespace bmcweb
+{
+
+// Remembers Basic auth credentials that PAM recently accepted, so clients that
+// send Basic auth on every request don't pay for a PAM conversation each time.
+// Only a salted SHA-256 of the password is stored, the salt never leaves the
+// process, and entries expire after a short TTL.  Failed attempts are never
+// cached so that lockout policies still see them.  The times are parameters so
+// that tests don't need to sleep through the TTL.
+class BasicAuthCache
+{
+  public:
+    explicit BasicAuthCache(std::chrono::seconds ttlIn,
+                            size_t maxEntriesIn = 64) :
+        ttl(ttlIn), maxEntries(maxEntriesIn), salt(getRandomIdOfLength(32))
+    {}
+
+    bool enabled() const
+    {
+        return ttl.count() > 0 && maxEntries > 0;
+    }
+
+    // Returns the PAM result that was cached for these credentials, if any
+    std::optional<int> lookup(std::string_view username,
+                              std::string_view password,
+                              std::chrono::steady_clock::time_point now =
+                                  std::chrono::steady_clock::now())
+    {
+        if (!enabled())
+        {
+            return std::nullopt;
+        }
+        auto it = entries.find(username);
+        if (it == entries.end())
+        {
+            return std::nullopt;
+        }
+        if (now >= it->second.expires)
+        {
+            entries.erase(it);
+            return std::nullopt;
+        }
+        std::string presented = digest(username, password);
+        if (presented.empty() ||
+            !constantTimeStringCompare(it->second.digest, presented))
+        {
+            return std::nullopt;
+        }
+        return it->second.pamrc;
+    }
+
+    // Bumped whenever a user changes.  Read it before starting the PAM
+    // conversation and pass it to store().
+    uint64_t generation() const
+    {
+        return currentGeneration;
+    }
+
+    // Records a PAM result.  A result from before the last user change is
+    // dropped, since the password it checked may no longer be valid.
+    void store(std::string_view username, std::string_view password,
+               int pamrc, uint64_t startedAt,
+               std::chrono::steady_clock::time_point now =
+                   std::chrono::steady_clock::now())
+    {
+        if (!enabled())
+        {
+            return;
+        }
+        if (startedAt != currentGeneration)
+        {
+            BMCWEB_LOG_DEBUG("Users changed during PAM check for {}, not "
+                             "caching the result",
+                             username);
+            return;
+        }
+        std::string newDigest = digest(username, password);
+        if ((pamrc != PAM_SUCCESS && pamrc != PAM_NEW_AUTHTOK_REQD) ||
+            newDigest.empty())
+        {
+            // A wrong password may mean the right one changed
+            invalidate(username);
+            return;
+        }
+        if (!entries.contains(username) && entries.size() >= maxEntries)
+        {
+            for (auto it = entries.begin(); it != entries.end();)
+            {
+                if (now >= it->second.expires)
+                {
+                    it = entries.erase(it);
+                    continue;
+                }
+                it++;
+            }
+            if (entries.size() >= maxEntries)
+            {
+                entries.erase(entries.begin());
+            }
+        }
+        Entry& entry = entries[std::string(username)];
+        entry.digest = std::move(newDigest);
+        entry.pamrc = pamrc;
+        entry.expires = now + ttl;
+    }
+
+    // Forget a user, for example after a password change or removal.  PAM
+    // checks still in flight won't be cached either.
+    void invalidate(std::string_view username)
+    {
+        currentGeneration++;
+        auto it = entries.find(username);
+        if (it == entries.end())
+        {
+            return;
+        }
+        entries.erase(it);
+        BMCWEB_LOG_DEBUG("Dropped cached Basic auth credentials for {}",
+                         username);
+    }
+
+    size_t size() const
+    {
+        return entries.size();
+    }
+
+    static BasicAuthCache& getInstance()
+    {
+        static BasicAuthCache cache{
+            std::chrono::seconds(BMCWEB_BASIC_AUTH_CACHE_TTL)};
+        return cache;
+    }
+
+  private:
+    struct Entry
+    {
+        std::string digest;
+        int pamrc = PAM_SYSTEM_ERR;
+        std::chrono::steady_clock::time_point expires;
+    };
+
+    std::string digest(std::string_view username,
+                       std::string_view password) const
+    {
+        std::string input;
+        input.reserve(salt.size() + username.size() + password.size() + 1);
+        input += salt;
+        input += username;
+        input += ':';
+        input += password;
+
+        std::array<unsigned char, EVP_MAX_MD_SIZE> md{};
+        unsigned int mdLen = 0;
+        int ok = EVP_Digest(input.data(), input.size(), md.data(), &mdLen,
+                            EVP_sha256(), nullptr);
+        OPENSSL_cleanse(input.data(), input.size());
+        if (ok != 1)
+        {
+            // An empty digest never matches a stored one
+            return {};
+        }
+        return {md.begin(), md.begin() + mdLen};
+    }
+
+    std::chrono::seconds ttl;
+    size_t maxEntries;
+    uint64_t currentGeneration = 0;
+    std::string salt;
+    boost::container::flat_map<std::string, Entry, std::less<>> entries;
+};
+
+} // namespace bmcweb
@@ -3,24 +3,29 @@
 #pragma once
 #include "app.hpp"
 #include "dbus_singleton.hpp"
+#include "io_context_singleton.hpp"
 #include "logging.hpp"
 #include "openbmc_dbus_rest.hpp"
 #include "websocket.hpp"
 
-#include <systemd/sd-bus.h>
-
+#include <boost/asio/steady_timer.hpp>
 #include <boost/container/flat_map.hpp>
 #include <boost/container/flat_set.hpp>
 #include <nlohmann/json.hpp>
+#include <sdbusplus/bus.hpp>
 #include <sdbusplus/bus/match.hpp>
 #include <sdbusplus/message.hpp>
 
+#include <algorithm>
+#include <chrono>
 #include <cstddef>
 #include <cstring>
 #include <functional>
 #include <memory>
 #include <regex>
 #include <string>
+#include <string_view>
+#include <utility>
 #include <vector>
 
 namespace crow
@@ -30,7 +35,8 @@ namespace dbus_monitor
 
 struct DbusWebsocketSession
 {
-    std::vector<std::unique_ptr<sdbusplus::bus::match_t>> matches;
+    // Match rules this session subscribed to
+    std::vector<std::string> rules;
     boost::container::flat_set<std::string, std::less<>,
                                std::vector<std::string>>
         interfaces;
@@ -42,93 +48,286 @@ using SessionMap = boost::container::flat_map<crow::websocket::Connection*,
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
 static SessionMap sessions;
 
-inline int onPropertyUpdate(sd_bus_message* m, void* userdata,
-                            sd_bus_error* retError)
+// A single D-Bus match shared by every session that asked for the same rule.
+// Each signal is converted once and the resulting text sent to every
+// subscriber.
+struct SharedMatch
 {
-    if (retError == nullptr || (sd_bus_error_is_set(retError) != 0))
-    {
-        BMCWEB_LOG_ERROR("Got sdbus error on match");
-        return 0;
-    }
-    crow::websocket::Connection* connection =
-        static_cast<crow::websocket::Connection*>(userdata);
-    auto thisSession = sessions.find(connection);
-    if (thisSession == sessions.end())
+    std::unique_ptr<sdbusplus::bus::match_t> match;
+    std::vector<crow::websocket::Connection*> subscribers;
+    // PropertiesChanged updates waiting for the next batch, at most one per
+    // path and interface
+    std::vector<nlohmann::json::object_t> pending;
+};
+
+using MatchMap =
+    boost::container::flat_map<std::string, SharedMatch, std::less<>>;
+
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+static MatchMap matches;
+
+// Property updates are coalesced for this long before being sent.  0 sends
+// every signal as it arrives.
+constexpr std::chrono::milliseconds batchInterval(
+    BMCWEB_DBUS_MONITOR_BATCH_MS);
+
+inline std::string serializeEvent(const nlohmann::json& json)
+{
+    return json.dump(2, ' ', true, nlohmann::json::error_handler_t::replace);
+}
+
+inline void sendToSubscribers(const SharedMatch& shared, std::string_view text)
+{
+    for (crow::websocket::Connection* connection : shared.subscribers)
     {
-        BMCWEB_LOG_ERROR("Couldn't find dbus connection {}",
-                         logPtr(connection));
-        return 0;
+        connection->sendText(text);
     }
-    sdbusplus::message_t message(m);
-    nlohmann::json json;
-    json["event"] = message.get_member();
-    json["path"] = message.get_path();
-    if (strcmp(message.get_member(), "PropertiesChanged") == 0)
+}
+
+inline void flushPending()
+{
+    for (auto& [rule, shared] : matches)
     {
-        nlohmann::json data;
-        int r = openbmc_mapper::convertDBusToJSON("sa{sv}as", message, data);
-        if (r < 0)
+        for (nlohmann::json::object_t& update : shared.pending)
         {
-            BMCWEB_LOG_ERROR("convertDBusToJSON failed with {}", r);
-            return 0;
+            sendToSubscribers(shared, serializeEvent(std::move(update)));
         }
-        if (!data.is_array())
+        shared.pending.clear();
+    }
+}
+
+inline void schedulePendingFlush()
+{
+    static boost::asio::steady_timer timer(getIoContext());
+    static bool scheduled = false;
+    if (scheduled)
+    {
+        return;
+    }
+    scheduled = true;
+    timer.expires_after(batchInterval);
+    timer.async_wait([](const boost::system::error_code& ec) {
+        scheduled = false;
+        if (ec)
         {
-            BMCWEB_LOG_ERROR("No data in PropertiesChanged signal");
-            return 0;
+            BMCWEB_LOG_ERROR("Monitor batch timer failed {}", ec.message());
         }
+        flushPending();
+    });
+}
 
-        // data is type sa{sv}as and is an array[3] of string, object, array
-        json["interface"] = data[0];
-        json["properties"] = data[1];
+// Merges an update into the batch, replacing older values of the same
+// properties
+inline void addPendingUpdate(SharedMatch& shared,
+                             nlohmann::json::object_t&& update)
+{
+    auto existing = std::ranges::find_if(
+        shared.pending, [&update](const nlohmann::json::object_t& pending) {
+            return pending.at("path") == update["path"] &&
+                   pending.at("interface") == update["interface"];
+        });
+    if (existing == shared.pending.end())
+    {
+        shared.pending.emplace_back(std::move(update));
+        schedulePendingFlush();
+        return;
     }
-    else if (strcmp(message.get_member(), "InterfacesAdded") == 0)
+    nlohmann::json::object_t* properties =
+        update["properties"].get_ptr<nlohmann::json::object_t*>();
+    nlohmann::json& merged = (*existing)["properties"];
+    if (properties == nullptr || !merged.is_object())
     {
-        nlohmann::json data;
-        int r = openbmc_mapper::convertDBusToJSON("oa{sa{sv}}", message, data);
-        if (r < 0)
-        {
-            BMCWEB_LOG_ERROR("convertDBusToJSON failed with {}", r);
-            return 0;
-        }
-        nlohmann::json::array_t* arr = data.get_ptr<nlohmann::json::array_t*>();
-        if (arr == nullptr)
+        *existing = std::move(update);
+        return;
+    }
+    for (auto& [name, value] : *properties)
+    {
+        merged[name] = std::move(value);
+    }
+}
+
+inline void onPropertiesChanged(SharedMatch& shared,
+                                sdbusplus::message_t& message)
+{
+    nlohmann::json data;
+    int r = openbmc_mapper::convertDBusToJSON("sa{sv}as", message, data);
+    if (r < 0)
+    {
+        BMCWEB_LOG_ERROR("convertDBusToJSON failed with {}", r);
+        return;
+    }
+    if (!data.is_array())
+    {
+        BMCWEB_LOG_ERROR("No data in PropertiesChanged signal");
+        return;
+    }
+
+    // data is type sa{sv}as and is an array[3] of string, object, array
+    nlohmann::json::object_t json;
+    json["event"] = message.get_member();
+    json["path"] = message.get_path();
+    json["interface"] = std::move(data[0]);
+    json["properties"] = std::move(data[1]);
+
+    if (batchInterval.count() > 0)
+    {
+        addPendingUpdate(shared, std::move(json));
+        return;
+    }
+    sendToSubscribers(shared, serializeEvent(std::move(json)));
+}
+
+inline void onInterfacesAdded(const SharedMatch& shared,
+                              sdbusplus::message_t& message)
+{
+    nlohmann::json data;
+    int r = openbmc_mapper::convertDBusToJSON("oa{sa{sv}}", message, data);
+    if (r < 0)
+    {
+        BMCWEB_LOG_ERROR("convertDBusToJSON failed with {}", r);
+        return;
+    }
+    nlohmann::json::array_t* arr = data.get_ptr<nlohmann::json::array_t*>();
+    if (arr == nullptr)
+    {
+        BMCWEB_LOG_ERROR("No data in InterfacesAdded signal");
+        return;
+    }
+    if (arr->size() < 2)
+    {
+        BMCWEB_LOG_ERROR("No data in InterfacesAdded signal");
+        return;
+    }
+
+    const nlohmann::json::object_t* obj =
+        (*arr)[1].get_ptr<const nlohmann::json::object_t*>();
+    if (obj == nullptr)
+    {
+        BMCWEB_LOG_ERROR("No data in InterfacesAdded signal");
+        return;
+    }
+
+    // Each session only sees the interfaces it asked for, so the event is
+    // serialized once per distinct interface filter
+    std::vector<std::pair<const DbusWebsocketSession*, std::string>> filtered;
+    for (crow::websocket::Connection* connection : shared.subscribers)
+    {
+        auto thisSession = sessions.find(connection);
+        if (thisSession == sessions.end())
         {
-            BMCWEB_LOG_ERROR("No data in InterfacesAdded signal");
-            return 0;
+            BMCWEB_LOG_ERROR("Couldn't find dbus connection {}",
+                             logPtr(connection));
+            continue;
         }
-        if (arr->size() < 2)
+        const DbusWebsocketSession& session = thisSession->second;
+        auto same = std::ranges::find_if(
+            filtered,
+            [&session](
+                const std::pair<const DbusWebsocketSession*, std::string>&
+                    done) {
+                return done.first->interfaces == session.interfaces;
+            });
+        if (same != filtered.end())
         {
-            BMCWEB_LOG_ERROR("No data in InterfacesAdded signal");
-            return 0;
+            connection->sendText(same->second);
+            continue;
         }
 
-        nlohmann::json::object_t* obj =
-            (*arr)[1].get_ptr<nlohmann::json::object_t*>();
-        if (obj == nullptr)
-        {
-            BMCWEB_LOG_ERROR("No data in InterfacesAdded signal");
-            return 0;
-        }
+        nlohmann::json json;
+        json["event"] = message.get_member();
+        json["path"] = message.get_path();
         // data is type oa{sa{sv}} which is an array[2] of string, object
         for (const auto& entry : *obj)
         {
-            auto it = thisSession->second.interfaces.find(entry.first);
-            if (it != thisSession->second.interfaces.end())
+            auto it = session.interfaces.find(entry.first);
+            if (it != session.interfaces.end())
             {
                 json["interfaces"][entry.first] = entry.second;
             }
         }
+        filtered.emplace_back(&session, serializeEvent(json));
+        connection->sendText(filtered.back().second);
+    }
+}
+
+inline void onSignal(const std::string& rule, sdbusplus::message_t& message)
+{
+    auto shared = matches.find(rule);
+    if (shared == matches.end())
+    {
+        BMCWEB_LOG_ERROR("Signal for unknown match {}", rule);
+        return;
+    }
+    if (strcmp(message.get_member(), "PropertiesChanged") == 0)
+    {
+        onPropertiesChanged(shared->second, message);
+    }
+    else if (strcmp(message.get_member(), "InterfacesAdded") == 0)
+    {
+        onInterfacesAdded(shared->second, message);
     }
     else
     {
         BMCWEB_LOG_CRITICAL("message {} was unexpected", message.get_member());
-        return 0;
     }
+}
+
+// Adds the connection to the match for this rule.  Returns the match if it
+// was created for this connection and still needs registering with D-Bus.
+inline SharedMatch* addSubscriber(crow::websocket::Connection& conn,
+                                  DbusWebsocketSession& session,
+                                  const std::string& rule)
+{
+    if (std::ranges::find(session.rules, rule) != session.rules.end())
+    {
+        return nullptr;
+    }
+    auto [shared, inserted] = matches.try_emplace(rule);
+    if (!inserted)
+    {
+        BMCWEB_LOG_DEBUG("Sharing match {} with {} other sessions", rule,
+                         shared->second.subscribers.size());
+    }
+    shared->second.subscribers.emplace_back(&conn);
+    session.rules.emplace_back(rule);
+    return inserted ? &shared->second : nullptr;
+}
+
+// Adds the connection to the match for this rule, registering the match with
+// D-Bus if no other session uses it yet
+inline void subscribe(crow::websocket::Connection& conn,
+                      DbusWebsocketSession& session, const std::string& rule)
+{
+    SharedMatch* created = addSubscriber(conn, session, rule);
+    if (created == nullptr)
+    {
+        return;
+    }
+    BMCWEB_LOG_DEBUG("Creating match {}", rule);
+    created->match = std::make_unique<sdbusplus::bus::match_t>(
+        static_cast<sdbusplus::bus_t&>(*crow::connections::systemBus), rule,
+        [rule](sdbusplus::message_t& message) { onSignal(rule, message); });
+}
 
-    connection->sendText(
-        json.dump(2, ' ', true, nlohmann::json::error_handler_t::replace));
-    return 0;
+// Drops the connection from its matches, removing any match that no session
+// uses any more
+inline void unsubscribe(crow::websocket::Connection& conn,
+                        const DbusWebsocketSession& session)
+{
+    for (const std::string& rule : session.rules)
+    {
+        auto shared = matches.find(rule);
+        if (shared == matches.end())
+        {
+            continue;
+        }
+        std::erase(shared->second.subscribers, &conn);
+        if (shared->second.subscribers.empty())
+        {
+            BMCWEB_LOG_DEBUG("Removing match {}", rule);
+            matches.erase(shared);
+        }
+    }
 }
 
 inline void requestRoutes(App& app)
@@ -141,7 +340,13 @@ inline void requestRoutes(App& app)
             sessions.try_emplace(&conn);
         })
         .onclose([](crow::websocket::Connection& conn, const std::string&) {
-            sessions.erase(&conn);
+            auto thisSession = sessions.find(&conn);
+            if (thisSession == sessions.end())
+            {
+                return;
+            }
+            unsubscribe(conn, thisSession->second);
+            sessions.erase(thisSession);
         })
         .onmessage([](crow::websocket::Connection& conn,
                       const std::string& data, bool) {
@@ -221,13 +426,7 @@ inline void requestRoutes(App& app)
                 // interfaces
                 if (thisSession.interfaces.empty())
                 {
-                    BMCWEB_LOG_DEBUG("Creating match {}",
-                                     propertiesMatchString);
-
-                    thisSession.matches.emplace_back(
-                        std::make_unique<sdbusplus::bus::match_t>(
-                            *crow::connections::systemBus,
-                            propertiesMatchString, onPropertyUpdate, &conn));
+                    subscribe(conn, thisSession, propertiesMatchString);
                 }
                 else
                 {
@@ -246,11 +445,7 @@ inline void requestRoutes(App& app)
                         ifaceMatchString += ",arg0='";
                         ifaceMatchString += interface;
                         ifaceMatchString += "'";
-                        BMCWEB_LOG_DEBUG("Creating match {}", ifaceMatchString);
-                        thisSession.matches.emplace_back(
-                            std::make_unique<sdbusplus::bus::match_t>(
-                                *crow::connections::systemBus, ifaceMatchString,
-                                onPropertyUpdate, &conn));
+                        subscribe(conn, thisSession, ifaceMatchString);
                     }
                 }
                 std::string objectManagerMatchString =
@@ -260,11 +455,7 @@ inline void requestRoutes(App& app)
                      *thisPathString +
                      "',"
                      "member='InterfacesAdded'");
-                BMCWEB_LOG_DEBUG("Creating match {}", objectManagerMatchString);
-                thisSession.matches.emplace_back(
-                    std::make_unique<sdbusplus::bus::match_t>(
-                        *crow::connections::systemBus, objectManagerMatchString,
-                        onPropertyUpdate, &conn));
+                subscribe(conn, thisSession, objectManagerMatchString);
             }
         });
 }
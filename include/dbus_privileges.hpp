@@ -17,6 +17,7 @@
 #include <boost/url/format.hpp>
 #include <sdbusplus/unpack_properties.hpp>
 
+#include <chrono>
 #include <functional>
 #include <memory>
 #include <optional>
@@ -68,6 +69,11 @@ inline bool populateUserInfo(
         session.userGroups.swap(*userGroups);
     }
 
+    // Remote users get their role from directory group mappings, which can
+    // change without any signal on the user object, so they are never cached
+    session.userInfoValid = !remoteUser;
+    session.userInfoValidatedAt = std::chrono::steady_clock::now();
+
     return true;
 }
 
@@ -166,6 +172,18 @@ inline void validatePrivilege(
         return;
     }
 
+    if (req->session->isUserInfoCurrent())
+    {
+        if (!isUserPrivileged(*req, asyncResp, rule))
+        {
+            BMCWEB_LOG_ERROR("Insufficient Privilege");
+            asyncResp->res.result(boost::beast::http::status::forbidden);
+            return;
+        }
+        callback();
+        return;
+    }
+
     requestUserInfo(
         req->session->username, asyncResp,
         [req, asyncResp, &rule, callback = std::move(callback)](
@@ -6,6 +6,7 @@
 #include "async_resp.hpp"
 #include "dbus_singleton.hpp"
 #include "dbus_utility.hpp"
+#include "http_body.hpp"
 #include "http_request.hpp"
 #include "io_context_singleton.hpp"
 #include "logging.hpp"
@@ -13,8 +14,11 @@
 
 #include <boost/asio/error.hpp>
 #include <boost/asio/steady_timer.hpp>
+#include <boost/beast/core/file_base.hpp>
+#include <boost/beast/core/file_posix.hpp>
 #include <boost/beast/http/status.hpp>
 #include <boost/beast/http/verb.hpp>
+#include <boost/system/error_code.hpp>
 #include <sdbusplus/bus/match.hpp>
 #include <sdbusplus/message.hpp>
 #include <sdbusplus/message/native_types.hpp>
@@ -22,11 +26,13 @@
 #include <algorithm>
 #include <chrono>
 #include <cstdio>
+#include <filesystem>
 #include <fstream>
 #include <functional>
 #include <memory>
 #include <ranges>
 #include <string>
+#include <system_error>
 
 namespace crow
 {
@@ -109,10 +115,40 @@ inline void uploadImageHandler(
 
     std::string filepath("/tmp/images/" + bmcweb::getRandomUUID());
     BMCWEB_LOG_DEBUG("Writing file to {}", filepath);
-    std::ofstream out(filepath, std::ofstream::out | std::ofstream::binary |
-                                    std::ofstream::trunc);
-    out << req.body();
-    out.close();
+    bool written = false;
+    if (req.bodyFile().is_open())
+    {
+        // Streamed to a memory file as it arrived, so copy it in the kernel
+        boost::beast::file_posix out;
+        boost::system::error_code ec;
+        out.open(filepath.c_str(), boost::beast::file_mode::write, ec);
+        written = !ec && bmcweb::copyFileContents(req.bodyFile(),
+                                                  out.native_handle());
+    }
+    else
+    {
+        std::ofstream out(filepath, std::ofstream::out |
+                                        std::ofstream::binary |
+                                        std::ofstream::trunc);
+        out << req.body();
+        out.close();
+        written = !out.fail();
+    }
+    if (!written)
+    {
+        // Don't leave a truncated image for the software manager
+        BMCWEB_LOG_ERROR("Failed to write image to {}", filepath);
+        std::error_code removeEc;
+        std::filesystem::remove(filepath, removeEc);
+        fwUpdateMatcher = nullptr;
+        asyncResp->res.result(
+            boost::beast::http::status::internal_server_error);
+        asyncResp->res.jsonValue["data"]["description"] =
+            "Failed to write image";
+        asyncResp->res.jsonValue["message"] = "500 Internal Server Error";
+        asyncResp->res.jsonValue["status"] = "error";
+        return;
+    }
     timeout.async_wait(timeoutHandler);
 }
 
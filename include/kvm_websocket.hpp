@@ -12,12 +12,18 @@
 #include <boost/asio/error.hpp>
 #include <boost/asio/ip/address.hpp>
 #include <boost/asio/ip/tcp.hpp>
+#include <boost/asio/post.hpp>
+#include <boost/asio/socket_base.hpp>
 #include <boost/beast/core/flat_static_buffer.hpp>
 #include <boost/container/flat_map.hpp>
 
 #include <cstddef>
+#include <functional>
 #include <memory>
 #include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
 
 namespace crow
 {
@@ -26,6 +32,91 @@ namespace obmc_kvm
 
 static constexpr const uint maxSessions = 4;
 
+// Video buffers shared by every KVM session.  A session only holds buffers
+// while it has video waiting to be sent, so idle viewers don't pin memory.
+// Buffers are handed out as leases: once the last copy of a lease is dropped,
+// by a session or by a write handler that is destroyed without running, the
+// buffer is free again and sessions waiting for one are woken.
+class KvmFramePool
+{
+  public:
+    using FrameBuffer = boost::beast::flat_static_buffer<1024UL * 50UL>;
+
+    explicit KvmFramePool(size_t maxBuffersIn) : maxBuffers(maxBuffersIn) {}
+
+    // Returns nullptr if every buffer is in use
+    std::shared_ptr<FrameBuffer> acquire()
+    {
+        for (const std::shared_ptr<FrameBuffer>& buffer : buffers)
+        {
+            if (buffer.use_count() == 1)
+            {
+                buffer->clear();
+                return lease(buffer);
+            }
+        }
+        if (buffers.size() >= maxBuffers)
+        {
+            return nullptr;
+        }
+        return lease(buffers.emplace_back(std::make_shared<FrameBuffer>()));
+    }
+
+    // Runs the callback the next time a buffer is dropped
+    void whenReleased(std::function<void()>&& callback)
+    {
+        waiters.emplace_back(std::move(callback));
+    }
+
+  private:
+    std::shared_ptr<FrameBuffer> lease(
+        const std::shared_ptr<FrameBuffer>& buffer)
+    {
+        return {buffer.get(), [this, held(buffer)](FrameBuffer*) mutable {
+                    held.reset();
+                    released();
+                }};
+    }
+
+    void released()
+    {
+        std::vector<std::function<void()>> toRun;
+        toRun.swap(waiters);
+        for (std::function<void()>& waiter : toRun)
+        {
+            boost::asio::post(getIoContext(), std::move(waiter));
+        }
+    }
+
+  public:
+    size_t allocated() const
+    {
+        return buffers.size();
+    }
+
+    static KvmFramePool& getInstance()
+    {
+        // Enough for every session to read and send at the same time
+        static KvmFramePool pool(2UL * maxSessions);
+        return pool;
+    }
+
+  private:
+    size_t maxBuffers;
+    std::vector<std::shared_ptr<FrameBuffer>> buffers;
+    std::vector<std::function<void()>> waiters;
+};
+
+// Video throughput of one session
+struct KvmStats
+{
+    size_t framesSent = 0;
+    size_t bytesSent = 0;
+    // Reads from the KVM socket.  More reads than frames means reads were
+    // coalesced while the viewer was slow.
+    size_t socketReads = 0;
+};
+
 class KvmSession : public std::enable_shared_from_this<KvmSession>
 {
   public:
@@ -47,11 +138,37 @@ class KvmSession : public std::enable_shared_from_this<KvmSession>
                     }
                     return;
                 }
-
-                doRead();
+                start();
             });
     }
 
+    // Uses a socket that is already connected to the KVM server.  start()
+    // must be called once the session is owned by a shared_ptr.
+    KvmSession(crow::websocket::Connection& connIn,
+               boost::asio::ip::tcp::socket&& hostSocketIn) :
+        conn(connIn), hostSocket(std::move(hostSocketIn))
+    {}
+
+    void start()
+    {
+        boost::system::error_code nbEc;
+        hostSocket.non_blocking(true, nbEc);
+        if (nbEc)
+        {
+            BMCWEB_LOG_ERROR(
+                "conn:{}, Couldn't set KVM socket non-blocking: {}",
+                logPtr(&conn), nbEc);
+            conn.close("Error in connecting to KVM port");
+            return;
+        }
+        doRead();
+    }
+
+    const KvmStats& getStats() const
+    {
+        return stats;
+    }
+
     void onMessage(const std::string& data)
     {
         if (data.length() > inputBuffer.capacity())
@@ -75,23 +192,51 @@ class KvmSession : public std::enable_shared_from_this<KvmSession>
         doWrite();
     }
 
+    ~KvmSession()
+    {
+        BMCWEB_LOG_DEBUG(
+            "conn:{}, Sent {} frames, {} bytes from {} KVM socket reads",
+            logPtr(&conn), stats.framesSent, stats.bytesSent,
+            stats.socketReads);
+    }
+
+    KvmSession(const KvmSession&) = delete;
+    KvmSession(KvmSession&&) = delete;
+    KvmSession& operator=(const KvmSession&) = delete;
+    KvmSession& operator=(KvmSession&&) = delete;
+
   protected:
+    // Video is read into one pool buffer while another is written to the
+    // websocket straight from memory.  Reads that arrive while a frame is
+    // being written are coalesced into the next frame, so frames grow as the
+    // link gets slower, and reading stops when both buffers are full.  The
+    // KVM server then holds back updates until asked again, which is how a
+    // slow viewer skips frames rather than queuing them.  The socket is waited
+    // on rather than read asynchronously so that no read is ever outstanding
+    // on a buffer that is about to be sent.
     void doRead()
     {
-        std::size_t bytes = outputBuffer.capacity() - outputBuffer.size();
-        BMCWEB_LOG_DEBUG("conn:{}, Reading {} from kvm socket", logPtr(&conn),
-                         bytes);
-        hostSocket.async_read_some(
-            outputBuffer.prepare(outputBuffer.capacity() - outputBuffer.size()),
-            [this, weak(weak_from_this())](const boost::system::error_code& ec,
-                                           std::size_t bytesRead) {
+        if (waitingForRead || waitingForBuffer)
+        {
+            return;
+        }
+        if (readBuffer != nullptr &&
+            readBuffer->size() == readBuffer->capacity())
+        {
+            BMCWEB_LOG_DEBUG("conn:{}, Waiting for websocket to drain",
+                             logPtr(&conn));
+            return;
+        }
+        waitingForRead = true;
+        hostSocket.async_wait(
+            boost::asio::socket_base::wait_read,
+            [this, weak(weak_from_this())](const boost::system::error_code& ec) {
                 auto self = weak.lock();
                 if (self == nullptr)
                 {
                     return;
                 }
-                BMCWEB_LOG_DEBUG("conn:{}, read done.  Read {} bytes",
-                                 logPtr(&conn), bytesRead);
+                waitingForRead = false;
                 if (ec)
                 {
                     BMCWEB_LOG_ERROR(
@@ -103,18 +248,91 @@ class KvmSession : public std::enable_shared_from_this<KvmSession>
                     }
                     return;
                 }
+                readAvailable();
+            });
+    }
 
-                outputBuffer.commit(bytesRead);
-                std::string_view payload(
-                    static_cast<const char*>(outputBuffer.data().data()),
-                    bytesRead);
-                BMCWEB_LOG_DEBUG("conn:{}, Sending payload size {}",
-                                 logPtr(&conn), payload.size());
-                conn.sendBinary(payload);
-                outputBuffer.consume(bytesRead);
+    void readAvailable()
+    {
+        if (readBuffer == nullptr)
+        {
+            readBuffer = KvmFramePool::getInstance().acquire();
+            if (readBuffer == nullptr)
+            {
+                BMCWEB_LOG_DEBUG("conn:{}, Waiting for a free frame buffer",
+                                 logPtr(&conn));
+                waitingForBuffer = true;
+                KvmFramePool::getInstance().whenReleased(
+                    [this, weak(weak_from_this())]() {
+                        auto self = weak.lock();
+                        if (self == nullptr)
+                        {
+                            return;
+                        }
+                        waitingForBuffer = false;
+                        readAvailable();
+                    });
+                return;
+            }
+        }
+        std::size_t bytes = readBuffer->capacity() - readBuffer->size();
+        boost::system::error_code ec;
+        std::size_t bytesRead =
+            hostSocket.read_some(readBuffer->prepare(bytes), ec);
+        if (ec == boost::asio::error::would_block ||
+            ec == boost::asio::error::try_again)
+        {
+            doRead();
+            return;
+        }
+        if (ec)
+        {
+            BMCWEB_LOG_ERROR("conn:{}, Couldn't read from KVM socket port: {}",
+                             logPtr(&conn), ec);
+            conn.close("Error in connecting to KVM port");
+            return;
+        }
+        BMCWEB_LOG_DEBUG("conn:{}, read done.  Read {} bytes", logPtr(&conn),
+                         bytesRead);
+        readBuffer->commit(bytesRead);
+        stats.socketReads++;
+        doSend();
+        doRead();
+    }
 
-                doRead();
-            });
+    void doSend()
+    {
+        if (sending || readBuffer == nullptr || readBuffer->size() == 0)
+        {
+            return;
+        }
+        sendBuffer = std::move(readBuffer);
+        std::string_view frame(
+            static_cast<const char*>(sendBuffer->data().data()),
+            sendBuffer->size());
+        BMCWEB_LOG_DEBUG("conn:{}, Sending payload size {}", logPtr(&conn),
+                         frame.size());
+        sending = true;
+        stats.framesSent++;
+        stats.bytesSent += frame.size();
+        // The frame buffer is kept alive until the write completes, even if
+        // the session goes away first.  It returns to the pool when the last
+        // copy of the lease is dropped, including when the websocket goes
+        // away and destroys this handler without running it.
+        conn.sendEx(crow::websocket::MessageType::Binary, frame,
+                    [this, weak(weak_from_this()),
+                     buffer(sendBuffer)]() mutable {
+                        buffer.reset();
+                        auto self = weak.lock();
+                        if (self == nullptr)
+                        {
+                            return;
+                        }
+                        sending = false;
+                        sendBuffer.reset();
+                        doSend();
+                        doRead();
+                    });
     }
 
     void doWrite()
@@ -169,9 +387,15 @@ class KvmSession : public std::enable_shared_from_this<KvmSession>
 
     crow::websocket::Connection& conn;
     boost::asio::ip::tcp::socket hostSocket;
-    boost::beast::flat_static_buffer<1024UL * 50UL> outputBuffer;
+    std::shared_ptr<KvmFramePool::FrameBuffer> readBuffer;
+    std::shared_ptr<KvmFramePool::FrameBuffer> sendBuffer;
+    bool waitingForRead{false};
+    bool waitingForBuffer{false};
+    bool sending{false};
     boost::beast::flat_static_buffer<1024UL> inputBuffer;
     bool doingWrite{false};
+
+    KvmStats stats;
 };
 
 using SessionMap = boost::container::flat_map<crow::websocket::Connection*,
@@ -9,11 +9,12 @@
 #include "http_response.hpp"
 #include "logging.hpp"
 #include "multipart_parser.hpp"
-#include "pam_authenticate.hpp"
+#include "pam_worker_pool.hpp"
 #include "sessions.hpp"
 
 #include <security/_pam_types.h>
 
+#include <boost/asio/ip/address.hpp>
 #include <boost/beast/http/fields.hpp>
 #include <boost/beast/http/status.hpp>
 #include <boost/beast/http/verb.hpp>
@@ -30,6 +31,27 @@ namespace crow
 namespace login_routes
 {
 
+inline void afterLoginPam(const std::shared_ptr<bmcweb::AsyncResp>& asyncResp,
+                          const std::string& username,
+                          const boost::asio::ip::address& ipAddress, int pamrc)
+{
+    bool isConfigureSelfOnly = pamrc == PAM_NEW_AUTHTOK_REQD;
+    if ((pamrc != PAM_SUCCESS) && !isConfigureSelfOnly)
+    {
+        asyncResp->res.result(boost::beast::http::status::unauthorized);
+        return;
+    }
+    auto session =
+        persistent_data::SessionStore::getInstance().generateUserSession(
+            username, ipAddress, std::nullopt,
+            persistent_data::SessionType::Session, isConfigureSelfOnly);
+
+    bmcweb::setSessionCookies(asyncResp->res, *session);
+
+    // if content type is json, assume json token
+    asyncResp->res.jsonValue["token"] = session->sessionToken;
+}
+
 inline void handleLogin(const crow::Request& req,
                         const std::shared_ptr<bmcweb::AsyncResp>& asyncResp)
 {
@@ -172,25 +194,12 @@ inline void handleLogin(const crow::Request& req,
 
     if (!username.empty() && !password.empty())
     {
-        int pamrc = pamAuthenticateUser(username, password, std::nullopt);
-        bool isConfigureSelfOnly = pamrc == PAM_NEW_AUTHTOK_REQD;
-        if ((pamrc != PAM_SUCCESS) && !isConfigureSelfOnly)
-        {
-            asyncResp->res.result(boost::beast::http::status::unauthorized);
-        }
-        else
-        {
-            auto session =
-                persistent_data::SessionStore::getInstance()
-                    .generateUserSession(username, req.ipAddress, std::nullopt,
-                                         persistent_data::SessionType::Session,
-                                         isConfigureSelfOnly);
-
-            bmcweb::setSessionCookies(asyncResp->res, *session);
-
-            // if content type is json, assume json token
-            asyncResp->res.jsonValue["token"] = session->sessionToken;
-        }
+        bmcweb::pamAuthenticateUserAsync(
+            username, password, std::nullopt,
+            [asyncResp, user = std::string(username),
+             ipAddress = req.ipAddress](int pamrc) {
+                afterLoginPam(asyncResp, user, ipAddress, pamrc);
+            });
     }
     else
     {
@@ -3,12 +3,22 @@
 #pragma once
 
 #include "http_request.hpp"
+#include "logging.hpp"
 
+#include <sys/mman.h>
+#include <sys/types.h>
+#include <unistd.h>
+
+#include <boost/beast/core/file_posix.hpp>
 #include <boost/beast/http/fields.hpp>
+#include <boost/beast/http/rfc7230.hpp>
+#include <boost/system/error_code.hpp>
 
 #include <algorithm>
 #include <array>
+#include <cerrno>
 #include <cstddef>
+#include <limits>
 #include <ranges>
 #include <string>
 #include <string_view>
@@ -56,8 +66,13 @@ struct FormPart
 {
     boost::beast::http::fields fields;
     std::string content;
+    // Set for parts that were spooled to a memory file, see spoolPart().  The
+    // content is then in this file instead of in content.
+    boost::beast::file_posix file;
 };
 
+// Push parser for multipart/form-data.  The body can be handed over in
+// whatever pieces it arrives in with feed(), or all at once with parse().
 class MultipartParser
 {
   public:
@@ -65,8 +80,40 @@ class MultipartParser
 
     [[nodiscard]] ParserError parse(const crow::Request& req)
     {
-        std::string_view contentType = req.getHeaderValue("content-type");
+        ParserError ec = begin(req.getHeaderValue("content-type"));
+        if (ec != ParserError::PARSER_SUCCESS)
+        {
+            return ec;
+        }
+        if (!req.bodyFile().is_open())
+        {
+            feed(req.body());
+            return finish();
+        }
+        // Read back a body that was spooled to a file as it arrived
+        std::array<char, 64UL * 1024UL> chunk{};
+        off_t offset = 0;
+        while (true)
+        {
+            ssize_t read = pread(req.bodyFile().native_handle(), chunk.data(),
+                                 chunk.size(), offset);
+            if (read < 0 && errno == EINTR)
+            {
+                continue;
+            }
+            if (read <= 0)
+            {
+                break;
+            }
+            feed(std::string_view(chunk.data(), static_cast<size_t>(read)));
+            offset += read;
+        }
+        return finish();
+    }
 
+    // Starts a new body, reading the boundary from the content type
+    [[nodiscard]] ParserError begin(std::string_view contentType)
+    {
         const std::string boundaryFormat = "multipart/form-data; boundary=";
         if (!contentType.starts_with(boundaryFormat))
         {
@@ -80,11 +127,90 @@ class MultipartParser
         indexBoundary();
         lookbehind.resize(boundary.size() + 8);
         state = State::START;
+        error = ParserError::PARSER_SUCCESS;
+        mime_fields.clear();
+        return ParserError::PARSER_SUCCESS;
+    }
 
-        const std::string& buffer = req.body();
+    // Parses the next piece of the body.  After an error the rest of the body
+    // is ignored, and the error is returned again by finish().
+    ParserError feed(std::string_view buffer)
+    {
+        if (error != ParserError::PARSER_SUCCESS)
+        {
+            return error;
+        }
+        error = parseChunk(buffer);
+        return error;
+    }
+
+    // Called once the whole body has been fed
+    [[nodiscard]] ParserError finish()
+    {
+        if (error != ParserError::PARSER_SUCCESS)
+        {
+            return error;
+        }
+        if (state != State::END)
+        {
+            return ParserError::ERROR_UNEXPECTED_END_OF_INPUT;
+        }
+        return ParserError::PARSER_SUCCESS;
+    }
+
+    // Parts with this name in their Content-Disposition are written to an
+    // anonymous memory file as they are parsed, rather than held in memory
+    void spoolPart(std::string_view name)
+    {
+        spooledParts.emplace_back(name);
+    }
+
+    // Fails the parse if a part held in memory grows past this many bytes
+    void limitPartSize(size_t maxSize)
+    {
+        maxPartSize = maxSize;
+    }
+
+    // The name parameter of a part's Content-Disposition header
+    static std::string_view partName(const FormPart& part)
+    {
+        boost::beast::http::fields::const_iterator it =
+            part.fields.find("Content-Disposition");
+        if (it == part.fields.end())
+        {
+            return {};
+        }
+        // The construction parameters of param_list must start with `;`
+        size_t index = it->value().find(';');
+        if (index == std::string::npos)
+        {
+            return {};
+        }
+        for (const auto& param :
+             boost::beast::http::param_list{it->value().substr(index)})
+        {
+            if (param.first == "name")
+            {
+                return {param.second.data(), param.second.size()};
+            }
+        }
+        return {};
+    }
+
+    std::vector<FormPart> mime_fields;
+    std::string boundary;
+
+  private:
+    ParserError parseChunk(std::string_view buffer)
+    {
         size_t len = buffer.size();
         char cl = 0;
 
+        // Marks refer to the current chunk only
+        headerFieldMark = 0;
+        headerValueMark = 0;
+        partDataMark = 0;
+
         for (size_t i = 0; i < len; i++)
         {
             char c = buffer[i];
@@ -164,16 +290,17 @@ class MultipartParser
                     {
                         break;
                     }
+                    currentHeaderValue.resize(0);
                     headerValueMark = i;
                     state = State::HEADER_VALUE;
                     [[fallthrough]];
                 case State::HEADER_VALUE:
                     if (c == cr)
                     {
-                        std::string_view value(&buffer[headerValueMark],
-                                               i - headerValueMark);
+                        currentHeaderValue.append(&buffer[headerValueMark],
+                                                  i - headerValueMark);
                         mime_fields.rbegin()->fields.set(currentHeaderName,
-                                                         value);
+                                                         currentHeaderValue);
                         state = State::HEADER_VALUE_ALMOST_DONE;
                     }
                     break;
@@ -193,6 +320,10 @@ class MultipartParser
                     {
                         return ParserError::ERROR_UNEXPECTED_END_OF_HEADER;
                     }
+                    if (!openPartSink())
+                    {
+                        return ParserError::ERROR_OUT_OF_RANGE;
+                    }
                     state = State::PART_DATA_START;
                     break;
                 case State::PART_DATA_START:
@@ -220,17 +351,68 @@ class MultipartParser
             }
         }
 
-        if (state != State::END)
+        // Carry whatever was only partly seen over to the next chunk
+        if (state == State::HEADER_FIELD)
         {
-            return ParserError::ERROR_UNEXPECTED_END_OF_INPUT;
+            currentHeaderName.append(buffer.substr(headerFieldMark));
+        }
+        else if (state == State::HEADER_VALUE)
+        {
+            currentHeaderValue.append(buffer.substr(headerValueMark));
+        }
+        else if (state == State::PART_DATA && index == 0)
+        {
+            return appendPartData(buffer.substr(partDataMark));
+        }
+        return ParserError::PARSER_SUCCESS;
+    }
+
+    bool openPartSink()
+    {
+        FormPart& part = *mime_fields.rbegin();
+        std::string_view name = partName(part);
+        if (std::ranges::find(spooledParts, name) == spooledParts.end())
+        {
+            return true;
+        }
+        int fd = memfd_create("multipart-part", MFD_CLOEXEC);
+        if (fd < 0)
+        {
+            BMCWEB_LOG_ERROR("Failed to create memfd for part {}", name);
+            return false;
         }
+        part.file.native_handle(fd);
+        return true;
+    }
 
+    ParserError appendPartData(std::string_view data)
+    {
+        if (data.empty())
+        {
+            return ParserError::PARSER_SUCCESS;
+        }
+        FormPart& part = *mime_fields.rbegin();
+        if (part.file.is_open())
+        {
+            boost::system::error_code ec;
+            part.file.write(data.data(), data.size(), ec);
+            if (ec)
+            {
+                BMCWEB_LOG_ERROR("Failed to write part {}", ec.message());
+                return ParserError::ERROR_OUT_OF_RANGE;
+            }
+            return ParserError::PARSER_SUCCESS;
+        }
+        if (part.content.size() + data.size() > maxPartSize)
+        {
+            BMCWEB_LOG_ERROR("Multipart part larger than {} bytes",
+                             maxPartSize);
+            return ParserError::ERROR_OUT_OF_RANGE;
+        }
+        part.content += data;
         return ParserError::PARSER_SUCCESS;
     }
-    std::vector<FormPart> mime_fields;
-    std::string boundary;
 
-  private:
     void indexBoundary()
     {
         std::ranges::fill(boundaryIndex, 0);
@@ -250,11 +432,11 @@ class MultipartParser
         return boundaryIndex[static_cast<unsigned char>(c)];
     }
 
-    void skipNonBoundary(const std::string& buffer, size_t boundaryEnd,
+    void skipNonBoundary(std::string_view buffer, size_t boundaryEnd,
                          size_t& i)
     {
         // boyer-moore derived algorithm to safely skip non-boundary data
-        while (i + boundary.size() <= buffer.length())
+        while (i + boundary.size() < buffer.length())
         {
             if (isBoundaryChar(buffer[i + boundaryEnd]))
             {
@@ -264,7 +446,7 @@ class MultipartParser
         }
     }
 
-    ParserError processPartData(const std::string& buffer, size_t& i, char c)
+    ParserError processPartData(std::string_view buffer, size_t& i, char c)
     {
         size_t prevIndex = index;
 
@@ -274,10 +456,12 @@ class MultipartParser
             {
                 if (index == 0)
                 {
-                    const char* start = &buffer[partDataMark];
-                    size_t size = i - partDataMark;
-                    mime_fields.rbegin()->content +=
-                        std::string_view(start, size);
+                    ParserError ec = appendPartData(
+                        buffer.substr(partDataMark, i - partDataMark));
+                    if (ec != ParserError::PARSER_SUCCESS)
+                    {
+                        return ec;
+                    }
                 }
                 index++;
             }
@@ -346,7 +530,12 @@ class MultipartParser
             // if our boundary turned out to be rubbish, the captured
             // lookbehind belongs to partData
 
-            mime_fields.rbegin()->content += lookbehind.substr(0, prevIndex);
+            ParserError ec =
+                appendPartData(std::string_view(lookbehind).substr(0, prevIndex));
+            if (ec != ParserError::PARSER_SUCCESS)
+            {
+                return ec;
+            }
             partDataMark = i;
 
             // reconsider the current character even so it interrupted
@@ -367,6 +556,9 @@ class MultipartParser
 
     std::array<bool, 256> boundaryIndex{};
     std::string lookbehind;
+    std::vector<std::string> spooledParts;
+    size_t maxPartSize = std::numeric_limits<size_t>::max();
+    ParserError error = ParserError::PARSER_SUCCESS;
     State state{State::START};
     Boundary flags{Boundary::NON_BOUNDARY};
     size_t index = 0;
@@ -0,0 +1,80 @@
+// SPDX-License-Identifier: Apache-2.0
+// SPDX-FileCopyrightText: Copyright OpenBMC Authors
+#pragma once
+
+#include <boost/beast/core/flat_static_buffer.hpp>
+
+#include <array>
+#include <cstddef>
+#include <optional>
+#include <string_view>
+
+namespace crow
+{
+
+// Ring of buffers carrying NBD traffic towards the websocket.  One is filled
+// from the local side while earlier ones are sent to the websocket straight
+// from memory, so several NBD messages can be in flight at once.  Each holds
+// two maximum sized simple replies, so the ring takes the same memory as the
+// pair of fixed buffers it replaced.
+// https://github.com/NetworkBlockDevice/nbd/blob/master/doc/proto.md#simple-reply-message
+class NbdSendRing
+{
+  public:
+    static constexpr size_t slots = 4;
+    static constexpr size_t slotSize = (128UL * 1024UL + 16UL) * 2UL;
+
+    bool canRead() const
+    {
+        return !reading && filled < slots;
+    }
+
+    // Space to read into.  Only one read may be outstanding.
+    boost::beast::flat_static_buffer<slotSize>::mutable_buffers_type
+        prepareRead()
+    {
+        reading = true;
+        return ring[readSlot].prepare(slotSize);
+    }
+
+    void commitRead(size_t bytesRead)
+    {
+        reading = false;
+        ring[readSlot].commit(bytesRead);
+        readSlot = (readSlot + 1) % slots;
+        filled++;
+    }
+
+    // The oldest filled buffer, which must stay untouched until
+    // finishSend() is called.  Only one send may be outstanding.
+    std::optional<std::string_view> startSend()
+    {
+        if (sending || filled == 0)
+        {
+            return std::nullopt;
+        }
+        sending = true;
+        const boost::beast::flat_static_buffer<slotSize>& slot =
+            ring[sendSlot];
+        return std::string_view(static_cast<const char*>(slot.data().data()),
+                                slot.size());
+    }
+
+    void finishSend()
+    {
+        ring[sendSlot].clear();
+        sendSlot = (sendSlot + 1) % slots;
+        filled--;
+        sending = false;
+    }
+
+  private:
+    std::array<boost::beast::flat_static_buffer<slotSize>, slots> ring;
+    size_t readSlot = 0;
+    size_t sendSlot = 0;
+    size_t filled = 0;
+    bool reading = false;
+    bool sending = false;
+};
+
+} // namespace crow
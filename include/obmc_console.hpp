@@ -15,6 +15,7 @@
 #include <boost/asio/io_context.hpp>
 #include <boost/asio/local/stream_protocol.hpp>
 #include <boost/beast/core/error.hpp>
+#include <boost/circular_buffer.hpp>
 #include <boost/container/flat_map.hpp>
 #include <boost/system/error_code.hpp>
 #include <sdbusplus/message/native_types.hpp>
@@ -36,12 +37,18 @@ namespace obmc_console
 // Update this value each time we add new console route.
 static constexpr const uint maxSessions = 32;
 
+// Recent output kept for viewers that attach later
+static constexpr size_t scrollbackSize = 16UL * 1024UL;
+
+// Output queued for a viewer that isn't keeping up.  Beyond this the oldest
+// output is dropped for that viewer.
+static constexpr size_t viewerBacklogLimit = 64UL * 1024UL;
+
+// One websocket viewing a console
 class ConsoleHandler : public std::enable_shared_from_this<ConsoleHandler>
 {
   public:
-    ConsoleHandler(boost::asio::io_context& ioc,
-                   crow::websocket::Connection& connIn) :
-        hostSocket(ioc), conn(connIn)
+    explicit ConsoleHandler(crow::websocket::Connection& connIn) : conn(connIn)
     {}
 
     ~ConsoleHandler() = default;
@@ -51,6 +58,172 @@ class ConsoleHandler : public std::enable_shared_from_this<ConsoleHandler>
     ConsoleHandler& operator=(const ConsoleHandler&) = delete;
     ConsoleHandler& operator=(ConsoleHandler&&) = delete;
 
+    // Starts reading from the websocket once the console is connected
+    void start()
+    {
+        if (started)
+        {
+            return;
+        }
+        started = true;
+        conn.resumeRead();
+    }
+
+    void queue(std::string_view data)
+    {
+        pending += data;
+        if (pending.size() > viewerBacklogLimit)
+        {
+            BMCWEB_LOG_WARNING("Console viewer {} is behind, dropping {} bytes",
+                               logPtr(&conn),
+                               pending.size() - viewerBacklogLimit);
+            pending.erase(0, pending.size() - viewerBacklogLimit);
+        }
+        doSend();
+    }
+
+    void doSend()
+    {
+        if (sending || pending.empty())
+        {
+            return;
+        }
+        sending = true;
+        inFlight.swap(pending);
+        pending.clear();
+        // The write reads from inFlight, so the handler stays alive until it
+        // completes
+        conn.sendEx(crow::websocket::MessageType::Binary, inFlight,
+                    [self(shared_from_this())]() {
+                        self->sending = false;
+                        self->inFlight.clear();
+                        self->doSend();
+                    });
+    }
+
+    crow::websocket::Connection& conn;
+    std::string consolePath;
+
+  private:
+    std::string pending;
+    std::string inFlight;
+    bool sending = false;
+    bool started = false;
+};
+
+class ConsoleUpstream;
+
+using ConsoleUpstreamMap =
+    boost::container::flat_map<std::string, std::shared_ptr<ConsoleUpstream>,
+                               std::less<>>;
+
+inline ConsoleUpstreamMap& getConsoleUpstreamMap()
+{
+    static ConsoleUpstreamMap map;
+    return map;
+}
+
+// A single connection to an obmc-console socket, shared by every websocket
+// viewing that console.  Output is fanned out to each viewer, and the most
+// recent output is kept so that new viewers see it straight away.  The
+// connection stays open after the last viewer leaves so the scrollback keeps
+// up to date, and is dropped if the console goes away.
+class ConsoleUpstream : public std::enable_shared_from_this<ConsoleUpstream>
+{
+  public:
+    ConsoleUpstream(boost::asio::io_context& ioc, std::string_view pathIn) :
+        hostSocket(ioc), path(pathIn)
+    {}
+
+    ~ConsoleUpstream() = default;
+
+    ConsoleUpstream(const ConsoleUpstream&) = delete;
+    ConsoleUpstream(ConsoleUpstream&&) = delete;
+    ConsoleUpstream& operator=(const ConsoleUpstream&) = delete;
+    ConsoleUpstream& operator=(ConsoleUpstream&&) = delete;
+
+    bool connect(int fd)
+    {
+        boost::system::error_code ec;
+        boost::asio::local::stream_protocol proto;
+
+        hostSocket.assign(proto, fd, ec);
+
+        if (ec)
+        {
+            BMCWEB_LOG_ERROR(
+                "Failed to assign the DBUS socket Socket assign error: {}",
+                ec.message());
+            return false;
+        }
+
+        connected = true;
+        for (const std::weak_ptr<ConsoleHandler>& weak : viewers)
+        {
+            std::shared_ptr<ConsoleHandler> viewer = weak.lock();
+            if (viewer != nullptr)
+            {
+                viewer->start();
+            }
+        }
+        doWrite();
+        doRead();
+        return true;
+    }
+
+    void attach(const std::shared_ptr<ConsoleHandler>& viewer)
+    {
+        viewers.emplace_back(viewer);
+        if (!connected)
+        {
+            // Started once the console connects
+            return;
+        }
+        if (!scrollback.empty())
+        {
+            // Scrollback may wrap around, so copy it out in order
+            std::string recent(scrollback.begin(), scrollback.end());
+            viewer->queue(recent);
+        }
+        viewer->start();
+    }
+
+    void detach(const ConsoleHandler* viewer)
+    {
+        std::erase_if(viewers,
+                      [viewer](const std::weak_ptr<ConsoleHandler>& weak) {
+                          std::shared_ptr<ConsoleHandler> locked = weak.lock();
+                          return locked == nullptr || locked.get() == viewer;
+                      });
+    }
+
+    // Closes every viewer and forgets this console
+    void fail(std::string_view reason)
+    {
+        std::vector<std::weak_ptr<ConsoleHandler>> toClose;
+        toClose.swap(viewers);
+        for (const std::weak_ptr<ConsoleHandler>& weak : toClose)
+        {
+            std::shared_ptr<ConsoleHandler> viewer = weak.lock();
+            if (viewer != nullptr)
+            {
+                viewer->conn.close(reason);
+            }
+        }
+        auto it = getConsoleUpstreamMap().find(path);
+        if (it != getConsoleUpstreamMap().end() && it->second.get() == this)
+        {
+            getConsoleUpstreamMap().erase(it);
+        }
+    }
+
+    void write(std::string_view data)
+    {
+        inputBuffer += data;
+        doWrite();
+    }
+
+  private:
     void doWrite()
     {
         if (doingWrite)
@@ -59,7 +232,7 @@ class ConsoleHandler : public std::enable_shared_from_this<ConsoleHandler>
             return;
         }
 
-        if (inputBuffer.empty())
+        if (inputBuffer.empty() || !connected)
         {
             BMCWEB_LOG_DEBUG("Outbuffer empty.  Bailing out");
             return;
@@ -70,7 +243,7 @@ class ConsoleHandler : public std::enable_shared_from_this<ConsoleHandler>
             boost::asio::buffer(inputBuffer.data(), inputBuffer.size()),
             [weak(weak_from_this())](const boost::beast::error_code& ec,
                                      std::size_t bytesWritten) {
-                std::shared_ptr<ConsoleHandler> self = weak.lock();
+                std::shared_ptr<ConsoleUpstream> self = weak.lock();
                 if (self == nullptr)
                 {
                     return;
@@ -81,7 +254,7 @@ class ConsoleHandler : public std::enable_shared_from_this<ConsoleHandler>
 
                 if (ec == boost::asio::error::eof)
                 {
-                    self->conn.close("Error in reading to host port");
+                    self->fail("Error in reading to host port");
                     return;
                 }
                 if (ec)
@@ -94,25 +267,15 @@ class ConsoleHandler : public std::enable_shared_from_this<ConsoleHandler>
             });
     }
 
-    static void afterSendEx(const std::weak_ptr<ConsoleHandler>& weak)
-    {
-        std::shared_ptr<ConsoleHandler> self = weak.lock();
-        if (self == nullptr)
-        {
-            return;
-        }
-        self->doRead();
-    }
-
     void doRead()
     {
         BMCWEB_LOG_DEBUG("Reading from socket");
         hostSocket.async_read_some(
             boost::asio::buffer(outputBuffer),
-            [this, weakSelf(weak_from_this())](
-                const boost::system::error_code& ec, std::size_t bytesRead) {
+            [weak(weak_from_this())](const boost::system::error_code& ec,
+                                     std::size_t bytesRead) {
                 BMCWEB_LOG_DEBUG("read done.  Read {} bytes", bytesRead);
-                std::shared_ptr<ConsoleHandler> self = weakSelf.lock();
+                std::shared_ptr<ConsoleUpstream> self = weak.lock();
                 if (self == nullptr)
                 {
                     return;
@@ -121,44 +284,36 @@ class ConsoleHandler : public std::enable_shared_from_this<ConsoleHandler>
                 {
                     BMCWEB_LOG_ERROR("Couldn't read from host serial port: {}",
                                      ec.message());
-                    conn.close("Error connecting to host port");
+                    self->fail("Error connecting to host port");
                     return;
                 }
-                std::string_view payload(outputBuffer.data(), bytesRead);
-                self->conn.sendEx(
-                    crow::websocket::MessageType::Binary, payload,
-                    std::bind_front(afterSendEx, weak_from_this()));
+                std::string_view payload(self->outputBuffer.data(), bytesRead);
+                self->scrollback.insert(self->scrollback.end(), payload.begin(),
+                                        payload.end());
+                for (const std::weak_ptr<ConsoleHandler>& weakViewer :
+                     self->viewers)
+                {
+                    std::shared_ptr<ConsoleHandler> viewer = weakViewer.lock();
+                    if (viewer != nullptr)
+                    {
+                        viewer->queue(payload);
+                    }
+                }
+                self->doRead();
             });
     }
 
-    bool connect(int fd)
-    {
-        boost::system::error_code ec;
-        boost::asio::local::stream_protocol proto;
-
-        hostSocket.assign(proto, fd, ec);
-
-        if (ec)
-        {
-            BMCWEB_LOG_ERROR(
-                "Failed to assign the DBUS socket Socket assign error: {}",
-                ec.message());
-            return false;
-        }
-
-        conn.resumeRead();
-        doWrite();
-        doRead();
-        return true;
-    }
-
     boost::asio::local::stream_protocol::socket hostSocket;
+    std::string path;
+    bool connected = false;
 
     std::array<char, 4096> outputBuffer{};
+    boost::circular_buffer<char> scrollback{scrollbackSize};
 
     std::string inputBuffer;
     bool doingWrite = false;
-    crow::websocket::Connection& conn;
+
+    std::vector<std::weak_ptr<ConsoleHandler>> viewers;
 };
 
 using ObmcConsoleMap = boost::container::flat_map<
@@ -172,8 +327,18 @@ inline ObmcConsoleMap& getConsoleHandlerMap()
     return map;
 }
 
-// Remove connection from the connection map and if connection map is empty
-// then remove the handler from handlers map.
+inline std::shared_ptr<ConsoleUpstream> findUpstream(std::string_view path)
+{
+    auto it = getConsoleUpstreamMap().find(path);
+    if (it == getConsoleUpstreamMap().end())
+    {
+        return nullptr;
+    }
+    return it->second;
+}
+
+// Remove connection from the connection map and detach it from its console.
+// The console connection itself is kept for the next viewer.
 inline void onClose(crow::websocket::Connection& conn, const std::string& err)
 {
     BMCWEB_LOG_INFO("Closing websocket. Reason: {}", err);
@@ -186,28 +351,32 @@ inline void onClose(crow::websocket::Connection& conn, const std::string& err)
     }
     BMCWEB_LOG_DEBUG("Remove connection {} from obmc console", logPtr(&conn));
 
-    // Removed last connection so remove the path
+    std::shared_ptr<ConsoleUpstream> upstream =
+        findUpstream(iter->second->consolePath);
+    if (upstream != nullptr)
+    {
+        upstream->detach(iter->second.get());
+    }
     getConsoleHandlerMap().erase(iter);
 }
 
-inline void connectConsoleSocket(crow::websocket::Connection& conn,
+inline void connectConsoleSocket(const std::string& consolePath,
                                  const boost::system::error_code& ec,
                                  const sdbusplus::message::unix_fd& unixfd)
 {
-    if (ec)
+    std::shared_ptr<ConsoleUpstream> upstream = findUpstream(consolePath);
+    if (upstream == nullptr)
     {
-        BMCWEB_LOG_ERROR(
-            "Failed to call console Connect() method DBUS error: {}",
-            ec.message());
-        conn.close("Failed to connect");
+        BMCWEB_LOG_ERROR("Console was already closed");
         return;
     }
 
-    // Look up the handler
-    auto iter = getConsoleHandlerMap().find(&conn);
-    if (iter == getConsoleHandlerMap().end())
+    if (ec)
     {
-        BMCWEB_LOG_ERROR("Connection was already closed");
+        BMCWEB_LOG_ERROR(
+            "Failed to call console Connect() method DBUS error: {}",
+            ec.message());
+        upstream->fail("Failed to connect");
         return;
     }
 
@@ -215,29 +384,27 @@ inline void connectConsoleSocket(crow::websocket::Connection& conn,
     if (fd == -1)
     {
         BMCWEB_LOG_ERROR("Failed to dup the DBUS unixfd error");
-        conn.close("Internal error");
+        upstream->fail("Internal error");
         return;
     }
 
     BMCWEB_LOG_DEBUG("Console duped FD: {}", fd);
 
-    if (!iter->second->connect(fd))
+    if (!upstream->connect(fd))
     {
         close(fd);
-        conn.close("Internal Error");
+        upstream->fail("Internal Error");
     }
 }
 
 inline void processConsoleObject(
-    crow::websocket::Connection& conn, const std::string& consoleObjPath,
-    const boost::system::error_code& ec,
+    const std::string& consoleObjPath, const boost::system::error_code& ec,
     const ::dbus::utility::MapperGetObject& objInfo)
 {
-    // Look up the handler
-    auto iter = getConsoleHandlerMap().find(&conn);
-    if (iter == getConsoleHandlerMap().end())
+    std::shared_ptr<ConsoleUpstream> upstream = findUpstream(consoleObjPath);
+    if (upstream == nullptr)
     {
-        BMCWEB_LOG_ERROR("Connection was already closed");
+        BMCWEB_LOG_ERROR("Console was already closed");
         return;
     }
 
@@ -245,7 +412,7 @@ inline void processConsoleObject(
     {
         BMCWEB_LOG_WARNING("getDbusObject() for consoles failed. DBUS error:{}",
                            ec.message());
-        conn.close("getDbusObject() for consoles failed.");
+        upstream->fail("getDbusObject() for consoles failed.");
         return;
     }
 
@@ -254,7 +421,7 @@ inline void processConsoleObject(
     {
         BMCWEB_LOG_WARNING("getDbusObject() returned unexpected size: {}",
                            objInfo.size());
-        conn.close("getDbusObject() returned unexpected size");
+        upstream->fail("getDbusObject() returned unexpected size");
         return;
     }
 
@@ -263,9 +430,9 @@ inline void processConsoleObject(
                      consoleObjPath);
     // Call Connect() method to get the unix FD
     dbus::utility::async_method_call(
-        [&conn](const boost::system::error_code& ec1,
-                const sdbusplus::message::unix_fd& unixfd) {
-            connectConsoleSocket(conn, ec1, unixfd);
+        [consoleObjPath](const boost::system::error_code& ec1,
+                         const sdbusplus::message::unix_fd& unixfd) {
+            connectConsoleSocket(consoleObjPath, ec1, unixfd);
         },
         consoleService, consoleObjPath, "xyz.openbmc_project.Console.Access",
         "Connect");
@@ -286,7 +453,7 @@ inline void onOpen(crow::websocket::Connection& conn)
     }
 
     std::shared_ptr<ConsoleHandler> handler =
-        std::make_shared<ConsoleHandler>(getIoContext(), conn);
+        std::make_shared<ConsoleHandler>(conn);
     getConsoleHandlerMap().emplace(&conn, handler);
 
     conn.deferRead();
@@ -305,19 +472,31 @@ inline void onOpen(crow::websocket::Connection& conn)
     std::string consolePath =
         sdbusplus::message::object_path("/xyz/openbmc_project/console") /
         consoleLeaf;
+    handler->consolePath = consolePath;
 
     BMCWEB_LOG_DEBUG("Console Object path = {} Request target = {}",
                      consolePath, conn.url().path());
 
+    std::shared_ptr<ConsoleUpstream> upstream = findUpstream(consolePath);
+    if (upstream != nullptr)
+    {
+        BMCWEB_LOG_DEBUG("Attaching to open console {}", consolePath);
+        upstream->attach(handler);
+        return;
+    }
+    upstream = std::make_shared<ConsoleUpstream>(getIoContext(), consolePath);
+    getConsoleUpstreamMap().emplace(consolePath, upstream);
+    upstream->attach(handler);
+
     // mapper call lambda
     constexpr std::array<std::string_view, 1> interfaces = {
         "xyz.openbmc_project.Console.Access"};
 
     dbus::utility::getDbusObject(
         consolePath, interfaces,
-        [&conn, consolePath](const boost::system::error_code& ec,
-                             const ::dbus::utility::MapperGetObject& objInfo) {
-            processConsoleObject(conn, consolePath, ec, objInfo);
+        [consolePath](const boost::system::error_code& ec,
+                      const ::dbus::utility::MapperGetObject& objInfo) {
+            processConsoleObject(consolePath, ec, objInfo);
         });
 }
 
@@ -330,8 +509,13 @@ inline void onMessage(crow::websocket::Connection& conn,
         BMCWEB_LOG_CRITICAL("Unable to find connection {}", logPtr(&conn));
         return;
     }
-    handler->second->inputBuffer += data;
-    handler->second->doWrite();
+    std::shared_ptr<ConsoleUpstream> upstream =
+        findUpstream(handler->second->consolePath);
+    if (upstream == nullptr)
+    {
+        return;
+    }
+    upstream->write(data);
 }
 
 inline void requestRoutes(App& app)
@@ -0,0 +1,256 @@
+// SPDX-License-Identifier: Apache-2.0
+// SPDX-FileCopyrightText: Copyright OpenBMC Authors
+#pragma once
+
+#include "io_context_singleton.hpp"
+#include "logging.hpp"
+#include "pam_authenticate.hpp"
+
+#include <security/_pam_types.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+
+#include <boost/asio/buffer.hpp>
+#include <boost/asio/error.hpp>
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/posix/stream_descriptor.hpp>
+#include <boost/asio/post.hpp>
+#include <boost/system/error_code.hpp>
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <stop_token>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace bmcweb
+{
+
+// PAM modules (password hashing, pam_faillock, remote directories) can block
+// for a long time, and bmcweb serves every connection from one event loop.
+// PAM conversations are therefore run on a small pool of worker threads.  The
+// workers never touch asio objects; finished jobs are handed back through an
+// eventfd that the event loop reads, so callbacks always run on the event loop.
+class PamWorkerPool
+{
+  public:
+    using Callback = std::function<void(int pamrc)>;
+    using Authenticator = std::function<int(
+        std::string_view, std::string_view, std::optional<std::string>)>;
+
+    PamWorkerPool(boost::asio::io_context& ioc, size_t workerCount,
+                  size_t maxPendingIn,
+                  Authenticator authenticatorIn = pamAuthenticateUser) :
+        wake(ioc), maxPending(maxPendingIn),
+        authenticator(std::move(authenticatorIn))
+    {
+        int fd = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+        if (fd < 0)
+        {
+            BMCWEB_LOG_CRITICAL(
+                "Failed to create PAM eventfd, authenticating inline");
+            return;
+        }
+        wakeFd = fd;
+        wake.assign(fd);
+        waitForResults();
+        workers.reserve(workerCount);
+        for (size_t i = 0; i < workerCount; i++)
+        {
+            workers.emplace_back(
+                std::bind_front(&PamWorkerPool::workerLoop, this));
+        }
+    }
+
+    PamWorkerPool(const PamWorkerPool&) = delete;
+    PamWorkerPool(PamWorkerPool&&) = delete;
+    PamWorkerPool& operator=(const PamWorkerPool&) = delete;
+    PamWorkerPool& operator=(PamWorkerPool&&) = delete;
+
+    ~PamWorkerPool()
+    {
+        for (std::jthread& worker : workers)
+        {
+            worker.request_stop();
+        }
+        workers.clear();
+    }
+
+    // Queue an authentication.  The callback is always invoked from the event
+    // loop, never from within this call.  When too many requests are already
+    // waiting, the request is failed with PAM_MAXTRIES rather than queued.
+    void authenticate(std::string_view username, std::string_view password,
+                      std::optional<std::string> token, Callback&& callback)
+    {
+        if (workers.empty())
+        {
+            int pamrc = authenticator(username, password, std::move(token));
+            boost::asio::post(wake.get_executor(),
+                              [callback = std::move(callback), pamrc]() {
+                                  callback(pamrc);
+                              });
+            return;
+        }
+
+        size_t depth = 0;
+        {
+            std::scoped_lock lock(mutex);
+            depth = pending.size() + running;
+            if (pending.size() < maxPending)
+            {
+                pending.emplace_back(std::string(username),
+                                     std::string(password), std::move(token),
+                                     std::move(callback), PAM_SYSTEM_ERR);
+                depth++;
+                peakDepth = std::max(peakDepth, depth);
+                callback = nullptr;
+            }
+        }
+        if (callback)
+        {
+            BMCWEB_LOG_WARNING(
+                "PAM queue full with {} requests, rejecting login for {}",
+                depth, username);
+            boost::asio::post(wake.get_executor(),
+                              [callback = std::move(callback)]() {
+                                  callback(PAM_MAXTRIES);
+                              });
+            return;
+        }
+        BMCWEB_LOG_DEBUG("PAM queue depth {}", depth);
+        jobAvailable.notify_one();
+    }
+
+    // Requests queued or being authenticated right now
+    size_t queueDepth() const
+    {
+        std::scoped_lock lock(mutex);
+        return pending.size() + running;
+    }
+
+    // Highest queueDepth() seen since startup
+    size_t peakQueueDepth() const
+    {
+        std::scoped_lock lock(mutex);
+        return peakDepth;
+    }
+
+  private:
+    struct Job
+    {
+        std::string username;
+        std::string password;
+        std::optional<std::string> token;
+        Callback callback;
+        int pamrc = PAM_SYSTEM_ERR;
+    };
+
+    void workerLoop(const std::stop_token& stop)
+    {
+        while (true)
+        {
+            Job job;
+            {
+                std::unique_lock lock(mutex);
+                if (!jobAvailable.wait(lock, stop,
+                                       [this]() { return !pending.empty(); }))
+                {
+                    return;
+                }
+                job = std::move(pending.front());
+                pending.pop_front();
+                running++;
+            }
+
+            job.pamrc =
+                authenticator(job.username, job.password, std::move(job.token));
+            std::fill(job.password.begin(), job.password.end(), '\0');
+            job.password.clear();
+
+            {
+                std::scoped_lock lock(mutex);
+                running--;
+                finished.emplace_back(std::move(job));
+            }
+            uint64_t one = 1;
+            // A failed write can only mean the counter is saturated, in which
+            // case the event loop is already due to wake up.
+            [[maybe_unused]] ssize_t written = write(wakeFd, &one, sizeof(one));
+        }
+    }
+
+    void waitForResults()
+    {
+        wake.async_read_some(boost::asio::buffer(&wakeCount, sizeof(wakeCount)),
+                             std::bind_front(&PamWorkerPool::onWake, this));
+    }
+
+    void onWake(const boost::system::error_code& ec, size_t /*bytesRead*/)
+    {
+        if (ec == boost::asio::error::operation_aborted)
+        {
+            return;
+        }
+        if (ec)
+        {
+            BMCWEB_LOG_ERROR("Failed to read PAM eventfd {}", ec.message());
+        }
+        std::deque<Job> done;
+        {
+            std::scoped_lock lock(mutex);
+            done.swap(finished);
+        }
+        for (Job& job : done)
+        {
+            job.callback(job.pamrc);
+        }
+        waitForResults();
+    }
+
+    // Only touched from the event loop
+    boost::asio::posix::stream_descriptor wake;
+    uint64_t wakeCount = 0;
+    int wakeFd = -1;
+
+    const size_t maxPending;
+    const Authenticator authenticator;
+
+    mutable std::mutex mutex;
+    std::condition_variable_any jobAvailable;
+    std::deque<Job> pending;
+    std::deque<Job> finished;
+    size_t running = 0;
+    size_t peakDepth = 0;
+
+    // Declared last so the threads are joined before anything they use is
+    // destroyed
+    std::vector<std::jthread> workers;
+};
+
+inline PamWorkerPool& getPamWorkerPool()
+{
+    static PamWorkerPool pool(getIoContext(), 2, 32);
+    return pool;
+}
+
+// Asynchronous version of pamAuthenticateUser.  The callback runs on the event
+// loop once PAM has finished.
+inline void pamAuthenticateUserAsync(std::string_view username,
+                                     std::string_view password,
+                                     std::optional<std::string> token,
+                                     PamWorkerPool::Callback&& callback)
+{
+    getPamWorkerPool().authenticate(username, password, std::move(token),
+                                    std::move(callback));
+}
+
+} // namespace bmcweb
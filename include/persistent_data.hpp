@@ -3,30 +3,40 @@
 #pragma once
 
 #include "event_service_store.hpp"
+#include "io_context_singleton.hpp"
 #include "logging.hpp"
 #include "ossl_random.hpp"
+#include "persistent_journal.hpp"
 #include "sessions.hpp"
 // NOLINTNEXTLINE(misc-include-cleaner)
 #include "utility.hpp"
 
-#include <boost/beast/core/file_base.hpp>
-#include <boost/beast/core/file_posix.hpp>
+#include <boost/asio/steady_timer.hpp>
 #include <boost/beast/http/fields.hpp>
+#include <boost/system/error_code.hpp>
 #include <nlohmann/json.hpp>
 
 #include <chrono>
+#include <cstddef>
 #include <cstdint>
 #include <filesystem>
 #include <fstream>
+#include <functional>
 #include <memory>
 #include <optional>
 #include <string>
 #include <system_error>
 #include <utility>
+#include <vector>
 
 namespace persistent_data
 {
 
+// How long session changes are batched before the journal is written
+constexpr std::chrono::seconds journalFlushDelay{1};
+// Journal length at which it is folded into a fresh snapshot
+constexpr size_t journalCompactEntries = 256;
+
 class ConfigFile
 {
     uint64_t jsonRevision = 1;
@@ -34,17 +44,23 @@ class ConfigFile
   public:
     // todo(ed) should read this from a fixed location somewhere, not CWD
     static constexpr const char* filename = "bmcweb_persistent_data.json";
+    static constexpr const char* journalFilename =
+        "bmcweb_persistent_data.json.journal";
 
-    ConfigFile()
+    ConfigFile() : journal(journalFilename), flushTimer(getIoContext())
     {
         readData();
+        SessionStore::getInstance().onPersistentSessionChange =
+            std::bind_front(&ConfigFile::journalSession, this);
     }
 
     ~ConfigFile()
     {
+        SessionStore::getInstance().onPersistentSessionChange = nullptr;
         // Make sure we aren't writing stale sessions
         persistent_data::SessionStore::getInstance().applySessionTimeouts();
-        if (persistent_data::SessionStore::getInstance().needsWrite())
+        if (persistent_data::SessionStore::getInstance().needsWrite() ||
+            journal.hasPending())
         {
             writeData();
         }
@@ -141,8 +157,8 @@ class ConfigFile
                                              newSession->csrfToken,
                                              newSession->uniqueId,
                                              newSession->sessionToken);
-                            SessionStore::getInstance().authTokens.emplace(
-                                newSession->sessionToken, newSession);
+                            SessionStore::getInstance().addSession(
+                                newSession);
                         }
                     }
                     else if (item.first == "timeout")
@@ -219,7 +235,7 @@ class ConfigFile
                 }
             }
         }
-        bool needWrite = false;
+        bool needWrite = replayJournal();
 
         if (systemUuid.empty())
         {
@@ -237,6 +253,85 @@ class ConfigFile
         }
     }
 
+    // Applies session changes journaled since the last snapshot.  Returns
+    // true if there were any, in which case a new snapshot should be written.
+    bool replayJournal()
+    {
+        std::vector<nlohmann::json::object_t> entries = journal.read();
+        SessionStore& store = SessionStore::getInstance();
+        for (const nlohmann::json::object_t& entry : entries)
+        {
+            auto op = entry.find("op");
+            auto session = entry.find("session");
+            if (op == entry.end() || session == entry.end())
+            {
+                continue;
+            }
+            const nlohmann::json::object_t* sessionObj =
+                session->second.get_ptr<const nlohmann::json::object_t*>();
+            if (sessionObj == nullptr)
+            {
+                continue;
+            }
+            std::shared_ptr<UserSession> newSession =
+                UserSession::fromJson(*sessionObj);
+            if (newSession == nullptr)
+            {
+                continue;
+            }
+            if (op->second == "add")
+            {
+                store.addSession(newSession);
+            }
+            else if (op->second == "remove")
+            {
+                std::shared_ptr<UserSession> old =
+                    store.getSessionByUid(newSession->uniqueId);
+                if (old != nullptr)
+                {
+                    store.removeSession(old);
+                }
+            }
+        }
+        return !entries.empty();
+    }
+
+    // Records a session change in the journal.  Writes are batched for
+    // journalFlushDelay, and the journal is folded into a new snapshot once it
+    // grows long enough.
+    void journalSession(const UserSession& session, bool added)
+    {
+        nlohmann::json::object_t entry;
+        entry["op"] = added ? "add" : "remove";
+        entry["session"] = session.toJson();
+        journal.append(entry);
+
+        if (journal.size() >= journalCompactEntries)
+        {
+            compactPending = true;
+        }
+        if (flushPending)
+        {
+            // Already scheduled
+            return;
+        }
+        flushPending = true;
+        flushTimer.expires_after(journalFlushDelay);
+        flushTimer.async_wait([this](const boost::system::error_code& ec) {
+            if (ec)
+            {
+                return;
+            }
+            flushPending = false;
+            if (compactPending)
+            {
+                writeData();
+                return;
+            }
+            journal.flush();
+        });
+    }
+
     void writeData()
     {
         std::filesystem::path path(filename);
@@ -252,28 +347,6 @@ class ConfigFile
                 return;
             }
         }
-        boost::beast::file_posix persistentFile;
-        boost::system::error_code ec;
-        persistentFile.open(filename, boost::beast::file_mode::write, ec);
-        if (ec)
-        {
-            BMCWEB_LOG_CRITICAL("Unable to store persistent data to file {}",
-                                ec.message());
-            return;
-        }
-
-        // set the permission of the file to 640
-        std::filesystem::perms permission =
-            std::filesystem::perms::owner_read |
-            std::filesystem::perms::owner_write |
-            std::filesystem::perms::group_read;
-        std::filesystem::permissions(filename, permission, ec);
-        if (ec)
-        {
-            BMCWEB_LOG_CRITICAL("Failed to set filesystem permissions {}",
-                                ec.message());
-            return;
-        }
         const AuthConfigMethods& c =
             SessionStore::getInstance().getAuthMethodsConfig();
         const auto& eventServiceConfig =
@@ -305,22 +378,9 @@ class ConfigFile
         sessions = nlohmann::json::array();
         for (const auto& p : SessionStore::getInstance().authTokens)
         {
-            if (p.second->sessionType != persistent_data::SessionType::Basic &&
-                p.second->sessionType !=
-                    persistent_data::SessionType::MutualTLS)
+            if (p.second->isPersistent())
             {
-                nlohmann::json::object_t session;
-                session["unique_id"] = p.second->uniqueId;
-                session["session_token"] = p.second->sessionToken;
-                session["username"] = p.second->username;
-                session["csrf_token"] = p.second->csrfToken;
-                session["client_ip"] = p.second->clientIp;
-                const std::optional<std::string>& clientId = p.second->clientId;
-                if (clientId)
-                {
-                    session["client_id"] = *clientId;
-                }
-                sessions.emplace_back(std::move(session));
+                sessions.emplace_back(p.second->toJson());
             }
         }
         nlohmann::json& subscriptions = data["subscriptions"];
@@ -375,14 +435,26 @@ class ConfigFile
         }
         std::string out = nlohmann::json(data).dump(
             -1, ' ', true, nlohmann::json::error_handler_t::replace);
-        persistentFile.write(out.data(), out.size(), ec);
-        if (ec)
+        if (!writeFileAtomic(filename, out))
         {
-            BMCWEB_LOG_ERROR("Failed to write file {}", ec.message());
+            // Keep the journal so the sessions it holds aren't lost
+            journal.flush();
+            return;
         }
+        // The snapshot now holds everything the journal did
+        journal.clear();
+        compactPending = false;
+        flushPending = false;
+        flushTimer.cancel();
     }
 
     std::string systemUuid;
+
+  private:
+    PersistentJournal journal;
+    boost::asio::steady_timer flushTimer;
+    bool flushPending = false;
+    bool compactPending = false;
 };
 
 inline ConfigFile& getConfig()
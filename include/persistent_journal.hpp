@@ -0,0 +1,265 @@
+// SPDX-License-Identifier: Apache-2.0
+// SPDX-FileCopyrightText: Copyright OpenBMC Authors
+#pragma once
+
+#include "logging.hpp"
+
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <boost/beast/core/file_base.hpp>
+#include <boost/beast/core/file_posix.hpp>
+#include <boost/system/error_code.hpp>
+#include <nlohmann/json.hpp>
+
+#include <cerrno>
+#include <cstddef>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+namespace persistent_data
+{
+
+// Persistent files are readable by the owner and group only
+constexpr std::filesystem::perms persistentFilePermissions =
+    std::filesystem::perms::owner_read | std::filesystem::perms::owner_write |
+    std::filesystem::perms::group_read;
+
+// Makes a rename or removal in a directory survive a power loss
+inline bool syncDirectory(const std::filesystem::path& directory)
+{
+    int fd = open(directory.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+    if (fd < 0)
+    {
+        BMCWEB_LOG_ERROR("Unable to open directory {}", directory.string());
+        return false;
+    }
+    bool synced = fsync(fd) == 0;
+    close(fd);
+    if (!synced)
+    {
+        BMCWEB_LOG_ERROR("Failed to sync directory {}", directory.string());
+    }
+    return synced;
+}
+
+// Replaces the contents of a file such that a crash at any point leaves either
+// the old or the new contents behind, never a mix of the two.
+inline bool writeFileAtomic(const std::filesystem::path& filename,
+                            std::string_view contents)
+{
+    std::filesystem::path tmpName = filename;
+    tmpName += ".tmp";
+
+    boost::beast::file_posix file;
+    boost::system::error_code ec;
+    file.open(tmpName.c_str(), boost::beast::file_mode::write, ec);
+    if (ec)
+    {
+        BMCWEB_LOG_CRITICAL("Unable to open {} {}", tmpName.string(),
+                            ec.message());
+        return false;
+    }
+    auto fail = [&file, &tmpName]() {
+        boost::system::error_code closeEc;
+        file.close(closeEc);
+        std::error_code removeEc;
+        std::filesystem::remove(tmpName, removeEc);
+        return false;
+    };
+    std::error_code permEc;
+    std::filesystem::permissions(tmpName, persistentFilePermissions, permEc);
+    if (permEc)
+    {
+        BMCWEB_LOG_CRITICAL("Failed to set filesystem permissions {}",
+                            permEc.message());
+        return fail();
+    }
+    file.write(contents.data(), contents.size(), ec);
+    if (ec)
+    {
+        BMCWEB_LOG_ERROR("Failed to write file {}", ec.message());
+        return fail();
+    }
+    if (fsync(file.native_handle()) != 0)
+    {
+        BMCWEB_LOG_ERROR("Failed to sync {}", tmpName.string());
+        return fail();
+    }
+    file.close(ec);
+
+    std::error_code renameEc;
+    std::filesystem::rename(tmpName, filename, renameEc);
+    if (renameEc)
+    {
+        BMCWEB_LOG_ERROR("Failed to replace {} {}", filename.string(),
+                         renameEc.message());
+        return fail();
+    }
+    // Until the directory is synced the rename itself can be lost, so
+    // callers mustn't drop anything the old contents depended on before then
+    std::filesystem::path directory = filename.parent_path();
+    if (directory.empty())
+    {
+        directory = ".";
+    }
+    return syncDirectory(directory);
+}
+
+// Append-only log of changes made since the last full snapshot.  Each entry
+// is one line of JSON.  Entries are buffered and written out in batches by
+// flush(), so bursts of changes cost one write and one sync.
+class PersistentJournal
+{
+  public:
+    explicit PersistentJournal(std::filesystem::path filenameIn) :
+        filename(std::move(filenameIn))
+    {}
+
+    void append(const nlohmann::json::object_t& entry)
+    {
+        pending += nlohmann::json(entry).dump(
+            -1, ' ', true, nlohmann::json::error_handler_t::replace);
+        pending += '\n';
+        pendingEntries++;
+    }
+
+    bool hasPending() const
+    {
+        return pendingEntries != 0;
+    }
+
+    // Entries written to disk plus those waiting to be written
+    size_t size() const
+    {
+        return entriesOnDisk + pendingEntries;
+    }
+
+    void flush()
+    {
+        if (pending.empty())
+        {
+            return;
+        }
+        // A crash mid-write can leave a torn final line.  New entries start
+        // on a line of their own so they aren't joined to it.
+        bool startLine = !endsWithNewline();
+        // Opened directly rather than through beast, whose append mode
+        // truncates the file on some Boost versions
+        int fd =
+            open(filename.c_str(), O_WRONLY | O_CREAT | O_APPEND | O_CLOEXEC,
+                 S_IRUSR | S_IWUSR | S_IRGRP);
+        if (fd < 0)
+        {
+            BMCWEB_LOG_CRITICAL("Unable to open journal {}", filename.string());
+            return;
+        }
+        std::error_code permEc;
+        std::filesystem::permissions(filename, persistentFilePermissions,
+                                     permEc);
+        off_t oldSize = lseek(fd, 0, SEEK_END);
+        bool written = oldSize >= 0 && (!startLine || writeAll(fd, "\n")) &&
+                       writeAll(fd, pending);
+        if (!written)
+        {
+            BMCWEB_LOG_ERROR("Failed to write journal {}", filename.string());
+            // Drop the partial write so the retry doesn't follow a torn line
+            if (oldSize >= 0 && ftruncate(fd, oldSize) != 0)
+            {
+                BMCWEB_LOG_ERROR("Failed to truncate journal");
+            }
+            close(fd);
+            return;
+        }
+        if (fdatasync(fd) != 0)
+        {
+            BMCWEB_LOG_ERROR("Failed to sync journal");
+        }
+        close(fd);
+        entriesOnDisk += pendingEntries;
+        pending.clear();
+        pendingEntries = 0;
+    }
+
+    // Reads back every complete entry.  A torn final line, left by a crash in
+    // the middle of a write, is ignored.
+    std::vector<nlohmann::json::object_t> read()
+    {
+        std::vector<nlohmann::json::object_t> entries;
+        std::ifstream journalFile(filename);
+        std::string line;
+        while (std::getline(journalFile, line))
+        {
+            nlohmann::json entry = nlohmann::json::parse(line, nullptr, false);
+            nlohmann::json::object_t* obj =
+                entry.get_ptr<nlohmann::json::object_t*>();
+            if (obj == nullptr)
+            {
+                BMCWEB_LOG_WARNING("Skipping unreadable journal entry");
+                continue;
+            }
+            entries.emplace_back(std::move(*obj));
+        }
+        entriesOnDisk = entries.size();
+        return entries;
+    }
+
+    // Called once a snapshot containing every entry has been written
+    void clear()
+    {
+        pending.clear();
+        pendingEntries = 0;
+        entriesOnDisk = 0;
+        std::error_code ec;
+        std::filesystem::remove(filename, ec);
+        if (ec)
+        {
+            BMCWEB_LOG_ERROR("Failed to remove journal {}", ec.message());
+        }
+    }
+
+  private:
+    static bool writeAll(int fd, std::string_view data)
+    {
+        while (!data.empty())
+        {
+            ssize_t written = write(fd, data.data(), data.size());
+            if (written < 0)
+            {
+                if (errno == EINTR)
+                {
+                    continue;
+                }
+                return false;
+            }
+            data.remove_prefix(static_cast<size_t>(written));
+        }
+        return true;
+    }
+
+    // True for a missing or empty journal too
+    bool endsWithNewline() const
+    {
+        std::ifstream journalFile(filename, std::ios::binary);
+        if (!journalFile.seekg(-1, std::ios::end))
+        {
+            return true;
+        }
+        char last = '\n';
+        journalFile.get(last);
+        return last == '\n';
+    }
+
+    std::filesystem::path filename;
+    std::string pending;
+    size_t pendingEntries = 0;
+    size_t entriesOnDisk = 0;
+};
+
+} // namespace persistent_data
@@ -18,6 +18,7 @@
 #include <functional>
 #include <memory>
 #include <optional>
+#include <queue>
 #include <string>
 #include <string_view>
 #include <unordered_map>
@@ -60,8 +61,25 @@ struct UserSession
     //  2. D-Bus User.Manager.GetUserInfo property UserPasswordExpired.
     // These should be in sync, but the underlying condition can change at any
     // time.  For example, a password can expire or be changed outside of
-    // bmcweb.  The value stored here is updated at the start of each
-    // operation and used as the truth within bmcweb.
+    // bmcweb.  The value stored here is refreshed from D-Bus whenever
+    // userInfoValid is false and used as the truth within bmcweb.
+
+    // Whether userRole, userGroups and isConfigureSelfOnly hold the result of
+    // GetUserInfo.  Cleared when the user's D-Bus properties or password
+    // change, so the next request fetches them again.
+    bool userInfoValid = false;
+    std::chrono::time_point<std::chrono::steady_clock> userInfoValidatedAt;
+
+    // A password ages into expiry, or is changed outside of bmcweb, without
+    // any signal, so a cached result is only trusted for this long
+    static constexpr std::chrono::seconds userInfoTtl{60};
+
+    bool isUserInfoCurrent() const
+    {
+        return userInfoValid &&
+               std::chrono::steady_clock::now() - userInfoValidatedAt <
+                   userInfoTtl;
+    }
 
     /**
      * @brief Fills object with data from UserSession's JSON representation
@@ -145,6 +163,29 @@ struct UserSession
 
         return userSession;
     }
+
+    nlohmann::json::object_t toJson() const
+    {
+        nlohmann::json::object_t session;
+        session["unique_id"] = uniqueId;
+        session["session_token"] = sessionToken;
+        session["username"] = username;
+        session["csrf_token"] = csrfToken;
+        session["client_ip"] = clientIp;
+        if (clientId)
+        {
+            session["client_id"] = *clientId;
+        }
+        return session;
+    }
+
+    // Basic and MutualTLS sessions only live as long as the request or
+    // connection that created them, so they are never written to disk
+    bool isPersistent() const
+    {
+        return sessionType != SessionType::Basic &&
+               sessionType != SessionType::MutualTLS;
+    }
 };
 
 enum class MTLSCommonNameParseMode
@@ -291,12 +332,30 @@ class SessionStore
             false,
             isConfigureSelfOnly,
             "",
-            {}});
-        auto it = authTokens.emplace(sessionToken, session);
+            {},
+            false,
+            std::chrono::steady_clock::time_point{}});
+        addSession(session);
         // Only need to write to disk if session isn't about to be destroyed.
-        needWrite = sessionType != SessionType::Basic &&
-                    sessionType != SessionType::MutualTLS;
-        return it.first->second;
+        needWrite = session->isPersistent();
+        if (needWrite && onPersistentSessionChange)
+        {
+            onPersistentSessionChange(*session, true);
+        }
+        return session;
+    }
+
+    // Inserts an already constructed session, for example one restored from
+    // the persistent store
+    void addSession(const std::shared_ptr<UserSession>& session)
+    {
+        auto it = authTokens.emplace(session->sessionToken, session);
+        if (!it.second)
+        {
+            return;
+        }
+        sessionsByUid.emplace(session->uniqueId, session);
+        expiryQueue.emplace(session->lastUpdated, session->uniqueId);
     }
 
     std::shared_ptr<UserSession> loginSessionByToken(std::string_view token)
@@ -319,22 +378,21 @@ class SessionStore
     std::shared_ptr<UserSession> getSessionByUid(std::string_view uid)
     {
         applySessionTimeouts();
-        // TODO(Ed) this is inefficient
-        auto sessionIt = authTokens.begin();
-        while (sessionIt != authTokens.end())
+        auto sessionIt = sessionsByUid.find(std::string(uid));
+        if (sessionIt == sessionsByUid.end())
         {
-            if (sessionIt->second->uniqueId == uid)
-            {
-                return sessionIt->second;
-            }
-            sessionIt++;
+            return nullptr;
         }
-        return nullptr;
+        return sessionIt->second;
     }
 
     void removeSession(const std::shared_ptr<UserSession>& session)
     {
-        authTokens.erase(session->sessionToken);
+        auto sessionIt = authTokens.find(session->sessionToken);
+        if (sessionIt != authTokens.end())
+        {
+            eraseSession(sessionIt);
+        }
         needWrite = true;
     }
 
@@ -342,10 +400,10 @@ class SessionStore
     {
         applySessionTimeouts();
         std::vector<std::string> ret;
-        ret.reserve(authTokens.size());
-        for (auto& session : authTokens)
+        ret.reserve(sessionsByUid.size());
+        for (const auto& session : sessionsByUid)
         {
-            ret.push_back(session.second->uniqueId);
+            ret.push_back(session.first);
         }
         return ret;
     }
@@ -379,33 +437,51 @@ class SessionStore
 
     void removeSessionsByUsername(std::string_view username)
     {
-        std::erase_if(authTokens, [username](const auto& value) {
-            if (value.second == nullptr)
+        for (auto it = authTokens.begin(); it != authTokens.end();)
+        {
+            if (it->second != nullptr && it->second->username == username)
             {
-                return false;
+                it = eraseSession(it);
+                continue;
             }
-            return value.second->username == username;
-        });
+            it++;
+        }
     }
 
     void removeSessionsByUsernameExceptSession(
         std::string_view username, const std::shared_ptr<UserSession>& session)
     {
-        std::erase_if(authTokens, [username, session](const auto& value) {
-            if (value.second == nullptr)
+        for (auto it = authTokens.begin(); it != authTokens.end();)
+        {
+            if (it->second != nullptr && it->second->username == username &&
+                it->second->uniqueId != session->uniqueId)
             {
-                return false;
+                it = eraseSession(it);
+                continue;
             }
+            it++;
+        }
+    }
 
-            return value.second->username == username &&
-                   value.second->uniqueId != session->uniqueId;
-        });
+    // Makes the next request on any of the user's sessions re-read its role,
+    // groups and password state from the user manager
+    void invalidateUserInfo(std::string_view username)
+    {
+        for (auto& session : authTokens)
+        {
+            if (session.second != nullptr &&
+                session.second->username == username)
+            {
+                session.second->userInfoValid = false;
+            }
+        }
     }
 
     void updateAuthMethodsConfig(const AuthConfigMethods& config)
     {
         bool isTLSchanged = (authMethodsConfig.tls != config.tls);
         authMethodsConfig = config;
+        authMethodsGeneration++;
         needWrite = true;
         if (isTLSchanged)
         {
@@ -420,6 +496,13 @@ class SessionStore
         return authMethodsConfig;
     }
 
+    // Changes every time updateAuthMethodsConfig() is called, so anything
+    // derived from the configuration can tell when it is stale
+    size_t getAuthMethodsGeneration() const
+    {
+        return authMethodsGeneration;
+    }
+
     bool needsWrite() const
     {
         return needWrite;
@@ -441,27 +524,36 @@ class SessionStore
         return sessionStore;
     }
 
+    // Expires idle sessions.  Only sessions whose last recorded activity is
+    // older than the timeout are looked at, so this is cheap enough to call
+    // on every request.  Sessions that were used since they were queued are
+    // queued again with their new activity time.
     void applySessionTimeouts()
     {
         auto timeNow = std::chrono::steady_clock::now();
-        if (timeNow - lastTimeoutUpdate > std::chrono::seconds(1))
+        while (!expiryQueue.empty() &&
+               timeNow - expiryQueue.top().lastUpdated >= timeoutInSeconds)
         {
-            lastTimeoutUpdate = timeNow;
-            auto authTokensIt = authTokens.begin();
-            while (authTokensIt != authTokens.end())
+            auto uidIt = sessionsByUid.find(expiryQueue.top().uniqueId);
+            expiryQueue.pop();
+            if (uidIt == sessionsByUid.end())
             {
-                if (timeNow - authTokensIt->second->lastUpdated >=
-                    timeoutInSeconds)
-                {
-                    authTokensIt = authTokens.erase(authTokensIt);
-
-                    needWrite = true;
-                }
-                else
-                {
-                    authTokensIt++;
-                }
+                continue;
+            }
+            std::shared_ptr<UserSession> session = uidIt->second;
+            auto sessionIt = authTokens.find(session->sessionToken);
+            if (sessionIt == authTokens.end() || sessionIt->second != session)
+            {
+                // Already removed
+                continue;
+            }
+            if (timeNow - session->lastUpdated < timeoutInSeconds)
+            {
+                expiryQueue.emplace(session->lastUpdated, session->uniqueId);
+                continue;
             }
+            eraseSession(sessionIt);
+            needWrite = true;
         }
     }
 
@@ -471,17 +563,81 @@ class SessionStore
     SessionStore& operator=(const SessionStore&&) = delete;
     ~SessionStore() = default;
 
+    // Sessions keyed by token.  Use addSession() and removeSession() to modify
+    // it so that the indexes below stay in sync.
     std::unordered_map<std::string, std::shared_ptr<UserSession>,
                        std::hash<std::string>, bmcweb::ConstantTimeCompare>
         authTokens;
 
-    std::chrono::time_point<std::chrono::steady_clock> lastTimeoutUpdate;
     bool needWrite{false};
     std::chrono::seconds timeoutInSeconds;
     AuthConfigMethods authMethodsConfig;
 
+    // Notified when a session that is kept on disk is created (true) or
+    // removed (false), so the change can be journaled
+    std::function<void(const UserSession&, bool)> onPersistentSessionChange;
+
   private:
+    struct ExpiryEntry
+    {
+        std::chrono::time_point<std::chrono::steady_clock> lastUpdated;
+        // Looked up in sessionsByUid, so that a queued entry doesn't keep a
+        // removed session's allocation alive
+        std::string uniqueId;
+
+        bool operator>(const ExpiryEntry& other) const
+        {
+            return lastUpdated > other.lastUpdated;
+        }
+    };
+
     SessionStore() : timeoutInSeconds(1800) {}
+
+    size_t authMethodsGeneration = 0;
+
+    using TokenIterator = decltype(authTokens)::iterator;
+
+    TokenIterator eraseSession(TokenIterator sessionIt)
+    {
+        const UserSession& session = *sessionIt->second;
+        if (session.isPersistent() && onPersistentSessionChange)
+        {
+            onPersistentSessionChange(session, false);
+        }
+        sessionsByUid.erase(session.uniqueId);
+        TokenIterator next = authTokens.erase(sessionIt);
+        compactExpiryQueue();
+        return next;
+    }
+
+    // A removed session's entry stays queued until it reaches the front,
+    // which can take as long as the timeout.  Once stale entries outnumber
+    // live sessions the queue is rebuilt from the live sessions, so it stays
+    // proportional to the number of sessions rather than the login rate.
+    void compactExpiryQueue()
+    {
+        if (expiryQueue.size() <= 2 * authTokens.size())
+        {
+            return;
+        }
+        std::vector<ExpiryEntry> live;
+        live.reserve(authTokens.size());
+        for (const auto& [token, session] : authTokens)
+        {
+            live.emplace_back(session->lastUpdated, session->uniqueId);
+        }
+        expiryQueue = decltype(expiryQueue)(std::greater<>(), std::move(live));
+    }
+
+    std::unordered_map<std::string, std::shared_ptr<UserSession>>
+        sessionsByUid;
+
+    // Oldest activity first.  Entries hold the activity time seen when they
+    // were queued, and are only re-checked against the session once that time
+    // is older than the timeout.
+    std::priority_queue<ExpiryEntry, std::vector<ExpiryEntry>,
+                        std::greater<>>
+        expiryQueue;
 };
 
 } // namespace persistent_data
@@ -1,7 +1,9 @@
 // SPDX-License-Identifier: Apache-2.0
 // SPDX-FileCopyrightText: Copyright OpenBMC Authors
 #pragma once
+#include "basic_auth_cache.hpp"
 #include "dbus_singleton.hpp"
+#include "logging.hpp"
 #include "sessions.hpp"
 
 #include <sdbusplus/bus/match.hpp>
@@ -18,10 +20,25 @@ inline void onUserRemoved(sdbusplus::message_t& msg)
     sdbusplus::message::object_path p;
     msg.read(p);
     std::string username = p.filename();
+    BasicAuthCache::getInstance().invalidate(username);
     persistent_data::SessionStore::getInstance().removeSessionsByUsername(
         username);
 }
 
+inline void onUserPropertiesChanged(sdbusplus::message_t& msg)
+{
+    sdbusplus::message::object_path p(msg.get_path());
+    std::string username = p.filename();
+    if (username.empty())
+    {
+        return;
+    }
+    BMCWEB_LOG_DEBUG("User {} changed, refreshing cached credentials",
+                     username);
+    BasicAuthCache::getInstance().invalidate(username);
+    persistent_data::SessionStore::getInstance().invalidateUserInfo(username);
+}
+
 inline void registerUserRemovedSignal()
 {
     std::string userRemovedMatchStr =
@@ -31,4 +48,15 @@ inline void registerUserRemovedSignal()
     static sdbusplus::bus::match_t userRemovedMatch(
         *crow::connections::systemBus, userRemovedMatchStr, onUserRemoved);
 }
+
+inline void registerUserPropertiesChangedSignal()
+{
+    std::string userChangedMatchStr =
+        sdbusplus::bus::match::rules::propertiesChangedNamespace(
+            "/xyz/openbmc_project/user", "xyz.openbmc_project.User.Attributes");
+
+    static sdbusplus::bus::match_t userChangedMatch(
+        *crow::connections::systemBus, userChangedMatchStr,
+        onUserPropertiesChanged);
+}
 } // namespace bmcweb
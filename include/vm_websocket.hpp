@@ -8,6 +8,7 @@
 #include "dbus_utility.hpp"
 #include "io_context_singleton.hpp"
 #include "logging.hpp"
+#include "nbd_send_ring.hpp"
 #include "websocket.hpp"
 
 #include <boost/asio/buffer.hpp>
@@ -15,10 +16,9 @@
 #include <boost/asio/io_context.hpp>
 #include <boost/asio/local/stream_protocol.hpp>
 #include <boost/asio/readable_pipe.hpp>
+#include <boost/asio/write.hpp>
 #include <boost/asio/writable_pipe.hpp>
-#include <boost/beast/core/buffers_to_string.hpp>
 #include <boost/beast/core/error.hpp>
-#include <boost/beast/core/flat_static_buffer.hpp>
 #include <boost/container/flat_map.hpp>
 #include <boost/process/v2/process.hpp>
 #include <boost/process/v2/stdio.hpp>
@@ -32,6 +32,7 @@
 #include <format>
 #include <functional>
 #include <memory>
+#include <optional>
 #include <string>
 #include <string_view>
 #include <system_error>
@@ -46,11 +47,6 @@ namespace obmc_vm
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
 static crow::websocket::Connection* session = nullptr;
 
-// The max network block device buffer size is 128kb plus 16bytes
-// for the message header:
-// https://github.com/NetworkBlockDevice/nbd/blob/master/doc/proto.md#simple-reply-message
-static constexpr auto nbdBufferSize = (128 * 1024 + 16) * 4;
-
 class Handler : public std::enable_shared_from_this<Handler>
 {
   public:
@@ -95,32 +91,18 @@ class Handler : public std::enable_shared_from_this<Handler>
             }
             return;
         }
-        doWrite();
         doRead();
     }
 
-    void doWrite()
+    // The websocket keeps the message alive and stops reading until onDone
+    // is called, so it is written to the proxy straight from there
+    void write(std::string_view data, std::function<void()>&& onDone)
     {
-        if (doingWrite)
-        {
-            BMCWEB_LOG_DEBUG("Already writing.  Bailing out");
-            return;
-        }
-
-        if (inputBuffer.size() == 0)
-        {
-            BMCWEB_LOG_DEBUG("inputBuffer empty.  Bailing out");
-            return;
-        }
-
-        doingWrite = true;
-        pipeIn.async_write_some(
-            inputBuffer.data(),
-            [this, self(shared_from_this())](const boost::beast::error_code& ec,
-                                             std::size_t bytesWritten) {
+        boost::asio::async_write(
+            pipeIn, boost::asio::buffer(data),
+            [this, self(shared_from_this()), onDone(std::move(onDone))](
+                const boost::beast::error_code& ec, std::size_t bytesWritten) {
                 BMCWEB_LOG_DEBUG("Wrote {}bytes", bytesWritten);
-                doingWrite = false;
-                inputBuffer.consume(bytesWritten);
 
                 if (session == nullptr)
                 {
@@ -137,16 +119,18 @@ class Handler : public std::enable_shared_from_this<Handler>
                     BMCWEB_LOG_ERROR("Error in VM socket write {}", ec);
                     return;
                 }
-                doWrite();
+                onDone();
             });
     }
 
     void doRead()
     {
-        std::size_t bytes = outputBuffer.capacity() - outputBuffer.size();
-
+        if (!ring.canRead())
+        {
+            return;
+        }
         pipeOut.async_read_some(
-            outputBuffer.prepare(bytes),
+            ring.prepareRead(),
             [this, self(shared_from_this())](
                 const boost::system::error_code& ec, std::size_t bytesRead) {
                 BMCWEB_LOG_DEBUG("Read done.  Read {} bytes", bytesRead);
@@ -164,24 +148,38 @@ class Handler : public std::enable_shared_from_this<Handler>
                     return;
                 }
 
-                outputBuffer.commit(bytesRead);
-                std::string_view payload(
-                    static_cast<const char*>(outputBuffer.data().data()),
-                    bytesRead);
-                session->sendBinary(payload);
-                outputBuffer.consume(bytesRead);
-
+                ring.commitRead(bytesRead);
+                doSend();
                 doRead();
             });
     }
 
+    void doSend()
+    {
+        if (session == nullptr)
+        {
+            return;
+        }
+        std::optional<std::string_view> payload = ring.startSend();
+        if (!payload)
+        {
+            return;
+        }
+        // The write reads from the ring, so the handler stays alive until it
+        // completes
+        session->sendEx(crow::websocket::MessageType::Binary, *payload,
+                        [self(shared_from_this())]() {
+                            self->ring.finishSend();
+                            self->doSend();
+                            self->doRead();
+                        });
+    }
+
     boost::asio::readable_pipe pipeOut;
     boost::asio::writable_pipe pipeIn;
     boost::process::v2::process proxy;
-    bool doingWrite{false};
 
-    boost::beast::flat_static_buffer<nbdBufferSize> outputBuffer;
-    boost::beast::flat_static_buffer<nbdBufferSize> inputBuffer;
+    NbdSendRing ring;
 };
 
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
@@ -193,11 +191,6 @@ namespace nbd_proxy
 {
 using boost::asio::local::stream_protocol;
 
-// The max network block device buffer size is 128kb plus 16bytes
-// for the message header:
-// https://github.com/NetworkBlockDevice/nbd/blob/master/doc/proto.md#simple-reply-message
-static constexpr auto nbdBufferSize = (128 * 1024 + 16) * 4;
-
 struct NbdProxyServer : std::enable_shared_from_this<NbdProxyServer>
 {
     NbdProxyServer(crow::websocket::Connection& connIn,
@@ -298,26 +291,25 @@ struct NbdProxyServer : std::enable_shared_from_this<NbdProxyServer>
             "xyz.openbmc_project.VirtualMedia.Proxy", "Mount");
     }
 
+    // The websocket keeps the message alive and stops reading until onDone
+    // is called, so it is written to the UNIX socket straight from there
     void send(std::string_view buffer, std::function<void()>&& onDone)
     {
-        size_t copied = boost::asio::buffer_copy(
-            ws2uxBuf.prepare(buffer.size()), boost::asio::buffer(buffer));
-        ws2uxBuf.commit(copied);
-
-        doWrite(std::move(onDone));
-    }
-
-  private:
-    static void afterSendEx(const std::weak_ptr<NbdProxyServer>& weak)
-    {
-        std::shared_ptr<NbdProxyServer> self2 = weak.lock();
-        if (self2 != nullptr)
+        if (uxWriteInProgress)
         {
-            self2->ux2wsBuf.consume(self2->ux2wsBuf.size());
-            self2->doRead();
+            BMCWEB_LOG_ERROR("Write in progress");
+            onDone();
+            return;
         }
+
+        uxWriteInProgress = true;
+        boost::asio::async_write(
+            peerSocket, boost::asio::buffer(buffer),
+            std::bind_front(&NbdProxyServer::afterWrite, weak_from_this(),
+                            std::move(onDone)));
     }
 
+  private:
     void afterRead(const std::weak_ptr<NbdProxyServer>& weak,
                    const boost::system::error_code& ec, size_t bytesRead)
     {
@@ -333,26 +325,44 @@ struct NbdProxyServer : std::enable_shared_from_this<NbdProxyServer>
             return;
         }
 
-        // Send to websocket
-        self->ux2wsBuf.commit(bytesRead);
-        self->connection.sendEx(
-            crow::websocket::MessageType::Binary,
-            boost::beast::buffers_to_string(self->ux2wsBuf.data()),
-            std::bind_front(&NbdProxyServer::afterSendEx, weak_from_this()));
+        ring.commitRead(bytesRead);
+        doSend();
+        doRead();
     }
 
     void doRead()
     {
+        if (!ring.canRead())
+        {
+            return;
+        }
         // Trigger async read
-        peerSocket.async_read_some(ux2wsBuf.prepare(nbdBufferSize),
+        peerSocket.async_read_some(ring.prepareRead(),
                                    std::bind_front(&NbdProxyServer::afterRead,
                                                    this, weak_from_this()));
     }
 
+    void doSend()
+    {
+        std::optional<std::string_view> payload = ring.startSend();
+        if (!payload)
+        {
+            return;
+        }
+        // The write reads from the ring, so the proxy stays alive until it
+        // completes
+        connection.sendEx(crow::websocket::MessageType::Binary, *payload,
+                          [self(shared_from_this())]() {
+                              self->ring.finishSend();
+                              self->doSend();
+                              self->doRead();
+                          });
+    }
+
     static void afterWrite(const std::weak_ptr<NbdProxyServer>& weak,
                            std::function<void()>&& onDone,
                            const boost::system::error_code& ec,
-                           size_t bytesWritten)
+                           size_t /*bytesWritten*/)
     {
         std::shared_ptr<NbdProxyServer> self = weak.lock();
         if (self == nullptr)
@@ -360,7 +370,6 @@ struct NbdProxyServer : std::enable_shared_from_this<NbdProxyServer>
             return;
         }
 
-        self->ws2uxBuf.consume(bytesWritten);
         self->uxWriteInProgress = false;
 
         if (ec)
@@ -369,37 +378,9 @@ struct NbdProxyServer : std::enable_shared_from_this<NbdProxyServer>
             self->connection.close("Internal error");
             return;
         }
-
-        // Retrigger doWrite if there is something in buffer
-        if (self->ws2uxBuf.size() > 0)
-        {
-            self->doWrite(std::move(onDone));
-            return;
-        }
         onDone();
     }
 
-    void doWrite(std::function<void()>&& onDone)
-    {
-        if (uxWriteInProgress)
-        {
-            BMCWEB_LOG_ERROR("Write in progress");
-            return;
-        }
-
-        if (ws2uxBuf.size() == 0)
-        {
-            BMCWEB_LOG_ERROR("No data to write to UNIX socket");
-            return;
-        }
-
-        uxWriteInProgress = true;
-        peerSocket.async_write_some(
-            ws2uxBuf.data(),
-            std::bind_front(&NbdProxyServer::afterWrite, weak_from_this(),
-                            std::move(onDone)));
-    }
-
     // Keeps UNIX socket endpoint file path
     const std::string socketId;
     const std::string endpointId;
@@ -407,11 +388,8 @@ struct NbdProxyServer : std::enable_shared_from_this<NbdProxyServer>
 
     bool uxWriteInProgress = false;
 
-    // UNIX => WebSocket buffer
-    boost::beast::flat_static_buffer<nbdBufferSize> ux2wsBuf;
-
-    // WebSocket => UNIX buffer
-    boost::beast::flat_static_buffer<nbdBufferSize> ws2uxBuf;
+    // UNIX => WebSocket buffers
+    NbdSendRing ring;
 
     // The socket used to communicate with the client.
     stream_protocol::socket peerSocket;
@@ -597,26 +575,18 @@ inline void requestRoutes(App& app)
 
                 session = nullptr;
                 handler->doClose();
-                handler->inputBuffer.clear();
-                handler->outputBuffer.clear();
                 handler.reset();
             })
-            .onmessage([](crow::websocket::Connection& conn,
-                          const std::string& data, bool) {
-                if (data.length() > handler->inputBuffer.capacity() -
-                                        handler->inputBuffer.size())
+            .onmessageex([](crow::websocket::Connection& conn,
+                            std::string_view data,
+                            crow::websocket::MessageType /*type*/,
+                            std::function<void()>&& whenComplete) {
+                if (&conn != session || handler == nullptr)
                 {
-                    BMCWEB_LOG_ERROR("Buffer overrun when writing {} bytes",
-                                     data.length());
-                    conn.close("Buffer overrun");
+                    whenComplete();
                     return;
                 }
-
-                size_t copied = boost::asio::buffer_copy(
-                    handler->inputBuffer.prepare(data.size()),
-                    boost::asio::buffer(data));
-                handler->inputBuffer.commit(copied);
-                handler->doWrite();
+                handler->write(data, std::move(whenComplete));
             });
     }
 }
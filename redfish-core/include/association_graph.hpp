@@ -0,0 +1,358 @@
+// SPDX-License-Identifier: Apache-2.0
+// SPDX-FileCopyrightText: Copyright OpenBMC Authors
+#pragma once
+
+#include "dbus_singleton.hpp"
+#include "dbus_utility.hpp"
+#include "logging.hpp"
+
+#include <boost/system/error_code.hpp>
+#include <sdbusplus/bus/match.hpp>
+#include <sdbusplus/exception.hpp>
+#include <sdbusplus/message.hpp>
+#include <sdbusplus/message/native_types.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <variant>
+#include <vector>
+
+namespace redfish
+{
+
+constexpr std::string_view associationInterface =
+    "xyz.openbmc_project.Association";
+
+// Association endpoints published by the ObjectMapper, keyed by association
+// path, for example <sensor>/inventory -> [<inventory item>] and
+// <inventory item>/leds -> [<led group>].  Only the associations the sensor
+// code follows are kept, not the whole association database.
+class AssociationGraph
+{
+  public:
+    static constexpr std::array<std::string_view, 2> trackedAssociations = {
+        "inventory", "leds"};
+
+    static bool isTracked(std::string_view path)
+    {
+        size_t pos = path.rfind('/');
+        if (pos == std::string_view::npos)
+        {
+            return false;
+        }
+        return std::ranges::find(trackedAssociations, path.substr(pos + 1)) !=
+               trackedAssociations.end();
+    }
+
+    // Returns the endpoints property from an object's interfaces, or nullptr
+    // if the object isn't an association
+    static const std::vector<std::string>* findEndpoints(
+        const dbus::utility::DBusInterfacesMap& interfaces)
+    {
+        for (const auto& [interface, properties] : interfaces)
+        {
+            if (interface == associationInterface)
+            {
+                return findEndpoints(properties);
+            }
+        }
+        return nullptr;
+    }
+
+    static const std::vector<std::string>* findEndpoints(
+        const dbus::utility::DBusPropertiesMap& properties)
+    {
+        for (const auto& [name, value] : properties)
+        {
+            if (name == "endpoints")
+            {
+                return std::get_if<std::vector<std::string>>(&value);
+            }
+        }
+        return nullptr;
+    }
+
+    // Replaces the graph with the associations in a GetManagedObjects reply
+    void load(const dbus::utility::ManagedObjectType& objects)
+    {
+        edges.clear();
+        for (const auto& [path, interfaces] : objects)
+        {
+            const std::vector<std::string>* endpoints =
+                findEndpoints(interfaces);
+            if (endpoints != nullptr)
+            {
+                setEndpoints(path.str, *endpoints);
+            }
+        }
+    }
+
+    // An empty list of endpoints removes the association
+    void setEndpoints(const std::string& path,
+                      const std::vector<std::string>& endpoints)
+    {
+        if (!isTracked(path))
+        {
+            return;
+        }
+        if (endpoints.empty())
+        {
+            edges.erase(path);
+            return;
+        }
+        edges[path] = endpoints;
+    }
+
+    // Returns the endpoints of an association, or nullptr if it has none
+    const std::vector<std::string>* getEndpoints(const std::string& path) const
+    {
+        auto it = edges.find(path);
+        if (it == edges.end())
+        {
+            return nullptr;
+        }
+        return &it->second;
+    }
+
+    size_t size() const
+    {
+        return edges.size();
+    }
+
+  private:
+    std::unordered_map<std::string, std::vector<std::string>> edges;
+};
+
+// Keeps an AssociationGraph current from ObjectMapper signals.  The graph is
+// loaded with one GetManagedObjects the first time it is needed, and after
+// that requests are served from memory until the mapper restarts.
+class MapperAssociations
+{
+  public:
+    using Handler = std::function<void(const boost::system::error_code&,
+                                       const AssociationGraph&)>;
+
+    MapperAssociations() = default;
+    ~MapperAssociations() = default;
+    MapperAssociations(const MapperAssociations&) = delete;
+    MapperAssociations(MapperAssociations&&) = delete;
+    MapperAssociations& operator=(const MapperAssociations&) = delete;
+    MapperAssociations& operator=(MapperAssociations&&) = delete;
+
+    static MapperAssociations& getInstance()
+    {
+        static MapperAssociations instance;
+        return instance;
+    }
+
+    // Calls the handler with the graph, loading it first if needed
+    void getGraph(Handler&& handler)
+    {
+        if (loaded)
+        {
+            handler(boost::system::error_code(), graph);
+            return;
+        }
+        waiting.emplace_back(std::move(handler));
+        if (querying)
+        {
+            return;
+        }
+        watch();
+        query();
+    }
+
+  private:
+    static constexpr std::string_view mapperService =
+        "xyz.openbmc_project.ObjectMapper";
+
+    void watch()
+    {
+        if (addedMatch != nullptr)
+        {
+            return;
+        }
+        namespace rules = sdbusplus::bus::match::rules;
+        std::string sender = rules::sender(std::string(mapperService));
+        addedMatch = std::make_unique<sdbusplus::bus::match_t>(
+            *crow::connections::systemBus, rules::interfacesAdded() + sender,
+            onInterfacesAdded);
+        removedMatch = std::make_unique<sdbusplus::bus::match_t>(
+            *crow::connections::systemBus, rules::interfacesRemoved() + sender,
+            onInterfacesRemoved);
+        changedMatch = std::make_unique<sdbusplus::bus::match_t>(
+            *crow::connections::systemBus,
+            rules::type::signal() + rules::member("PropertiesChanged") +
+                rules::interface("org.freedesktop.DBus.Properties") +
+                rules::argN(0, std::string(associationInterface)) + sender,
+            onPropertiesChanged);
+        // Signals sent while the mapper was down were missed, so a restarted
+        // mapper means loading the graph again
+        ownerMatch = std::make_unique<sdbusplus::bus::match_t>(
+            *crow::connections::systemBus,
+            rules::nameOwnerChanged(std::string(mapperService)),
+            [](sdbusplus::message_t&) { getInstance().invalidate(); });
+    }
+
+    void invalidate()
+    {
+        BMCWEB_LOG_DEBUG("ObjectMapper owner changed, dropping associations");
+        loaded = false;
+        if (querying)
+        {
+            // The reply in flight may come from the old mapper
+            staleQuery = true;
+        }
+    }
+
+    void query()
+    {
+        BMCWEB_LOG_DEBUG("Loading mapper associations");
+        querying = true;
+        sdbusplus::message::object_path path("/");
+        dbus::utility::getManagedObjects(
+            std::string(mapperService), path,
+            [](const boost::system::error_code& ec,
+               const dbus::utility::ManagedObjectType& objects) {
+                getInstance().afterQuery(ec, objects);
+            });
+    }
+
+    void afterQuery(const boost::system::error_code& ec,
+                    const dbus::utility::ManagedObjectType& objects)
+    {
+        querying = false;
+        bool stale = staleQuery;
+        staleQuery = false;
+        if (ec)
+        {
+            BMCWEB_LOG_ERROR("Failed to load mapper associations {}", ec);
+            changesWhileLoading.clear();
+        }
+        else
+        {
+            graph.load(objects);
+            // Each change carries the full endpoint list, so replaying the
+            // ones that raced the query in order leaves the latest state
+            for (const auto& [path, endpoints] : changesWhileLoading)
+            {
+                graph.setEndpoints(path, endpoints);
+            }
+            changesWhileLoading.clear();
+            // Waiters still get this graph, but the next request reloads it
+            loaded = !stale;
+            BMCWEB_LOG_DEBUG("Loaded {} mapper associations", graph.size());
+        }
+        std::vector<Handler> handlers;
+        handlers.swap(waiting);
+        for (Handler& handler : handlers)
+        {
+            handler(ec, graph);
+        }
+    }
+
+    void apply(const std::string& path,
+               const std::vector<std::string>& endpoints)
+    {
+        if (!AssociationGraph::isTracked(path))
+        {
+            return;
+        }
+        if (loaded)
+        {
+            graph.setEndpoints(path, endpoints);
+            return;
+        }
+        if (querying)
+        {
+            changesWhileLoading.emplace_back(path, endpoints);
+        }
+    }
+
+    static void onInterfacesAdded(sdbusplus::message_t& msg)
+    {
+        sdbusplus::message::object_path path;
+        dbus::utility::DBusInterfacesMap interfaces;
+        try
+        {
+            msg.read(path, interfaces);
+        }
+        catch (const sdbusplus::exception_t& e)
+        {
+            BMCWEB_LOG_ERROR("Failed to read InterfacesAdded: {}", e.what());
+            return;
+        }
+        const std::vector<std::string>* endpoints =
+            AssociationGraph::findEndpoints(interfaces);
+        if (endpoints == nullptr)
+        {
+            return;
+        }
+        getInstance().apply(path.str, *endpoints);
+    }
+
+    static void onInterfacesRemoved(sdbusplus::message_t& msg)
+    {
+        sdbusplus::message::object_path path;
+        std::vector<std::string> interfaces;
+        try
+        {
+            msg.read(path, interfaces);
+        }
+        catch (const sdbusplus::exception_t& e)
+        {
+            BMCWEB_LOG_ERROR("Failed to read InterfacesRemoved: {}", e.what());
+            return;
+        }
+        if (std::ranges::find(interfaces, associationInterface) ==
+            interfaces.end())
+        {
+            return;
+        }
+        getInstance().apply(path.str, {});
+    }
+
+    static void onPropertiesChanged(sdbusplus::message_t& msg)
+    {
+        std::string interface;
+        dbus::utility::DBusPropertiesMap properties;
+        try
+        {
+            msg.read(interface, properties);
+        }
+        catch (const sdbusplus::exception_t& e)
+        {
+            BMCWEB_LOG_ERROR("Failed to read PropertiesChanged: {}", e.what());
+            return;
+        }
+        const std::vector<std::string>* endpoints =
+            AssociationGraph::findEndpoints(properties);
+        if (endpoints == nullptr)
+        {
+            return;
+        }
+        getInstance().apply(msg.get_path(), *endpoints);
+    }
+
+    AssociationGraph graph;
+    bool loaded = false;
+    bool querying = false;
+    bool staleQuery = false;
+    std::vector<Handler> waiting;
+    std::vector<std::pair<std::string, std::vector<std::string>>>
+        changesWhileLoading;
+
+    std::unique_ptr<sdbusplus::bus::match_t> addedMatch;
+    std::unique_ptr<sdbusplus::bus::match_t> removedMatch;
+    std::unique_ptr<sdbusplus::bus::match_t> changedMatch;
+    std::unique_ptr<sdbusplus::bus::match_t> ownerMatch;
+};
+
+} // namespace redfish
@@ -544,10 +544,11 @@ class EventServiceManager
             2, ' ', true, nlohmann::json::error_handler_t::replace);
 
         messages.push_back(Event(eventId, msg));
+        crow::sse_socket::SseEvent sseFrame;
         for (const auto& it : subscriptionsMap)
         {
             std::shared_ptr<Subscription> entry = it.second;
-            if (!entry->sendEventToSubscriber(eventId, std::string(strMsg)))
+            if (!entry->sendSharedEventToSubscriber(eventId, strMsg, sseFrame))
             {
                 return false;
             }
@@ -573,10 +574,16 @@ class EventServiceManager
         EventServiceManager& mgr = EventServiceManager::getInstance();
         mgr.eventId++;
 
+        if (mgr.subscriptionsMap.empty())
+        {
+            return;
+        }
+
+        SharedMetricReport report(reportId);
         for (const auto& it : mgr.subscriptionsMap)
         {
             Subscription& entry = *it.second;
-            entry.filterAndSendReports(mgr.eventId, reportId, var);
+            entry.filterAndSendReports(mgr.eventId, report, var);
         }
     }
 
@@ -599,6 +606,10 @@ class EventServiceManager
 
         messages.push_back(Event(eventId, eventMessage));
 
+        // The payload doesn't depend on the subscriber, so serialize it once
+        // on first match and share it with every other subscriber.
+        std::optional<std::string> strMsg;
+        crow::sse_socket::SseEvent sseFrame;
         for (auto& it : subscriptionsMap)
         {
             std::shared_ptr<Subscription>& entry = it.second;
@@ -609,19 +620,22 @@ class EventServiceManager
                 continue;
             }
 
-            nlohmann::json::array_t eventRecord;
-            eventRecord.emplace_back(eventMessage);
+            if (!strMsg)
+            {
+                nlohmann::json::array_t eventRecord;
+                eventRecord.emplace_back(eventMessage);
 
-            nlohmann::json msgJson;
+                nlohmann::json msgJson;
 
-            msgJson["@odata.type"] = "#Event.v1_4_0.Event";
-            msgJson["Name"] = "Event Log";
-            msgJson["Id"] = eventId;
-            msgJson["Events"] = std::move(eventRecord);
+                msgJson["@odata.type"] = "#Event.v1_4_0.Event";
+                msgJson["Name"] = "Event Log";
+                msgJson["Id"] = eventId;
+                msgJson["Events"] = std::move(eventRecord);
 
-            std::string strMsg = msgJson.dump(
-                2, ' ', true, nlohmann::json::error_handler_t::replace);
-            entry->sendEventToSubscriber(eventId, std::move(strMsg));
+                strMsg = msgJson.dump(2, ' ', true,
+                                      nlohmann::json::error_handler_t::replace);
+            }
+            entry->sendSharedEventToSubscriber(eventId, *strMsg, sseFrame);
         }
     }
 };
@@ -10,10 +10,12 @@
 #include <boost/container/flat_map.hpp>
 #include <boost/container/vector.hpp>
 
+#include <algorithm>
 #include <array>
 #include <bitset>
 #include <cstddef>
 #include <initializer_list>
+#include <span>
 #include <string>
 #include <string_view>
 #include <utility>
@@ -80,7 +82,7 @@ class Privileges
      * @param[in] privilegeList  List of privileges to be activated
      *
      */
-    Privileges(std::initializer_list<const char*> privilegeList)
+    constexpr Privileges(std::initializer_list<const char*> privilegeList)
     {
         for (const char* privilege : privilegeList)
         {
@@ -100,7 +102,7 @@ class Privileges
      * @return               None
      *
      */
-    bool setSinglePrivilege(std::string_view privilege)
+    constexpr bool setSinglePrivilege(std::string_view privilege)
     {
         for (size_t searchIndex = 0; searchIndex < privilegeNames.size();
              searchIndex++)
@@ -179,11 +181,44 @@ class Privileges
      * @return               None
      *
      */
-    bool isSupersetOf(const Privileges& p) const
+    constexpr bool isSupersetOf(const Privileges& p) const
     {
         return (privilegeBitset & p.privilegeBitset) == p.privilegeBitset;
     }
 
+    /**
+     * @brief Determines if this Privilege set shares any privilege with the
+     * given privilege set
+     *
+     * @param[in] p  Privilege set to check against
+     *
+     * @return       True if at least one privilege is in both sets
+     *
+     */
+    constexpr bool intersects(const Privileges& p) const
+    {
+        return (privilegeBitset & p.privilegeBitset).any();
+    }
+
+    /**
+     * @brief Adds every privilege of the given set to this set
+     *
+     * @param[in] p  Privilege set to add
+     *
+     */
+    constexpr void merge(const Privileges& p)
+    {
+        privilegeBitset |= p.privilegeBitset;
+    }
+
+    /**
+     * @brief Returns the number of privileges in the set
+     */
+    constexpr size_t count() const
+    {
+        return privilegeBitset.count();
+    }
+
     /**
      * @brief Returns the intersection of two Privilege sets.
      *
@@ -192,18 +227,27 @@ class Privileges
      * @return               The new Privilege set.
      *
      */
-    Privileges intersection(const Privileges& p) const
+    constexpr Privileges intersection(const Privileges& p) const
     {
         return Privileges{privilegeBitset & p.privilegeBitset};
     }
 
   private:
-    explicit Privileges(const std::bitset<maxPrivilegeCount>& p) :
+    constexpr explicit Privileges(const std::bitset<maxPrivilegeCount>& p) :
         privilegeBitset{p}
     {}
     std::bitset<maxPrivilegeCount> privilegeBitset = 0;
 };
 
+// Privileges granted by each user manager role
+constexpr Privileges adminPrivileges{"Login", "ConfigureManager",
+                                     "ConfigureSelf", "ConfigureUsers",
+                                     "ConfigureComponents"};
+constexpr Privileges operatorPrivileges{"Login", "ConfigureSelf",
+                                        "ConfigureComponents"};
+constexpr Privileges readOnlyPrivileges{"Login", "ConfigureSelf"};
+constexpr Privileges hostConsolePrivileges{"OpenBMCHostConsole"};
+
 inline Privileges getUserPrivileges(const persistent_data::UserSession& session)
 {
     // default to no access
@@ -215,7 +259,7 @@ inline Privileges getUserPrivileges(const persistent_data::UserSession& session)
         if (userGroup == "hostconsole")
         {
             // Redfish privilege : host console access
-            privs.setSinglePrivilege("OpenBMCHostConsole");
+            privs.merge(hostConsolePrivileges);
             break;
         }
     }
@@ -223,29 +267,75 @@ inline Privileges getUserPrivileges(const persistent_data::UserSession& session)
     if (session.userRole == "priv-admin")
     {
         // Redfish privilege : Administrator
-        privs.setSinglePrivilege("Login");
-        privs.setSinglePrivilege("ConfigureManager");
-        privs.setSinglePrivilege("ConfigureSelf");
-        privs.setSinglePrivilege("ConfigureUsers");
-        privs.setSinglePrivilege("ConfigureComponents");
+        privs.merge(adminPrivileges);
     }
     else if (session.userRole == "priv-operator")
     {
         // Redfish privilege : Operator
-        privs.setSinglePrivilege("Login");
-        privs.setSinglePrivilege("ConfigureSelf");
-        privs.setSinglePrivilege("ConfigureComponents");
+        privs.merge(operatorPrivileges);
     }
     else if (session.userRole == "priv-user")
     {
         // Redfish privilege : Readonly
-        privs.setSinglePrivilege("Login");
-        privs.setSinglePrivilege("ConfigureSelf");
+        privs.merge(readOnlyPrivileges);
     }
 
     return privs;
 }
 
+/**
+ * @brief Privileges required by a route, reduced to bit tests
+ *
+ * Requirements are an OR of privilege sets.  Nearly every set in the registry
+ * holds a single privilege; those alternatives collapse into one mask that
+ * only has to intersect the user's privileges.  Sets of several privileges
+ * are kept and checked individually.
+ */
+class CompiledPrivileges
+{
+  public:
+    CompiledPrivileges() = default;
+
+    explicit CompiledPrivileges(std::span<const Privileges> alternatives) :
+        noneRequired(alternatives.empty())
+    {
+        for (const Privileges& alternative : alternatives)
+        {
+            size_t count = alternative.count();
+            if (count == 0)
+            {
+                noneRequired = true;
+            }
+            else if (count == 1)
+            {
+                anyOf.merge(alternative);
+            }
+            else
+            {
+                allOf.push_back(alternative);
+            }
+        }
+    }
+
+    bool isAllowed(const Privileges& userPrivileges) const
+    {
+        if (noneRequired || userPrivileges.intersects(anyOf))
+        {
+            return true;
+        }
+        return std::ranges::any_of(allOf, [&userPrivileges](
+                                              const Privileges& required) {
+            return userPrivileges.isSupersetOf(required);
+        });
+    }
+
+  private:
+    // If there are no privileges assigned, there are no privileges required
+    bool noneRequired = true;
+    Privileges anyOf;
+    std::vector<Privileges> allOf;
+};
+
 /**
  * @brief The OperationMap represents the privileges required for a
  * single entity (URI).  It maps from the allowable verbs to the
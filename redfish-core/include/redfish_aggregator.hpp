@@ -2,8 +2,11 @@
 // SPDX-FileCopyrightText: Copyright OpenBMC Authors
 #pragma once
 
+#include "bmcweb_config.h"
+
 #include "aggregation_utils.hpp"
 #include "async_resp.hpp"
+#include "dbus_singleton.hpp"
 #include "dbus_utility.hpp"
 #include "error_messages.hpp"
 #include "http_client.hpp"
@@ -15,6 +18,9 @@
 #include "ssl_key_handler.hpp"
 #include "utility.hpp"
 
+#include <boost/asio/error.hpp>
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/steady_timer.hpp>
 #include <boost/beast/http/field.hpp>
 #include <boost/beast/http/status.hpp>
 #include <boost/beast/http/verb.hpp>
@@ -27,6 +33,8 @@
 #include <boost/url/url.hpp>
 #include <boost/url/url_view.hpp>
 #include <nlohmann/json.hpp>
+#include <sdbusplus/bus/match.hpp>
+#include <sdbusplus/message.hpp>
 #include <sdbusplus/message/native_types.hpp>
 
 #include <algorithm>
@@ -36,7 +44,9 @@
 #include <cstdint>
 #include <functional>
 #include <limits>
+#include <map>
 #include <memory>
+#include <optional>
 #include <ranges>
 #include <string>
 #include <string_view>
@@ -44,6 +54,7 @@
 #include <unordered_map>
 #include <utility>
 #include <variant>
+#include <vector>
 
 namespace redfish
 {
@@ -197,86 +208,76 @@ inline bool isPropertyUri(std::string_view propertyName)
                               propertyName);
 }
 
+// Adds the prefix to the member id that follows a top level collection, e.g.
+// /redfish/v1/Chassis/chassis becomes /redfish/v1/Chassis/<prefix>_chassis.
+// The string is edited in place with a single insert rather than being parsed
+// and rebuilt, as satellite responses can contain thousands of URIs.
 inline void addPrefixToStringItem(std::string& strValue,
                                   std::string_view prefix)
 {
-    // Make sure the value is a properly formatted URI
-    auto parsed = boost::urls::parse_relative_ref(strValue);
-    if (!parsed)
-    {
-        // Note that DMTF URIs such as
-        // https://redfish.dmtf.org/registries/Base.1.15.0.json will fail this
-        // check and that's okay
-        BMCWEB_LOG_DEBUG("Couldn't parse URI from resource {}", strValue);
+    constexpr std::string_view redfishRoot = "/redfish/v1";
+
+    // Only the path is considered, any query or fragment is left untouched
+    std::string_view path(strValue);
+    path = path.substr(0, path.find_first_of("?#"));
+
+    // The first two segments should be "/redfish/v1".  We need to check that
+    // before we can search topCollections.  Note that DMTF URIs such as
+    // https://redfish.dmtf.org/registries/Base.1.15.0.json will fail this
+    // check and that's okay
+    if (!path.starts_with(redfishRoot))
+    {
+        BMCWEB_LOG_DEBUG("Not a Redfish URI {}", strValue);
+        return;
+    }
+    std::string_view subPath = path.substr(redfishRoot.size());
+    if (!subPath.starts_with('/'))
+    {
         return;
     }
-
-    const boost::urls::url_view& thisUrl = *parsed;
 
     // We don't need to aggregate JsonSchemas due to potential issues such as
     // version mismatches between aggregator and satellite BMCs.  For now
     // assume that the aggregator has all the schemas and versions that the
     // aggregated server has.
-    if (crow::utility::readUrlSegments(thisUrl, "redfish", "v1", "JsonSchemas",
-                                       crow::utility::OrMorePaths()))
+    if (subPath == "/JsonSchemas" || subPath.starts_with("/JsonSchemas/"))
     {
         BMCWEB_LOG_DEBUG("Skipping JsonSchemas URI prefix fixing");
         return;
     }
 
-    // The first two segments should be "/redfish/v1".  We need to check that
-    // before we can search topCollections
-    if (!crow::utility::readUrlSegments(thisUrl, "redfish", "v1",
-                                        crow::utility::OrMorePaths()))
+    // Check each parent path in turn until a collection is identified, then
+    // add the prefix to the segment after the collection
+    size_t slash = 0;
+    while (true)
     {
-        return;
-    }
+        size_t segmentStart = slash + 1;
+        size_t nextSlash = subPath.find('/', segmentStart);
+        size_t segmentEnd =
+            nextSlash == std::string_view::npos ? subPath.size() : nextSlash;
 
-    // Check array adding a segment each time until collection is identified
-    // Add prefix to segment after the collection
-    const boost::urls::segments_view urlSegments = thisUrl.segments();
-    bool addedPrefix = false;
-    boost::urls::url url("/");
-    boost::urls::segments_view::const_iterator it = urlSegments.begin();
-    const boost::urls::segments_view::const_iterator end = urlSegments.end();
-
-    // Skip past the leading "/redfish/v1"
-    it++;
-    it++;
-    for (; it != end; it++)
-    {
         // Trailing "/" will result in an empty segment.  In that case we need
         // to return so we don't apply a prefix to top level collections such
         // as "/redfish/v1/Chassis/"
-        if ((*it).empty())
+        if (segmentStart == segmentEnd)
         {
             return;
         }
 
         if (std::binary_search(topCollections.begin(), topCollections.end(),
-                               url.buffer()))
+                               subPath.substr(0, slash)))
         {
             std::string collectionItem(prefix);
-            collectionItem += "_" + (*it);
-            url.segments().push_back(collectionItem);
-            it++;
-            addedPrefix = true;
-            break;
+            collectionItem += '_';
+            strValue.insert(redfishRoot.size() + segmentStart, collectionItem);
+            return;
         }
 
-        url.segments().push_back(*it);
-    }
-
-    // Finish constructing the URL here (if needed) to avoid additional checks
-    for (; it != end; it++)
-    {
-        url.segments().push_back(*it);
-    }
-
-    if (addedPrefix)
-    {
-        url.segments().insert(url.segments().begin(), {"redfish", "v1"});
-        strValue = url.buffer();
+        if (nextSlash == std::string_view::npos)
+        {
+            return;
+        }
+        slash = nextSlash;
     }
 }
 
@@ -292,7 +293,6 @@ inline void addPrefixToItem(nlohmann::json& item, std::string_view prefix)
         return;
     }
     addPrefixToStringItem(*strValue, prefix);
-    item = *strValue;
 }
 
 inline void addAggregatedHeaders(crow::Response& asyncResp,
@@ -413,10 +413,308 @@ inline crow::ConnectionPolicy getAggregationPolicy()
             .invalidResp = aggregationRetryHandler};
 }
 
+// Methods that may change the satellite resources.  HEAD and OPTIONS are
+// forwarded uncached but leave the cache alone.
+inline bool isModifyingMethod(boost::beast::http::verb method)
+{
+    return method == boost::beast::http::verb::post ||
+           method == boost::beast::http::verb::put ||
+           method == boost::beast::http::verb::patch ||
+           method == boost::beast::http::verb::delete_;
+}
+
+// Returns the part of the satellite tree that a write request to path may
+// have changed: the parent of the resource, so that the collection listing it
+// is included, and for an action the parent of the resource the action
+// belongs to
+inline std::string_view modifiedCollection(std::string_view path)
+{
+    size_t actions = path.find("/Actions/");
+    if (actions != std::string_view::npos)
+    {
+        path = path.substr(0, actions);
+    }
+    size_t slash = path.rfind('/');
+    if (slash != std::string_view::npos && slash > 0)
+    {
+        path = path.substr(0, slash);
+    }
+    return path;
+}
+
+// Satellite responses kept by the aggregator so that repeated GETs can be
+// revalidated with If-None-Match instead of transferring the full payload
+struct SatelliteCacheEntry
+{
+    std::string etag;
+    std::string contentType;
+    std::string allow;
+    std::string body;
+    std::chrono::steady_clock::time_point validatedAt;
+    // Orders entries for eviction.  Unlike validatedAt it is never equal
+    // between two entries.
+    uint64_t sequence = 0;
+
+    void toResponse(crow::Response& resp) const
+    {
+        resp.result(boost::beast::http::status::ok);
+        resp.write(std::string(body));
+        if (!contentType.empty())
+        {
+            resp.addHeader(boost::beast::http::field::content_type,
+                           contentType);
+        }
+        if (!allow.empty())
+        {
+            resp.addHeader(boost::beast::http::field::allow, allow);
+        }
+        resp.addHeader(boost::beast::http::field::etag, etag);
+    }
+};
+
+class SatelliteResponseCache
+{
+  public:
+    SatelliteResponseCache(std::chrono::seconds maxAgeIn,
+                           size_t maxEntriesIn) :
+        maxAge(maxAgeIn), maxEntries(maxEntriesIn)
+    {}
+
+    // The satellite authorizes a request from the credentials forwarded with
+    // it, so a response is only reused for the same user and role
+    static std::string makeKey(std::string_view url, std::string_view username,
+                               std::string_view role)
+    {
+        std::string key(url);
+        key += '\n';
+        key += username;
+        key += '\n';
+        key += role;
+        return key;
+    }
+
+    const SatelliteCacheEntry* find(const std::string& key) const
+    {
+        auto it = entries.find(key);
+        if (it == entries.end())
+        {
+            return nullptr;
+        }
+        return &it->second;
+    }
+
+    bool isFresh(const SatelliteCacheEntry& entry) const
+    {
+        return std::chrono::steady_clock::now() - entry.validatedAt < maxAge;
+    }
+
+    // Records a successful satellite response.  Responses without an ETag
+    // can't be revalidated, so they are not kept.
+    void store(const std::string& key, crow::Response& resp)
+    {
+        std::string_view etag =
+            resp.getHeaderValue(boost::beast::http::field::etag);
+        const std::string* body = resp.body();
+        if (resp.result() != boost::beast::http::status::ok || etag.empty() ||
+            body == nullptr)
+        {
+            entries.erase(key);
+            return;
+        }
+        if (entries.size() >= maxEntries && !entries.contains(key))
+        {
+            evictOldest();
+        }
+        SatelliteCacheEntry& entry = entries[key];
+        entry.etag = etag;
+        entry.contentType =
+            resp.getHeaderValue(boost::beast::http::field::content_type);
+        entry.allow = resp.getHeaderValue(boost::beast::http::field::allow);
+        entry.body = *body;
+        entry.validatedAt = std::chrono::steady_clock::now();
+        entry.sequence = nextSequence++;
+    }
+
+    // Called when the satellite answered 304 Not Modified
+    const SatelliteCacheEntry* revalidate(const std::string& key)
+    {
+        auto it = entries.find(key);
+        if (it == entries.end())
+        {
+            return nullptr;
+        }
+        it->second.validatedAt = std::chrono::steady_clock::now();
+        it->second.sequence = nextSequence++;
+        return &it->second;
+    }
+
+    void invalidate(const std::string& key)
+    {
+        entries.erase(key);
+    }
+
+    // Drops the entries for every user whose URL is urlPrefix or a resource
+    // below it.  "/Systems/1" doesn't drop "/Systems/10".
+    void invalidatePrefix(std::string_view urlPrefix)
+    {
+        auto it = entries.lower_bound(urlPrefix);
+        while (it != entries.end() && it->first.starts_with(urlPrefix))
+        {
+            char next = it->first[urlPrefix.size()];
+            if (next == '\n' || next == '/' || next == '?')
+            {
+                it = entries.erase(it);
+                continue;
+            }
+            it++;
+        }
+    }
+
+    size_t size() const
+    {
+        return entries.size();
+    }
+
+  private:
+    void evictOldest()
+    {
+        auto oldest = std::ranges::min_element(
+            entries, {},
+            [](const auto& entry) { return entry.second.sequence; });
+        if (oldest != entries.end())
+        {
+            entries.erase(oldest);
+        }
+    }
+
+    std::chrono::seconds maxAge;
+    size_t maxEntries;
+    uint64_t nextSequence = 0;
+    std::map<std::string, SatelliteCacheEntry, std::less<>> entries;
+};
+
+// How long an aggregated collection waits on satellites before answering
+// with whatever has been merged so far, for satellites whose config doesn't
+// set a Timeout
+constexpr std::chrono::seconds aggregationSatelliteTimeout{10};
+
+// Tracks the satellites that still owe a response to one aggregated request.
+// Satellite responses are merged into the AsyncResp as they arrive.  The
+// AsyncResp is held here rather than by each HttpClient callback, so the
+// client is answered once every satellite has replied or the deadline has
+// passed, and a single stalled satellite no longer sets the latency.
+class AggregationFanout :
+    public std::enable_shared_from_this<AggregationFanout>
+{
+  public:
+    using ResponseHandler =
+        std::function<void(const std::string&,
+                           const std::shared_ptr<bmcweb::AsyncResp>&,
+                           crow::Response&)>;
+
+    AggregationFanout(boost::asio::io_context& ioc,
+                      std::shared_ptr<bmcweb::AsyncResp> asyncRespIn,
+                      ResponseHandler handlerIn, size_t satellites) :
+        timer(ioc), asyncResp(std::move(asyncRespIn)),
+        handler(std::move(handlerIn)), outstanding(satellites)
+    {}
+
+    AggregationFanout(const AggregationFanout&) = delete;
+    AggregationFanout& operator=(const AggregationFanout&) = delete;
+    AggregationFanout(AggregationFanout&&) = delete;
+    AggregationFanout& operator=(AggregationFanout&&) = delete;
+    ~AggregationFanout() = default;
+
+    void start(std::chrono::steady_clock::duration timeout)
+    {
+        if (outstanding == 0)
+        {
+            // Nothing to wait for
+            finish();
+            return;
+        }
+        timer.expires_after(timeout);
+        timer.async_wait(std::bind_front(onTimeout, weak_from_this()));
+    }
+
+    // Returns the HttpClient callback for the satellite with the given prefix
+    std::function<void(crow::Response&)> callbackFor(const std::string& prefix)
+    {
+        return std::bind_front(&AggregationFanout::onResponse,
+                               shared_from_this(), prefix);
+    }
+
+    void onResponse(const std::string& prefix, crow::Response& resp)
+    {
+        if (asyncResp == nullptr)
+        {
+            BMCWEB_LOG_WARNING(
+                "Discarding response from satellite \"{}\" after deadline",
+                prefix);
+            return;
+        }
+        handler(prefix, asyncResp, resp);
+        outstanding--;
+        if (outstanding == 0)
+        {
+            finish();
+        }
+    }
+
+  private:
+    static void onTimeout(const std::weak_ptr<AggregationFanout>& weakSelf,
+                          const boost::system::error_code& ec)
+    {
+        if (ec == boost::asio::error::operation_aborted)
+        {
+            return;
+        }
+        std::shared_ptr<AggregationFanout> self = weakSelf.lock();
+        if (!self)
+        {
+            return;
+        }
+        if (ec)
+        {
+            BMCWEB_LOG_ERROR("Aggregation timer failed {}", ec);
+        }
+        BMCWEB_LOG_WARNING("{} satellite(s) did not respond in time",
+                           self->outstanding);
+        self->finish();
+    }
+
+    void finish()
+    {
+        timer.cancel();
+        asyncResp.reset();
+    }
+
+    boost::asio::steady_timer timer;
+    std::shared_ptr<bmcweb::AsyncResp> asyncResp;
+    ResponseHandler handler;
+    size_t outstanding;
+};
+
 class RedfishAggregator
 {
   private:
     crow::HttpClient client;
+    SatelliteResponseCache satelliteCache{
+        std::chrono::seconds(BMCWEB_REDFISH_AGGREGATION_CACHE_MAX_AGE), 256};
+
+    // Satellite configs keyed by prefix.  Loaded at startup and refreshed
+    // whenever EntityManager adds or removes a SatelliteController, so that
+    // aggregated requests don't need to query D-Bus.  Empty until the first
+    // query succeeds.
+    std::optional<std::unordered_map<std::string, boost::urls::url>>
+        satelliteConfigs;
+    // Aggregation timeouts of the satellites whose config sets one
+    std::unordered_map<std::string, std::chrono::seconds> satelliteTimeouts;
+    std::unique_ptr<sdbusplus::bus::match_t> satelliteAddedMatch;
+    std::unique_ptr<sdbusplus::bus::match_t> satelliteRemovedMatch;
+
+    static constexpr std::string_view satelliteInterface =
+        "xyz.openbmc_project.Configuration.SatelliteController";
 
     // Dummy callback used by the Constructor so that it can report the number
     // of satellite configs when the class is first created
@@ -438,14 +736,14 @@ class RedfishAggregator
     // information if valid
     static void findSatelliteConfigs(
         const dbus::utility::ManagedObjectType& objects,
-        std::unordered_map<std::string, boost::urls::url>& satelliteInfo)
+        std::unordered_map<std::string, boost::urls::url>& satelliteInfo,
+        std::unordered_map<std::string, std::chrono::seconds>& timeouts)
     {
         for (const auto& objectPath : objects)
         {
             for (const auto& interface : objectPath.second)
             {
-                if (interface.first ==
-                    "xyz.openbmc_project.Configuration.SatelliteController")
+                if (interface.first == satelliteInterface)
                 {
                     BMCWEB_LOG_DEBUG("Found Satellite Controller at {}",
                                      objectPath.first.str);
@@ -456,10 +754,12 @@ class RedfishAggregator
                             "Redfish Aggregation only supports one satellite!");
                         BMCWEB_LOG_DEBUG("Clearing all satellite data");
                         satelliteInfo.clear();
+                        timeouts.clear();
                         return;
                     }
 
-                    addSatelliteConfig(interface.second, satelliteInfo);
+                    addSatelliteConfig(interface.second, satelliteInfo,
+                                       timeouts);
                 }
             }
         }
@@ -469,10 +769,12 @@ class RedfishAggregator
     // configuration if the properties are valid
     static void addSatelliteConfig(
         const dbus::utility::DBusPropertiesMap& properties,
-        std::unordered_map<std::string, boost::urls::url>& satelliteInfo)
+        std::unordered_map<std::string, boost::urls::url>& satelliteInfo,
+        std::unordered_map<std::string, std::chrono::seconds>& timeouts)
     {
         boost::urls::url url;
         std::string prefix;
+        std::optional<std::chrono::seconds> timeout;
 
         for (const auto& prop : properties)
         {
@@ -543,6 +845,20 @@ class RedfishAggregator
                     return;
                 }
             }
+            else if (prop.first == "Timeout")
+            {
+                // Optional, so a bad value falls back to the default rather
+                // than dropping the satellite
+                const uint64_t* propVal = std::get_if<uint64_t>(&prop.second);
+                if (propVal == nullptr || *propVal == 0 ||
+                    *propVal > std::numeric_limits<uint16_t>::max())
+                {
+                    BMCWEB_LOG_ERROR("Invalid Timeout value, using {}s",
+                                     aggregationSatelliteTimeout.count());
+                    continue;
+                }
+                timeout = std::chrono::seconds(*propVal);
+            }
         } // Finished reading properties
 
         // Make sure all required config information was made available
@@ -564,6 +880,15 @@ class RedfishAggregator
             return;
         }
 
+        if (timeout)
+        {
+            timeouts.insert_or_assign(prefix, *timeout);
+        }
+        else
+        {
+            timeouts.erase(prefix);
+        }
+
         std::string resultString;
         auto result = satelliteInfo.insert_or_assign(prefix, std::move(url));
         if (result.second)
@@ -661,20 +986,17 @@ class RedfishAggregator
         std::string_view memberName)
     {
         // Determine if the resource ID begins with a known prefix
-        for (const auto& satellite : satelliteInfo)
+        const std::string* prefix =
+            findSatellitePrefix(memberName, satelliteInfo);
+        if (prefix != nullptr)
         {
-            std::string targetPrefix = satellite.first;
-            targetPrefix += "_";
-            if (memberName.starts_with(targetPrefix))
-            {
-                BMCWEB_LOG_DEBUG("\"{}\" is a known prefix", satellite.first);
+            BMCWEB_LOG_DEBUG("\"{}\" is a known prefix", *prefix);
 
-                // Remove the known prefix from the request's URI and
-                // then forward to the associated satellite BMC
-                getInstance().forwardRequest(req, asyncResp, satellite.first,
-                                             satelliteInfo);
-                return;
-            }
+            // Remove the known prefix from the request's URI and
+            // then forward to the associated satellite BMC
+            getInstance().forwardRequest(req, asyncResp, *prefix,
+                                         satelliteInfo);
+            return;
         }
 
         // We didn't recognize the prefix and need to return a 404
@@ -804,9 +1126,6 @@ class RedfishAggregator
         }
         path.erase(pos, prefix.size() + 1);
 
-        std::function<void(crow::Response&)> cb =
-            std::bind_front(processResponse, prefix, asyncResp);
-
         std::string data = thisReq.body();
         boost::urls::url url(sat->second);
         url.set_path(path);
@@ -814,9 +1133,92 @@ class RedfishAggregator
         {
             url.set_query(targetURI.query());
         }
+
+        if (thisReq.method() != boost::beast::http::verb::get)
+        {
+            if (isModifyingMethod(thisReq.method()))
+            {
+                // A write may modify the resource, the collection listing it,
+                // or for actions the resource they act on
+                boost::urls::url modified(sat->second);
+                modified.set_path(modifiedCollection(path));
+                satelliteCache.invalidatePrefix(modified.buffer());
+            }
+            std::function<void(crow::Response&)> cb =
+                std::bind_front(processResponse, prefix, asyncResp);
+            client.sendDataWithCallback(std::move(data), url,
+                                        ensuressl::VerifyCertificate::Verify,
+                                        thisReq.fields(), thisReq.method(), cb);
+            return;
+        }
+
+        std::string cacheKey;
+        if (thisReq.session != nullptr)
+        {
+            cacheKey = SatelliteResponseCache::makeKey(
+                url.buffer(), thisReq.session->username,
+                thisReq.session->userRole);
+        }
+        else
+        {
+            cacheKey = SatelliteResponseCache::makeKey(url.buffer(), "", "");
+        }
+
+        boost::beast::http::fields fields(thisReq.fields());
+        const SatelliteCacheEntry* cached = satelliteCache.find(cacheKey);
+        if (cached == nullptr)
+        {
+            std::function<void(crow::Response&)> cb = std::bind_front(
+                processCacheableResponse, prefix, std::move(cacheKey),
+                asyncResp);
+            client.sendDataWithCallback(std::move(data), url,
+                                        ensuressl::VerifyCertificate::Verify,
+                                        fields, thisReq.method(), cb);
+            return;
+        }
+        if (satelliteCache.isFresh(*cached))
+        {
+            BMCWEB_LOG_DEBUG("Serving {} from satellite cache", cacheKey);
+            crow::Response cachedResp;
+            cached->toResponse(cachedResp);
+            processResponse(prefix, asyncResp, cachedResp);
+            return;
+        }
+
+        // The client's own If-None-Match is handled against the prefixed
+        // response once it is built locally
+        fields.erase(boost::beast::http::field::if_none_match);
+        boost::beast::http::fields conditional(fields);
+        conditional.set(boost::beast::http::field::if_none_match, cached->etag);
+        std::function<void(crow::Response&)> cb = std::bind_front(
+            processRevalidationResponse, prefix, std::move(cacheKey), url,
+            std::move(fields), asyncResp);
         client.sendDataWithCallback(std::move(data), url,
                                     ensuressl::VerifyCertificate::Verify,
-                                    thisReq.fields(), thisReq.method(), cb);
+                                    conditional, thisReq.method(), cb);
+    }
+
+    std::chrono::seconds satelliteTimeout(const std::string& prefix) const
+    {
+        auto it = satelliteTimeouts.find(prefix);
+        if (it == satelliteTimeouts.end())
+        {
+            return aggregationSatelliteTimeout;
+        }
+        return it->second;
+    }
+
+    // A fanout waits as long as its slowest configured satellite
+    std::chrono::seconds fanoutTimeout(
+        const std::unordered_map<std::string, boost::urls::url>& satelliteInfo)
+        const
+    {
+        std::chrono::seconds timeout{0};
+        for (const auto& sat : satelliteInfo)
+        {
+            timeout = std::max(timeout, satelliteTimeout(sat.first));
+        }
+        return timeout;
     }
 
     // Forward a request for a collection URI to each known satellite BMC
@@ -825,10 +1227,14 @@ class RedfishAggregator
         const std::shared_ptr<bmcweb::AsyncResp>& asyncResp,
         const std::unordered_map<std::string, boost::urls::url>& satelliteInfo)
     {
+        auto fanout = std::make_shared<AggregationFanout>(
+            getIoContext(), asyncResp, processCollectionResponse,
+            satelliteInfo.size());
+        fanout->start(fanoutTimeout(satelliteInfo));
         for (const auto& sat : satelliteInfo)
         {
-            std::function<void(crow::Response&)> cb = std::bind_front(
-                processCollectionResponse, sat.first, asyncResp);
+            std::function<void(crow::Response&)> cb =
+                fanout->callbackFor(sat.first);
 
             boost::urls::url url(sat.second);
             url.set_path(thisReq.url().path());
@@ -850,10 +1256,14 @@ class RedfishAggregator
         const std::shared_ptr<bmcweb::AsyncResp>& asyncResp,
         const std::unordered_map<std::string, boost::urls::url>& satelliteInfo)
     {
+        auto fanout = std::make_shared<AggregationFanout>(
+            getIoContext(), asyncResp, processContainsSubordinateResponse,
+            satelliteInfo.size());
+        fanout->start(fanoutTimeout(satelliteInfo));
         for (const auto& sat : satelliteInfo)
         {
-            std::function<void(crow::Response&)> cb = std::bind_front(
-                processContainsSubordinateResponse, sat.first, asyncResp);
+            std::function<void(crow::Response&)> cb =
+                fanout->callbackFor(sat.first);
 
             // will ignore an expanded resource in the response if that resource
             // is not already supported by the aggregating BMC
@@ -875,7 +1285,21 @@ class RedfishAggregator
         client(getIoContext(),
                std::make_shared<crow::ConnectionPolicy>(getAggregationPolicy()))
     {
-        getSatelliteConfigs(constructorCallback);
+        sdbusplus::message::object_path inventoryPath(
+            "/xyz/openbmc_project/inventory");
+        std::string sender = sdbusplus::bus::match::rules::sender(
+            "xyz.openbmc_project.EntityManager");
+        satelliteAddedMatch = std::make_unique<sdbusplus::bus::match_t>(
+            *crow::connections::systemBus,
+            sdbusplus::bus::match::rules::interfacesAdded(inventoryPath) +
+                sender,
+            onSatelliteInterfacesAdded);
+        satelliteRemovedMatch = std::make_unique<sdbusplus::bus::match_t>(
+            *crow::connections::systemBus,
+            sdbusplus::bus::match::rules::interfacesRemoved(inventoryPath) +
+                sender,
+            onSatelliteInterfacesRemoved);
+        querySatelliteConfigs(constructorCallback);
     }
     RedfishAggregator(const RedfishAggregator&) = delete;
     RedfishAggregator& operator=(const RedfishAggregator&) = delete;
@@ -889,13 +1313,83 @@ class RedfishAggregator
         return handler;
     }
 
-    // Polls D-Bus to get all available satellite config information
-    // Expects a handler which interacts with the returned configs
+    // Returns the prefix of the satellite that owns the given member id, for
+    // example "5B247A" for "5B247A_chassis".  Prefixes may themselves contain
+    // an underscore, so each candidate split is looked up in turn.
+    static const std::string* findSatellitePrefix(
+        std::string_view memberName,
+        const std::unordered_map<std::string, boost::urls::url>& satelliteInfo)
+    {
+        std::string candidate;
+        size_t pos = memberName.find('_');
+        while (pos != std::string_view::npos)
+        {
+            candidate = memberName.substr(0, pos);
+            auto it = satelliteInfo.find(candidate);
+            if (it != satelliteInfo.end())
+            {
+                return &it->first;
+            }
+            pos = memberName.find('_', pos + 1);
+        }
+        return nullptr;
+    }
+
+    // Provides the known satellite configs to the handler.  Configs are
+    // served from memory once loaded, and only fetched from D-Bus if the
+    // initial query hasn't completed yet.
     static void getSatelliteConfigs(
         std::function<
             void(const boost::system::error_code&,
                  const std::unordered_map<std::string, boost::urls::url>&)>
             handler)
+    {
+        RedfishAggregator& self = getInstance();
+        if (self.satelliteConfigs)
+        {
+            handler(boost::system::error_code(), *self.satelliteConfigs);
+            return;
+        }
+        querySatelliteConfigs(std::move(handler));
+    }
+
+    static void onSatelliteInterfacesAdded(sdbusplus::message_t& msg)
+    {
+        sdbusplus::message::object_path path;
+        dbus::utility::DBusInterfacesMap interfaces;
+        msg.read(path, interfaces);
+        if (std::ranges::none_of(interfaces, [](const auto& interface) {
+                return interface.first == satelliteInterface;
+            }))
+        {
+            return;
+        }
+        BMCWEB_LOG_DEBUG("Satellite config added at {}", path.str);
+        querySatelliteConfigs(constructorCallback);
+    }
+
+    static void onSatelliteInterfacesRemoved(sdbusplus::message_t& msg)
+    {
+        sdbusplus::message::object_path path;
+        std::vector<std::string> interfaces;
+        msg.read(path, interfaces);
+        if (std::ranges::find(interfaces, satelliteInterface) ==
+            interfaces.end())
+        {
+            return;
+        }
+        BMCWEB_LOG_DEBUG("Satellite config removed at {}", path.str);
+        querySatelliteConfigs(constructorCallback);
+    }
+
+    // Polls D-Bus to get all available satellite config information and
+    // refreshes the in memory copy.  Expects a handler which interacts with
+    // the returned configs
+    static void querySatelliteConfigs(
+        std::function<
+            void(const boost::system::error_code&,
+                 const std::unordered_map<std::string, boost::urls::url>&)>
+            handler)
     {
         BMCWEB_LOG_DEBUG("Gathering satellite configs");
         sdbusplus::message::object_path path("/xyz/openbmc_project/inventory");
@@ -905,6 +1399,7 @@ class RedfishAggregator
                 const boost::system::error_code& ec,
                 const dbus::utility::ManagedObjectType& objects) {
                 std::unordered_map<std::string, boost::urls::url> satelliteInfo;
+                std::unordered_map<std::string, std::chrono::seconds> timeouts;
                 if (ec)
                 {
                     BMCWEB_LOG_ERROR("DBUS response error {}, {}", ec.value(),
@@ -916,7 +1411,9 @@ class RedfishAggregator
                 // Maps a chosen alias representing a satellite BMC to a url
                 // containing the information required to create a http
                 // connection to the satellite
-                findSatelliteConfigs(objects, satelliteInfo);
+                findSatelliteConfigs(objects, satelliteInfo, timeouts);
+                getInstance().satelliteConfigs = satelliteInfo;
+                getInstance().satelliteTimeouts = std::move(timeouts);
 
                 if (!satelliteInfo.empty())
                 {
@@ -983,6 +1480,59 @@ class RedfishAggregator
         addAggregatedHeaders(asyncResp->res, resp, prefix);
     }
 
+    // Updates the satellite cache from a GET response and loads the response,
+    // or the cached copy when the satellite answered 304, into asyncResp
+    static void processCacheableResponse(
+        const std::string& prefix, const std::string& cacheKey,
+        const std::shared_ptr<bmcweb::AsyncResp>& asyncResp,
+        crow::Response& resp)
+    {
+        if ((resp.result() != boost::beast::http::status::not_modified) &&
+            (resp.result() != boost::beast::http::status::too_many_requests) &&
+            (resp.result() != boost::beast::http::status::bad_gateway))
+        {
+            getInstance().satelliteCache.store(cacheKey, resp);
+        }
+        processResponse(prefix, asyncResp, resp);
+    }
+
+    // Handles the reply to a GET sent with the cached ETag.  A 304 is answered
+    // from the cache.  If the entry was evicted while the request was in
+    // flight there is no body to return, so the request is sent again without
+    // If-None-Match.
+    static void processRevalidationResponse(
+        const std::string& prefix, const std::string& cacheKey,
+        const boost::urls::url& url,
+        const boost::beast::http::fields& unconditionalFields,
+        const std::shared_ptr<bmcweb::AsyncResp>& asyncResp,
+        crow::Response& resp)
+    {
+        if (resp.result() != boost::beast::http::status::not_modified)
+        {
+            processCacheableResponse(prefix, cacheKey, asyncResp, resp);
+            return;
+        }
+        RedfishAggregator& self = getInstance();
+        const SatelliteCacheEntry* cached =
+            self.satelliteCache.revalidate(cacheKey);
+        if (cached != nullptr)
+        {
+            BMCWEB_LOG_DEBUG("Satellite revalidated {}", cacheKey);
+            crow::Response cachedResp;
+            cached->toResponse(cachedResp);
+            processResponse(prefix, asyncResp, cachedResp);
+            return;
+        }
+        BMCWEB_LOG_DEBUG("{} was evicted during revalidation, refetching",
+                         cacheKey);
+        std::function<void(crow::Response&)> cb =
+            std::bind_front(processCacheableResponse, prefix, cacheKey,
+                            asyncResp);
+        self.client.sendDataWithCallback(
+            "", url, ensuressl::VerifyCertificate::Verify, unconditionalFields,
+            boost::beast::http::verb::get, cb);
+    }
+
     // Processes the collection response returned by a satellite BMC and merges
     // its "@odata.id" values
     static void processCollectionResponse(
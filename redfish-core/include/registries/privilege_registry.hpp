@@ -19,1986 +19,1986 @@
 
 namespace redfish::privileges
 {
-const std::array<Privileges, 1> privilegeSetLogin = {{
+constexpr std::array<Privileges, 1> privilegeSetLogin = {{
     {"Login"}
 }};
-const std::array<Privileges, 1> privilegeSetConfigureComponents = {{
+constexpr std::array<Privileges, 1> privilegeSetConfigureComponents = {{
     {"ConfigureComponents"}
 }};
-const std::array<Privileges, 1> privilegeSetConfigureUsers = {{
+constexpr std::array<Privileges, 1> privilegeSetConfigureUsers = {{
     {"ConfigureUsers"}
 }};
-const std::array<Privileges, 1> privilegeSetConfigureManager = {{
+constexpr std::array<Privileges, 1> privilegeSetConfigureManager = {{
     {"ConfigureManager"}
 }};
-const std::array<Privileges, 2> privilegeSetConfigureManagerOrConfigureComponents = {{
+constexpr std::array<Privileges, 2> privilegeSetConfigureManagerOrConfigureComponents = {{
     {"ConfigureManager"},
     {"ConfigureComponents"}
 }};
-const std::array<Privileges, 2> privilegeSetConfigureManagerOrConfigureSelf = {{
+constexpr std::array<Privileges, 2> privilegeSetConfigureManagerOrConfigureSelf = {{
     {"ConfigureManager"},
     {"ConfigureSelf"}
 }};
-const std::array<Privileges, 3> privilegeSetConfigureManagerOrConfigureUsersOrConfigureSelf = {{
+constexpr std::array<Privileges, 3> privilegeSetConfigureManagerOrConfigureUsersOrConfigureSelf = {{
     {"ConfigureManager"},
     {"ConfigureUsers"},
     {"ConfigureSelf"}
 }};
-const std::array<Privileges, 2> privilegeSetLoginOrNoAuth = {{
+constexpr std::array<Privileges, 2> privilegeSetLoginOrNoAuth = {{
     {"Login"},
     {}
 }};
 // AccelerationFunction
-const static auto& getAccelerationFunction = privilegeSetLogin;
-const static auto& headAccelerationFunction = privilegeSetLogin;
-const static auto& patchAccelerationFunction = privilegeSetConfigureComponents;
-const static auto& putAccelerationFunction = privilegeSetConfigureComponents;
-const static auto& deleteAccelerationFunction = privilegeSetConfigureComponents;
-const static auto& postAccelerationFunction = privilegeSetConfigureComponents;
+static constexpr const auto& getAccelerationFunction = privilegeSetLogin;
+static constexpr const auto& headAccelerationFunction = privilegeSetLogin;
+static constexpr const auto& patchAccelerationFunction = privilegeSetConfigureComponents;
+static constexpr const auto& putAccelerationFunction = privilegeSetConfigureComponents;
+static constexpr const auto& deleteAccelerationFunction = privilegeSetConfigureComponents;
+static constexpr const auto& postAccelerationFunction = privilegeSetConfigureComponents;
 
 // AccelerationFunctionCollection
-const static auto& getAccelerationFunctionCollection = privilegeSetLogin;
-const static auto& headAccelerationFunctionCollection = privilegeSetLogin;
-const static auto& patchAccelerationFunctionCollection = privilegeSetConfigureComponents;
-const static auto& putAccelerationFunctionCollection = privilegeSetConfigureComponents;
-const static auto& deleteAccelerationFunctionCollection = privilegeSetConfigureComponents;
-const static auto& postAccelerationFunctionCollection = privilegeSetConfigureComponents;
+static constexpr const auto& getAccelerationFunctionCollection = privilegeSetLogin;
+static constexpr const auto& headAccelerationFunctionCollection = privilegeSetLogin;
+static constexpr const auto& patchAccelerationFunctionCollection = privilegeSetConfigureComponents;
+static constexpr const auto& putAccelerationFunctionCollection = privilegeSetConfigureComponents;
+static constexpr const auto& deleteAccelerationFunctionCollection = privilegeSetConfigureComponents;
+static constexpr const auto& postAccelerationFunctionCollection = privilegeSetConfigureComponents;
 
 // AccountService
-const static auto& getAccountService = privilegeSetLogin;
-const static auto& headAccountService = privilegeSetLogin;
-const static auto& patchAccountService = privilegeSetConfigureUsers;
-const static auto& putAccountService = privilegeSetConfigureUsers;
-const static auto& deleteAccountService = privilegeSetConfigureUsers;
-const static auto& postAccountService = privilegeSetConfigureUsers;
+static constexpr const auto& getAccountService = privilegeSetLogin;
+static constexpr const auto& headAccountService = privilegeSetLogin;
+static constexpr const auto& patchAccountService = privilegeSetConfigureUsers;
+static constexpr const auto& putAccountService = privilegeSetConfigureUsers;
+static constexpr const auto& deleteAccountService = privilegeSetConfigureUsers;
+static constexpr const auto& postAccountService = privilegeSetConfigureUsers;
 
 // ActionInfo
-const static auto& getActionInfo = privilegeSetLogin;
-const static auto& headActionInfo = privilegeSetLogin;
-const static auto& patchActionInfo = privilegeSetConfigureManager;
-const static auto& putActionInfo = privilegeSetConfigureManager;
-const static auto& deleteActionInfo = privilegeSetConfigureManager;
-const static auto& postActionInfo = privilegeSetConfigureManager;
+static constexpr const auto& getActionInfo = privilegeSetLogin;
+static constexpr const auto& headActionInfo = privilegeSetLogin;
+static constexpr const auto& patchActionInfo = privilegeSetConfigureManager;
+static constexpr const auto& putActionInfo = privilegeSetConfigureManager;
+static constexpr const auto& deleteActionInfo = privilegeSetConfigureManager;
+static constexpr const auto& postActionInfo = privilegeSetConfigureManager;
 
 // AddressPool
-const static auto& getAddressPool = privilegeSetLogin;
-const static auto& headAddressPool = privilegeSetLogin;
-const static auto& patchAddressPool = privilegeSetConfigureComponents;
-const static auto& putAddressPool = privilegeSetConfigureComponents;
-const static auto& deleteAddressPool = privilegeSetConfigureComponents;
-const static auto& postAddressPool = privilegeSetConfigureComponents;
+static constexpr const auto& getAddressPool = privilegeSetLogin;
+static constexpr const auto& headAddressPool = privilegeSetLogin;
+static constexpr const auto& patchAddressPool = privilegeSetConfigureComponents;
+static constexpr const auto& putAddressPool = privilegeSetConfigureComponents;
+static constexpr const auto& deleteAddressPool = privilegeSetConfigureComponents;
+static constexpr const auto& postAddressPool = privilegeSetConfigureComponents;
 
 // AddressPoolCollection
-const static auto& getAddressPoolCollection = privilegeSetLogin;
-const static auto& headAddressPoolCollection = privilegeSetLogin;
-const static auto& patchAddressPoolCollection = privilegeSetConfigureComponents;
-const static auto& putAddressPoolCollection = privilegeSetConfigureComponents;
-const static auto& deleteAddressPoolCollection = privilegeSetConfigureComponents;
-const static auto& postAddressPoolCollection = privilegeSetConfigureComponents;
+static constexpr const auto& getAddressPoolCollection = privilegeSetLogin;
+static constexpr const auto& headAddressPoolCollection = privilegeSetLogin;
+static constexpr const auto& patchAddressPoolCollection = privilegeSetConfigureComponents;
+static constexpr const auto& putAddressPoolCollection = privilegeSetConfigureComponents;
+static constexpr const auto& deleteAddressPoolCollection = privilegeSetConfigureComponents;
+static constexpr const auto& postAddressPoolCollection = privilegeSetConfigureComponents;
 
 // Aggregate
-const static auto& getAggregate = privilegeSetLogin;
-const static auto& headAggregate = privilegeSetLogin;
-const static auto& patchAggregate = privilegeSetConfigureManagerOrConfigureComponents;
-const static auto& putAggregate = privilegeSetConfigureManagerOrConfigureComponents;
-const static auto& deleteAggregate = privilegeSetConfigureManagerOrConfigureComponents;
-const static auto& postAggregate = privilegeSetConfigureManagerOrConfigureComponents;
+static constexpr const auto& getAggregate = privilegeSetLogin;
+static constexpr const auto& headAggregate = privilegeSetLogin;
+static constexpr const auto& patchAggregate = privilegeSetConfigureManagerOrConfigureComponents;
+static constexpr const auto& putAggregate = privilegeSetConfigureManagerOrConfigureComponents;
+static constexpr const auto& deleteAggregate = privilegeSetConfigureManagerOrConfigureComponents;
+static constexpr const auto& postAggregate = privilegeSetConfigureManagerOrConfigureComponents;
 
 // AggregateCollection
-const static auto& getAggregateCollection = privilegeSetLogin;
-const static auto& headAggregateCollection = privilegeSetLogin;
-const static auto& patchAggregateCollection = privilegeSetConfigureManagerOrConfigureComponents;
-const static auto& putAggregateCollection = privilegeSetConfigureManagerOrConfigureComponents;
-const static auto& deleteAggregateCollection = privilegeSetConfigureManagerOrConfigureComponents;
-const static auto& postAggregateCollection = privilegeSetConfigureManagerOrConfigureComponents;
+static constexpr const auto& getAggregateCollection = privilegeSetLogin;
+static constexpr const auto& headAggregateCollection = privilegeSetLogin;
+static constexpr const auto& patchAggregateCollection = privilegeSetConfigureManagerOrConfigureComponents;
+static constexpr const auto& putAggregateCollection = privilegeSetConfigureManagerOrConfigureComponents;
+static constexpr const auto& deleteAggregateCollection = privilegeSetConfigureManagerOrConfigureComponents;
+static constexpr const auto& postAggregateCollection = privilegeSetConfigureManagerOrConfigureComponents;
 
 // AggregationService
-const static auto& getAggregationService = privilegeSetLogin;
-const static auto& headAggregationService = privilegeSetLogin;
-const static auto& patchAggregationService = privilegeSetConfigureManager;
-const static auto& putAggregationService = privilegeSetConfigureManager;
-const static auto& deleteAggregationService = privilegeSetConfigureManager;
-const static auto& postAggregationService = privilegeSetConfigureManager;
+static constexpr const auto& getAggregationService = privilegeSetLogin;
+static constexpr const auto& headAggregationService = privilegeSetLogin;
+static constexpr const auto& patchAggregationService = privilegeSetConfigureManager;
+static constexpr const auto& putAggregationService = privilegeSetConfigureManager;
+static constexpr const auto& deleteAggregationService = privilegeSetConfigureManager;
+static constexpr const auto& postAggregationService = privilegeSetConfigureManager;
 
 // AggregationSource
-const static auto& getAggregationSource = privilegeSetLogin;
-const static auto& headAggregationSource = privilegeSetLogin;
-const static auto& patchAggregationSource = privilegeSetConfigureManager;
-const static auto& putAggregationSource = privilegeSetConfigureManager;
-const static auto& deleteAggregationSource = privilegeSetConfigureManager;
-const static auto& postAggregationSource = privilegeSetConfigureManager;
+static constexpr const auto& getAggregationSource = privilegeSetLogin;
+static constexpr const auto& headAggregationSource = privilegeSetLogin;
+static constexpr const auto& patchAggregationSource = privilegeSetConfigureManager;
+static constexpr const auto& putAggregationSource = privilegeSetConfigureManager;
+static constexpr const auto& deleteAggregationSource = privilegeSetConfigureManager;
+static constexpr const auto& postAggregationSource = privilegeSetConfigureManager;
 
 // AggregationSourceCollection
-const static auto& getAggregationSourceCollection = privilegeSetLogin;
-const static auto& headAggregationSourceCollection = privilegeSetLogin;
-const static auto& patchAggregationSourceCollection = privilegeSetConfigureManager;
-const static auto& putAggregationSourceCollection = privilegeSetConfigureManager;
-const static auto& deleteAggregationSourceCollection = privilegeSetConfigureManager;
-const static auto& postAggregationSourceCollection = privilegeSetConfigureManager;
+static constexpr const auto& getAggregationSourceCollection = privilegeSetLogin;
+static constexpr const auto& headAggregationSourceCollection = privilegeSetLogin;
+static constexpr const auto& patchAggregationSourceCollection = privilegeSetConfigureManager;
+static constexpr const auto& putAggregationSourceCollection = privilegeSetConfigureManager;
+static constexpr const auto& deleteAggregationSourceCollection = privilegeSetConfigureManager;
+static constexpr const auto& postAggregationSourceCollection = privilegeSetConfigureManager;
 
 // AllowDeny
-const static auto& getAllowDeny = privilegeSetLogin;
-const static auto& headAllowDeny = privilegeSetLogin;
-const static auto& patchAllowDeny = privilegeSetConfigureManager;
-const static auto& putAllowDeny = privilegeSetConfigureManager;
-const static auto& deleteAllowDeny = privilegeSetConfigureManager;
-const static auto& postAllowDeny = privilegeSetConfigureManager;
+static constexpr const auto& getAllowDeny = privilegeSetLogin;
+static constexpr const auto& headAllowDeny = privilegeSetLogin;
+static constexpr const auto& patchAllowDeny = privilegeSetConfigureManager;
+static constexpr const auto& putAllowDeny = privilegeSetConfigureManager;
+static constexpr const auto& deleteAllowDeny = privilegeSetConfigureManager;
+static constexpr const auto& postAllowDeny = privilegeSetConfigureManager;
 
 // AllowDenyCollection
-const static auto& getAllowDenyCollection = privilegeSetLogin;
-const static auto& headAllowDenyCollection = privilegeSetLogin;
-const static auto& patchAllowDenyCollection = privilegeSetConfigureManager;
-const static auto& putAllowDenyCollection = privilegeSetConfigureManager;
-const static auto& deleteAllowDenyCollection = privilegeSetConfigureManager;
-const static auto& postAllowDenyCollection = privilegeSetConfigureManager;
+static constexpr const auto& getAllowDenyCollection = privilegeSetLogin;
+static constexpr const auto& headAllowDenyCollection = privilegeSetLogin;
+static constexpr const auto& patchAllowDenyCollection = privilegeSetConfigureManager;
+static constexpr const auto& putAllowDenyCollection = privilegeSetConfigureManager;
+static constexpr const auto& deleteAllowDenyCollection = privilegeSetConfigureManager;
+static constexpr const auto& postAllowDenyCollection = privilegeSetConfigureManager;
 
 // Application
-const static auto& getApplication = privilegeSetLogin;
-const static auto& headApplication = privilegeSetLogin;
-const static auto& patchApplication = privilegeSetConfigureComponents;
-const static auto& putApplication = privilegeSetConfigureComponents;
-const static auto& deleteApplication = privilegeSetConfigureComponents;
-const static auto& postApplication = privilegeSetConfigureComponents;
+static constexpr const auto& getApplication = privilegeSetLogin;
+static constexpr const auto& headApplication = privilegeSetLogin;
+static constexpr const auto& patchApplication = privilegeSetConfigureComponents;
+static constexpr const auto& putApplication = privilegeSetConfigureComponents;
+static constexpr const auto& deleteApplication = privilegeSetConfigureComponents;
+static constexpr const auto& postApplication = privilegeSetConfigureComponents;
 
 // ApplicationCollection
-const static auto& getApplicationCollection = privilegeSetLogin;
-const static auto& headApplicationCollection = privilegeSetLogin;
-const static auto& patchApplicationCollection = privilegeSetConfigureComponents;
-const static auto& putApplicationCollection = privilegeSetConfigureComponents;
-const static auto& deleteApplicationCollection = privilegeSetConfigureComponents;
-const static auto& postApplicationCollection = privilegeSetConfigureComponents;
+static constexpr const auto& getApplicationCollection = privilegeSetLogin;
+static constexpr const auto& headApplicationCollection = privilegeSetLogin;
+static constexpr const auto& patchApplicationCollection = privilegeSetConfigureComponents;
+static constexpr const auto& putApplicationCollection = privilegeSetConfigureComponents;
+static constexpr const auto& deleteApplicationCollection = privilegeSetConfigureComponents;
+static constexpr const auto& postApplicationCollection = privilegeSetConfigureComponents;
 
 // Assembly
-const static auto& getAssembly = privilegeSetLogin;
-const static auto& headAssembly = privilegeSetLogin;
-const static auto& patchAssembly = privilegeSetConfigureComponents;
-const static auto& putAssembly = privilegeSetConfigureComponents;
-const static auto& deleteAssembly = privilegeSetConfigureComponents;
-const static auto& postAssembly = privilegeSetConfigureComponents;
+static constexpr const auto& getAssembly = privilegeSetLogin;
+static constexpr const auto& headAssembly = privilegeSetLogin;
+static constexpr const auto& patchAssembly = privilegeSetConfigureComponents;
+static constexpr const auto& putAssembly = privilegeSetConfigureComponents;
+static constexpr const auto& deleteAssembly = privilegeSetConfigureComponents;
+static constexpr const auto& postAssembly = privilegeSetConfigureComponents;
 
 // AttributeRegistry
-const static auto& getAttributeRegistry = privilegeSetLogin;
-const static auto& headAttributeRegistry = privilegeSetLogin;
-const static auto& patchAttributeRegistry = privilegeSetConfigureManager;
-const static auto& putAttributeRegistry = privilegeSetConfigureManager;
-const static auto& deleteAttributeRegistry = privilegeSetConfigureManager;
-const static auto& postAttributeRegistry = privilegeSetConfigureManager;
+static constexpr const auto& getAttributeRegistry = privilegeSetLogin;
+static constexpr const auto& headAttributeRegistry = privilegeSetLogin;
+static constexpr const auto& patchAttributeRegistry = privilegeSetConfigureManager;
+static constexpr const auto& putAttributeRegistry = privilegeSetConfigureManager;
+static constexpr const auto& deleteAttributeRegistry = privilegeSetConfigureManager;
+static constexpr const auto& postAttributeRegistry = privilegeSetConfigureManager;
 
 // Battery
-const static auto& getBattery = privilegeSetLogin;
-const static auto& headBattery = privilegeSetLogin;
-const static auto& patchBattery = privilegeSetConfigureManager;
-const static auto& putBattery = privilegeSetConfigureManager;
-const static auto& deleteBattery = privilegeSetConfigureManager;
-const static auto& postBattery = privilegeSetConfigureManager;
+static constexpr const auto& getBattery = privilegeSetLogin;
+static constexpr const auto& headBattery = privilegeSetLogin;
+static constexpr const auto& patchBattery = privilegeSetConfigureManager;
+static constexpr const auto& putBattery = privilegeSetConfigureManager;
+static constexpr const auto& deleteBattery = privilegeSetConfigureManager;
+static constexpr const auto& postBattery = privilegeSetConfigureManager;
 
 // BatteryCollection
-const static auto& getBatteryCollection = privilegeSetLogin;
-const static auto& headBatteryCollection = privilegeSetLogin;
-const static auto& patchBatteryCollection = privilegeSetConfigureManager;
-const static auto& putBatteryCollection = privilegeSetConfigureManager;
-const static auto& deleteBatteryCollection = privilegeSetConfigureManager;
-const static auto& postBatteryCollection = privilegeSetConfigureManager;
+static constexpr const auto& getBatteryCollection = privilegeSetLogin;
+static constexpr const auto& headBatteryCollection = privilegeSetLogin;
+static constexpr const auto& patchBatteryCollection = privilegeSetConfigureManager;
+static constexpr const auto& putBatteryCollection = privilegeSetConfigureManager;
+static constexpr const auto& deleteBatteryCollection = privilegeSetConfigureManager;
+static constexpr const auto& postBatteryCollection = privilegeSetConfigureManager;
 
 // BatteryMetrics
-const static auto& getBatteryMetrics = privilegeSetLogin;
-const static auto& headBatteryMetrics = privilegeSetLogin;
-const static auto& patchBatteryMetrics = privilegeSetConfigureManager;
-const static auto& putBatteryMetrics = privilegeSetConfigureManager;
-const static auto& deleteBatteryMetrics = privilegeSetConfigureManager;
-const static auto& postBatteryMetrics = privilegeSetConfigureManager;
+static constexpr const auto& getBatteryMetrics = privilegeSetLogin;
+static constexpr const auto& headBatteryMetrics = privilegeSetLogin;
+static constexpr const auto& patchBatteryMetrics = privilegeSetConfigureManager;
+static constexpr const auto& putBatteryMetrics = privilegeSetConfigureManager;
+static constexpr const auto& deleteBatteryMetrics = privilegeSetConfigureManager;
+static constexpr const auto& postBatteryMetrics = privilegeSetConfigureManager;
 
 // Bios
-const static auto& getBios = privilegeSetLogin;
-const static auto& headBios = privilegeSetLogin;
-const static auto& patchBios = privilegeSetConfigureComponents;
-const static auto& postBios = privilegeSetConfigureComponents;
-const static auto& putBios = privilegeSetConfigureComponents;
-const static auto& deleteBios = privilegeSetConfigureComponents;
+static constexpr const auto& getBios = privilegeSetLogin;
+static constexpr const auto& headBios = privilegeSetLogin;
+static constexpr const auto& patchBios = privilegeSetConfigureComponents;
+static constexpr const auto& postBios = privilegeSetConfigureComponents;
+static constexpr const auto& putBios = privilegeSetConfigureComponents;
+static constexpr const auto& deleteBios = privilegeSetConfigureComponents;
 
 // BootOption
-const static auto& getBootOption = privilegeSetLogin;
-const static auto& headBootOption = privilegeSetLogin;
-const static auto& patchBootOption = privilegeSetConfigureComponents;
-const static auto& putBootOption = privilegeSetConfigureComponents;
-const static auto& deleteBootOption = privilegeSetConfigureComponents;
-const static auto& postBootOption = privilegeSetConfigureComponents;
+static constexpr const auto& getBootOption = privilegeSetLogin;
+static constexpr const auto& headBootOption = privilegeSetLogin;
+static constexpr const auto& patchBootOption = privilegeSetConfigureComponents;
+static constexpr const auto& putBootOption = privilegeSetConfigureComponents;
+static constexpr const auto& deleteBootOption = privilegeSetConfigureComponents;
+static constexpr const auto& postBootOption = privilegeSetConfigureComponents;
 
 // BootOptionCollection
-const static auto& getBootOptionCollection = privilegeSetLogin;
-const static auto& headBootOptionCollection = privilegeSetLogin;
-const static auto& patchBootOptionCollection = privilegeSetConfigureComponents;
-const static auto& putBootOptionCollection = privilegeSetConfigureComponents;
-const static auto& deleteBootOptionCollection = privilegeSetConfigureComponents;
-const static auto& postBootOptionCollection = privilegeSetConfigureComponents;
+static constexpr const auto& getBootOptionCollection = privilegeSetLogin;
+static constexpr const auto& headBootOptionCollection = privilegeSetLogin;
+static constexpr const auto& patchBootOptionCollection = privilegeSetConfigureComponents;
+static constexpr const auto& putBootOptionCollection = privilegeSetConfigureComponents;
+static constexpr const auto& deleteBootOptionCollection = privilegeSetConfigureComponents;
+static constexpr const auto& postBootOptionCollection = privilegeSetConfigureComponents;
 
 // Cable
-const static auto& getCable = privilegeSetLogin;
-const static auto& headCable = privilegeSetLogin;
-const static auto& patchCable = privilegeSetConfigureComponents;
-const static auto& putCable = privilegeSetConfigureComponents;
-const static auto& deleteCable = privilegeSetConfigureComponents;
-const static auto& postCable = privilegeSetConfigureComponents;
+static constexpr const auto& getCable = privilegeSetLogin;
+static constexpr const auto& headCable = privilegeSetLogin;
+static constexpr const auto& patchCable = privilegeSetConfigureComponents;
+static constexpr const auto& putCable = privilegeSetConfigureComponents;
+static constexpr const auto& deleteCable = privilegeSetConfigureComponents;
+static constexpr const auto& postCable = privilegeSetConfigureComponents;
 
 // CableCollection
-const static auto& getCableCollection = privilegeSetLogin;
-const static auto& headCableCollection = privilegeSetLogin;
-const static auto& patchCableCollection = privilegeSetConfigureComponents;
-const static auto& putCableCollection = privilegeSetConfigureComponents;
-const static auto& deleteCableCollection = privilegeSetConfigureComponents;
-const static auto& postCableCollection = privilegeSetConfigureComponents;
+static constexpr const auto& getCableCollection = privilegeSetLogin;
+static constexpr const auto& headCableCollection = privilegeSetLogin;
+static constexpr const auto& patchCableCollection = privilegeSetConfigureComponents;
+static constexpr const auto& putCableCollection = privilegeSetConfigureComponents;
+static constexpr const auto& deleteCableCollection = privilegeSetConfigureComponents;
+static constexpr const auto& postCableCollection = privilegeSetConfigureComponents;
 
 // Certificate
-const static auto& getCertificate = privilegeSetConfigureManager;
-const static auto& headCertificate = privilegeSetConfigureManager;
-const static auto& patchCertificate = privilegeSetConfigureManager;
-const static auto& putCertificate = privilegeSetConfigureManager;
-const static auto& deleteCertificate = privilegeSetConfigureManager;
-const static auto& postCertificate = privilegeSetConfigureManager;
+static constexpr const auto& getCertificate = privilegeSetConfigureManager;
+static constexpr const auto& headCertificate = privilegeSetConfigureManager;
+static constexpr const auto& patchCertificate = privilegeSetConfigureManager;
+static constexpr const auto& putCertificate = privilegeSetConfigureManager;
+static constexpr const auto& deleteCertificate = privilegeSetConfigureManager;
+static constexpr const auto& postCertificate = privilegeSetConfigureManager;
 
 // CertificateCollection
-const static auto& getCertificateCollection = privilegeSetConfigureManager;
-const static auto& headCertificateCollection = privilegeSetConfigureManager;
-const static auto& patchCertificateCollection = privilegeSetConfigureManager;
-const static auto& putCertificateCollection = privilegeSetConfigureManager;
-const static auto& deleteCertificateCollection = privilegeSetConfigureManager;
-const static auto& postCertificateCollection = privilegeSetConfigureManager;
+static constexpr const auto& getCertificateCollection = privilegeSetConfigureManager;
+static constexpr const auto& headCertificateCollection = privilegeSetConfigureManager;
+static constexpr const auto& patchCertificateCollection = privilegeSetConfigureManager;
+static constexpr const auto& putCertificateCollection = privilegeSetConfigureManager;
+static constexpr const auto& deleteCertificateCollection = privilegeSetConfigureManager;
+static constexpr const auto& postCertificateCollection = privilegeSetConfigureManager;
 
 // CertificateLocations
-const static auto& getCertificateLocations = privilegeSetConfigureManager;
-const static auto& headCertificateLocations = privilegeSetConfigureManager;
-const static auto& patchCertificateLocations = privilegeSetConfigureManager;
-const static auto& putCertificateLocations = privilegeSetConfigureManager;
-const static auto& deleteCertificateLocations = privilegeSetConfigureManager;
-const static auto& postCertificateLocations = privilegeSetConfigureManager;
+static constexpr const auto& getCertificateLocations = privilegeSetConfigureManager;
+static constexpr const auto& headCertificateLocations = privilegeSetConfigureManager;
+static constexpr const auto& patchCertificateLocations = privilegeSetConfigureManager;
+static constexpr const auto& putCertificateLocations = privilegeSetConfigureManager;
+static constexpr const auto& deleteCertificateLocations = privilegeSetConfigureManager;
+static constexpr const auto& postCertificateLocations = privilegeSetConfigureManager;
 
 // CertificateService
-const static auto& getCertificateService = privilegeSetLogin;
-const static auto& headCertificateService = privilegeSetLogin;
-const static auto& patchCertificateService = privilegeSetConfigureManager;
-const static auto& putCertificateService = privilegeSetConfigureManager;
-const static auto& deleteCertificateService = privilegeSetConfigureManager;
-const static auto& postCertificateService = privilegeSetConfigureManager;
+static constexpr const auto& getCertificateService = privilegeSetLogin;
+static constexpr const auto& headCertificateService = privilegeSetLogin;
+static constexpr const auto& patchCertificateService = privilegeSetConfigureManager;
+static constexpr const auto& putCertificateService = privilegeSetConfigureManager;
+static constexpr const auto& deleteCertificateService = privilegeSetConfigureManager;
+static constexpr const auto& postCertificateService = privilegeSetConfigureManager;
 
 // Chassis
-const static auto& getChassis = privilegeSetLogin;
-const static auto& headChassis = privilegeSetLogin;
-const static auto& patchChassis = privilegeSetConfigureComponents;
-const static auto& putChassis = privilegeSetConfigureComponents;
-const static auto& deleteChassis = privilegeSetConfigureComponents;
-const static auto& postChassis = privilegeSetConfigureComponents;
+static constexpr const auto& getChassis = privilegeSetLogin;
+static constexpr const auto& headChassis = privilegeSetLogin;
+static constexpr const auto& patchChassis = privilegeSetConfigureComponents;
+static constexpr const auto& putChassis = privilegeSetConfigureComponents;
+static constexpr const auto& deleteChassis = privilegeSetConfigureComponents;
+static constexpr const auto& postChassis = privilegeSetConfigureComponents;
 
 // ChassisCollection
-const static auto& getChassisCollection = privilegeSetLogin;
-const static auto& headChassisCollection = privilegeSetLogin;
-const static auto& patchChassisCollection = privilegeSetConfigureComponents;
-const static auto& putChassisCollection = privilegeSetConfigureComponents;
-const static auto& deleteChassisCollection = privilegeSetConfigureComponents;
-const static auto& postChassisCollection = privilegeSetConfigureComponents;
+static constexpr const auto& getChassisCollection = privilegeSetLogin;
+static constexpr const auto& headChassisCollection = privilegeSetLogin;
+static constexpr const auto& patchChassisCollection = privilegeSetConfigureComponents;
+static constexpr const auto& putChassisCollection = privilegeSetConfigureComponents;
+static constexpr const auto& deleteChassisCollection = privilegeSetConfigureComponents;
+static constexpr const auto& postChassisCollection = privilegeSetConfigureComponents;
 
 // Circuit
-const static auto& getCircuit = privilegeSetLogin;
-const static auto& headCircuit = privilegeSetLogin;
-const static auto& patchCircuit = privilegeSetConfigureComponents;
-const static auto& putCircuit = privilegeSetConfigureComponents;
-const static auto& deleteCircuit = privilegeSetConfigureComponents;
-const static auto& postCircuit = privilegeSetConfigureComponents;
+static constexpr const auto& getCircuit = privilegeSetLogin;
+static constexpr const auto& headCircuit = privilegeSetLogin;
+static constexpr const auto& patchCircuit = privilegeSetConfigureComponents;
+static constexpr const auto& putCircuit = privilegeSetConfigureComponents;
+static constexpr const auto& deleteCircuit = privilegeSetConfigureComponents;
+static constexpr const auto& postCircuit = privilegeSetConfigureComponents;
 
 // CircuitCollection
-const static auto& getCircuitCollection = privilegeSetLogin;
-const static auto& headCircuitCollection = privilegeSetLogin;
-const static auto& patchCircuitCollection = privilegeSetConfigureComponents;
-const static auto& putCircuitCollection = privilegeSetConfigureComponents;
-const static auto& deleteCircuitCollection = privilegeSetConfigureComponents;
-const static auto& postCircuitCollection = privilegeSetConfigureComponents;
+static constexpr const auto& getCircuitCollection = privilegeSetLogin;
+static constexpr const auto& headCircuitCollection = privilegeSetLogin;
+static constexpr const auto& patchCircuitCollection = privilegeSetConfigureComponents;
+static constexpr const auto& putCircuitCollection = privilegeSetConfigureComponents;
+static constexpr const auto& deleteCircuitCollection = privilegeSetConfigureComponents;
+static constexpr const auto& postCircuitCollection = privilegeSetConfigureComponents;
 
 // ComponentIntegrity
-const static auto& getComponentIntegrity = privilegeSetLogin;
-const static auto& headComponentIntegrity = privilegeSetLogin;
-const static auto& patchComponentIntegrity = privilegeSetConfigureManager;
-const static auto& putComponentIntegrity = privilegeSetConfigureManager;
-const static auto& deleteComponentIntegrity = privilegeSetConfigureManager;
-const static auto& postComponentIntegrity = privilegeSetConfigureManager;
+static constexpr const auto& getComponentIntegrity = privilegeSetLogin;
+static constexpr const auto& headComponentIntegrity = privilegeSetLogin;
+static constexpr const auto& patchComponentIntegrity = privilegeSetConfigureManager;
+static constexpr const auto& putComponentIntegrity = privilegeSetConfigureManager;
+static constexpr const auto& deleteComponentIntegrity = privilegeSetConfigureManager;
+static constexpr const auto& postComponentIntegrity = privilegeSetConfigureManager;
 
 // ComponentIntegrityCollection
-const static auto& getComponentIntegrityCollection = privilegeSetLogin;
-const static auto& headComponentIntegrityCollection = privilegeSetLogin;
-const static auto& patchComponentIntegrityCollection = privilegeSetConfigureManager;
-const static auto& putComponentIntegrityCollection = privilegeSetConfigureManager;
-const static auto& deleteComponentIntegrityCollection = privilegeSetConfigureManager;
-const static auto& postComponentIntegrityCollection = privilegeSetConfigureManager;
+static constexpr const auto& getComponentIntegrityCollection = privilegeSetLogin;
+static constexpr const auto& headComponentIntegrityCollection = privilegeSetLogin;
+static constexpr const auto& patchComponentIntegrityCollection = privilegeSetConfigureManager;
+static constexpr const auto& putComponentIntegrityCollection = privilegeSetConfigureManager;
+static constexpr const auto& deleteComponentIntegrityCollection = privilegeSetConfigureManager;
+static constexpr const auto& postComponentIntegrityCollection = privilegeSetConfigureManager;
 
 // CompositionReservation
-const static auto& getCompositionReservation = privilegeSetLogin;
-const static auto& headCompositionReservation = privilegeSetLogin;
-const static auto& patchCompositionReservation = privilegeSetConfigureManager;
-const static auto& putCompositionReservation = privilegeSetConfigureManager;
-const static auto& deleteCompositionReservation = privilegeSetConfigureManager;
-const static auto& postCompositionReservation = privilegeSetConfigureManager;
+static constexpr const auto& getCompositionReservation = privilegeSetLogin;
+static constexpr const auto& headCompositionReservation = privilegeSetLogin;
+static constexpr const auto& patchCompositionReservation = privilegeSetConfigureManager;
+static constexpr const auto& putCompositionReservation = privilegeSetConfigureManager;
+static constexpr const auto& deleteCompositionReservation = privilegeSetConfigureManager;
+static constexpr const auto& postCompositionReservation = privilegeSetConfigureManager;
 
 // CompositionReservationCollection
-const static auto& getCompositionReservationCollection = privilegeSetLogin;
-const static auto& headCompositionReservationCollection = privilegeSetLogin;
-const static auto& patchCompositionReservationCollection = privilegeSetConfigureManager;
-const static auto& putCompositionReservationCollection = privilegeSetConfigureManager;
-const static auto& deleteCompositionReservationCollection = privilegeSetConfigureManager;
-const static auto& postCompositionReservationCollection = privilegeSetConfigureManager;
+static constexpr const auto& getCompositionReservationCollection = privilegeSetLogin;
+static constexpr const auto& headCompositionReservationCollection = privilegeSetLogin;
+static constexpr const auto& patchCompositionReservationCollection = privilegeSetConfigureManager;
+static constexpr const auto& putCompositionReservationCollection = privilegeSetConfigureManager;
+static constexpr const auto& deleteCompositionReservationCollection = privilegeSetConfigureManager;
+static constexpr const auto& postCompositionReservationCollection = privilegeSetConfigureManager;
 
 // CompositionService
-const static auto& getCompositionService = privilegeSetLogin;
-const static auto& headCompositionService = privilegeSetLogin;
-const static auto& patchCompositionService = privilegeSetConfigureManager;
-const static auto& putCompositionService = privilegeSetConfigureManager;
-const static auto& deleteCompositionService = privilegeSetConfigureManager;
-const static auto& postCompositionService = privilegeSetConfigureManager;
+static constexpr const auto& getCompositionService = privilegeSetLogin;
+static constexpr const auto& headCompositionService = privilegeSetLogin;
+static constexpr const auto& patchCompositionService = privilegeSetConfigureManager;
+static constexpr const auto& putCompositionService = privilegeSetConfigureManager;
+static constexpr const auto& deleteCompositionService = privilegeSetConfigureManager;
+static constexpr const auto& postCompositionService = privilegeSetConfigureManager;
 
 // ComputerSystem
-const static auto& getComputerSystem = privilegeSetLogin;
-const static auto& headComputerSystem = privilegeSetLogin;
-const static auto& patchComputerSystem = privilegeSetConfigureComponents;
-const static auto& postComputerSystem = privilegeSetConfigureComponents;
-const static auto& putComputerSystem = privilegeSetConfigureComponents;
-const static auto& deleteComputerSystem = privilegeSetConfigureComponents;
+static constexpr const auto& getComputerSystem = privilegeSetLogin;
+static constexpr const auto& headComputerSystem = privilegeSetLogin;
+static constexpr const auto& patchComputerSystem = privilegeSetConfigureComponents;
+static constexpr const auto& postComputerSystem = privilegeSetConfigureComponents;
+static constexpr const auto& putComputerSystem = privilegeSetConfigureComponents;
+static constexpr const auto& deleteComputerSystem = privilegeSetConfigureComponents;
 
 // ComputerSystemCollection
-const static auto& getComputerSystemCollection = privilegeSetLogin;
-const static auto& headComputerSystemCollection = privilegeSetLogin;
-const static auto& patchComputerSystemCollection = privilegeSetConfigureComponents;
-const static auto& postComputerSystemCollection = privilegeSetConfigureComponents;
-const static auto& putComputerSystemCollection = privilegeSetConfigureComponents;
-const static auto& deleteComputerSystemCollection = privilegeSetConfigureComponents;
+static constexpr const auto& getComputerSystemCollection = privilegeSetLogin;
+static constexpr const auto& headComputerSystemCollection = privilegeSetLogin;
+static constexpr const auto& patchComputerSystemCollection = privilegeSetConfigureComponents;
+static constexpr const auto& postComputerSystemCollection = privilegeSetConfigureComponents;
+static constexpr const auto& putComputerSystemCollection = privilegeSetConfigureComponents;
+static constexpr const auto& deleteComputerSystemCollection = privilegeSetConfigureComponents;
 
 // Connection
-const static auto& getConnection = privilegeSetLogin;
-const static auto& headConnection = privilegeSetLogin;
-const static auto& patchConnection = privilegeSetConfigureComponents;
-const static auto& postConnection = privilegeSetConfigureComponents;
-const static auto& putConnection = privilegeSetConfigureComponents;
-const static auto& deleteConnection = privilegeSetConfigureComponents;
+static constexpr const auto& getConnection = privilegeSetLogin;
+static constexpr const auto& headConnection = privilegeSetLogin;
+static constexpr const auto& patchConnection = privilegeSetConfigureComponents;
+static constexpr const auto& postConnection = privilegeSetConfigureComponents;
+static constexpr const auto& putConnection = privilegeSetConfigureComponents;
+static constexpr const auto& deleteConnection = privilegeSetConfigureComponents;
 
 // ConnectionCollection
-const static auto& getConnectionCollection = privilegeSetLogin;
-const static auto& headConnectionCollection = privilegeSetLogin;
-const static auto& patchConnectionCollection = privilegeSetConfigureComponents;
-const static auto& postConnectionCollection = privilegeSetConfigureComponents;
-const static auto& putConnectionCollection = privilegeSetConfigureComponents;
-const static auto& deleteConnectionCollection = privilegeSetConfigureComponents;
+static constexpr const auto& getConnectionCollection = privilegeSetLogin;
+static constexpr const auto& headConnectionCollection = privilegeSetLogin;
+static constexpr const auto& patchConnectionCollection = privilegeSetConfigureComponents;
+static constexpr const auto& postConnectionCollection = privilegeSetConfigureComponents;
+static constexpr const auto& putConnectionCollection = privilegeSetConfigureComponents;
+static constexpr const auto& deleteConnectionCollection = privilegeSetConfigureComponents;
 
 // ConnectionMethod
-const static auto& getConnectionMethod = privilegeSetLogin;
-const static auto& headConnectionMethod = privilegeSetLogin;
-const static auto& patchConnectionMethod = privilegeSetConfigureManager;
-const static auto& putConnectionMethod = privilegeSetConfigureManager;
-const static auto& deleteConnectionMethod = privilegeSetConfigureManager;
-const static auto& postConnectionMethod = privilegeSetConfigureManager;
+static constexpr const auto& getConnectionMethod = privilegeSetLogin;
+static constexpr const auto& headConnectionMethod = privilegeSetLogin;
+static constexpr const auto& patchConnectionMethod = privilegeSetConfigureManager;
+static constexpr const auto& putConnectionMethod = privilegeSetConfigureManager;
+static constexpr const auto& deleteConnectionMethod = privilegeSetConfigureManager;
+static constexpr const auto& postConnectionMethod = privilegeSetConfigureManager;
 
 // ConnectionMethodCollection
-const static auto& getConnectionMethodCollection = privilegeSetLogin;
-const static auto& headConnectionMethodCollection = privilegeSetLogin;
-const static auto& patchConnectionMethodCollection = privilegeSetConfigureManager;
-const static auto& putConnectionMethodCollection = privilegeSetConfigureManager;
-const static auto& deleteConnectionMethodCollection = privilegeSetConfigureManager;
-const static auto& postConnectionMethodCollection = privilegeSetConfigureManager;
+static constexpr const auto& getConnectionMethodCollection = privilegeSetLogin;
+static constexpr const auto& headConnectionMethodCollection = privilegeSetLogin;
+static constexpr const auto& patchConnectionMethodCollection = privilegeSetConfigureManager;
+static constexpr const auto& putConnectionMethodCollection = privilegeSetConfigureManager;
+static constexpr const auto& deleteConnectionMethodCollection = privilegeSetConfigureManager;
+static constexpr const auto& postConnectionMethodCollection = privilegeSetConfigureManager;
 
 // Container
-const static auto& getContainer = privilegeSetLogin;
-const static auto& headContainer = privilegeSetLogin;
-const static auto& patchContainer = privilegeSetConfigureComponents;
-const static auto& putContainer = privilegeSetConfigureComponents;
-const static auto& deleteContainer = privilegeSetConfigureComponents;
-const static auto& postContainer = privilegeSetConfigureComponents;
+static constexpr const auto& getContainer = privilegeSetLogin;
+static constexpr const auto& headContainer = privilegeSetLogin;
+static constexpr const auto& patchContainer = privilegeSetConfigureComponents;
+static constexpr const auto& putContainer = privilegeSetConfigureComponents;
+static constexpr const auto& deleteContainer = privilegeSetConfigureComponents;
+static constexpr const auto& postContainer = privilegeSetConfigureComponents;
 
 // ContainerCollection
-const static auto& getContainerCollection = privilegeSetLogin;
-const static auto& headContainerCollection = privilegeSetLogin;
-const static auto& patchContainerCollection = privilegeSetConfigureComponents;
-const static auto& putContainerCollection = privilegeSetConfigureComponents;
-const static auto& deleteContainerCollection = privilegeSetConfigureComponents;
-const static auto& postContainerCollection = privilegeSetConfigureComponents;
+static constexpr const auto& getContainerCollection = privilegeSetLogin;
+static constexpr const auto& headContainerCollection = privilegeSetLogin;
+static constexpr const auto& patchContainerCollection = privilegeSetConfigureComponents;
+static constexpr const auto& putContainerCollection = privilegeSetConfigureComponents;
+static constexpr const auto& deleteContainerCollection = privilegeSetConfigureComponents;
+static constexpr const auto& postContainerCollection = privilegeSetConfigureComponents;
 
 // ContainerImage
-const static auto& getContainerImage = privilegeSetLogin;
-const static auto& headContainerImage = privilegeSetLogin;
-const static auto& patchContainerImage = privilegeSetConfigureComponents;
-const static auto& putContainerImage = privilegeSetConfigureComponents;
-const static auto& deleteContainerImage = privilegeSetConfigureComponents;
-const static auto& postContainerImage = privilegeSetConfigureComponents;
+static constexpr const auto& getContainerImage = privilegeSetLogin;
+static constexpr const auto& headContainerImage = privilegeSetLogin;
+static constexpr const auto& patchContainerImage = privilegeSetConfigureComponents;
+static constexpr const auto& putContainerImage = privilegeSetConfigureComponents;
+static constexpr const auto& deleteContainerImage = privilegeSetConfigureComponents;
+static constexpr const auto& postContainerImage = privilegeSetConfigureComponents;
 
 // ContainerImageCollection
-const static auto& getContainerImageCollection = privilegeSetLogin;
-const static auto& headContainerImageCollection = privilegeSetLogin;
-const static auto& patchContainerImageCollection = privilegeSetConfigureComponents;
-const static auto& putContainerImageCollection = privilegeSetConfigureComponents;
-const static auto& deleteContainerImageCollection = privilegeSetConfigureComponents;
-const static auto& postContainerImageCollection = privilegeSetConfigureComponents;
+static constexpr const auto& getContainerImageCollection = privilegeSetLogin;
+static constexpr const auto& headContainerImageCollection = privilegeSetLogin;
+static constexpr const auto& patchContainerImageCollection = privilegeSetConfigureComponents;
+static constexpr const auto& putContainerImageCollection = privilegeSetConfigureComponents;
+static constexpr const auto& deleteContainerImageCollection = privilegeSetConfigureComponents;
+static constexpr const auto& postContainerImageCollection = privilegeSetConfigureComponents;
 
 // Control
-const static auto& getControl = privilegeSetLogin;
-const static auto& headControl = privilegeSetLogin;
-const static auto& patchControl = privilegeSetConfigureManager;
-const static auto& putControl = privilegeSetConfigureManager;
-const static auto& deleteControl = privilegeSetConfigureManager;
-const static auto& postControl = privilegeSetConfigureManager;
+static constexpr const auto& getControl = privilegeSetLogin;
+static constexpr const auto& headControl = privilegeSetLogin;
+static constexpr const auto& patchControl = privilegeSetConfigureManager;
+static constexpr const auto& putControl = privilegeSetConfigureManager;
+static constexpr const auto& deleteControl = privilegeSetConfigureManager;
+static constexpr const auto& postControl = privilegeSetConfigureManager;
 
 // ControlCollection
-const static auto& getControlCollection = privilegeSetLogin;
-const static auto& headControlCollection = privilegeSetLogin;
-const static auto& patchControlCollection = privilegeSetConfigureManager;
-const static auto& putControlCollection = privilegeSetConfigureManager;
-const static auto& deleteControlCollection = privilegeSetConfigureManager;
-const static auto& postControlCollection = privilegeSetConfigureManager;
+static constexpr const auto& getControlCollection = privilegeSetLogin;
+static constexpr const auto& headControlCollection = privilegeSetLogin;
+static constexpr const auto& patchControlCollection = privilegeSetConfigureManager;
+static constexpr const auto& putControlCollection = privilegeSetConfigureManager;
+static constexpr const auto& deleteControlCollection = privilegeSetConfigureManager;
+static constexpr const auto& postControlCollection = privilegeSetConfigureManager;
 
 // CoolantConnector
-const static auto& getCoolantConnector = privilegeSetLogin;
-const static auto& headCoolantConnector = privilegeSetLogin;
-const static auto& patchCoolantConnector = privilegeSetConfigureComponents;
-const static auto& putCoolantConnector = privilegeSetConfigureComponents;
-const static auto& deleteCoolantConnector = privilegeSetConfigureComponents;
-const static auto& postCoolantConnector = privilegeSetConfigureComponents;
+static constexpr const auto& getCoolantConnector = privilegeSetLogin;
+static constexpr const auto& headCoolantConnector = privilegeSetLogin;
+static constexpr const auto& patchCoolantConnector = privilegeSetConfigureComponents;
+static constexpr const auto& putCoolantConnector = privilegeSetConfigureComponents;
+static constexpr const auto& deleteCoolantConnector = privilegeSetConfigureComponents;
+static constexpr const auto& postCoolantConnector = privilegeSetConfigureComponents;
 
 // CoolantConnectorCollection
-const static auto& getCoolantConnectorCollection = privilegeSetLogin;
-const static auto& headCoolantConnectorCollection = privilegeSetLogin;
-const static auto& patchCoolantConnectorCollection = privilegeSetConfigureComponents;
-const static auto& putCoolantConnectorCollection = privilegeSetConfigureComponents;
-const static auto& deleteCoolantConnectorCollection = privilegeSetConfigureComponents;
-const static auto& postCoolantConnectorCollection = privilegeSetConfigureComponents;
+static constexpr const auto& getCoolantConnectorCollection = privilegeSetLogin;
+static constexpr const auto& headCoolantConnectorCollection = privilegeSetLogin;
+static constexpr const auto& patchCoolantConnectorCollection = privilegeSetConfigureComponents;
+static constexpr const auto& putCoolantConnectorCollection = privilegeSetConfigureComponents;
+static constexpr const auto& deleteCoolantConnectorCollection = privilegeSetConfigureComponents;
+static constexpr const auto& postCoolantConnectorCollection = privilegeSetConfigureComponents;
 
 // CoolingLoop
-const static auto& getCoolingLoop = privilegeSetLogin;
-const static auto& headCoolingLoop = privilegeSetLogin;
-const static auto& patchCoolingLoop = privilegeSetConfigureComponents;
-const static auto& putCoolingLoop = privilegeSetConfigureComponents;
-const static auto& deleteCoolingLoop = privilegeSetConfigureComponents;
-const static auto& postCoolingLoop = privilegeSetConfigureComponents;
+static constexpr const auto& getCoolingLoop = privilegeSetLogin;
+static constexpr const auto& headCoolingLoop = privilegeSetLogin;
+static constexpr const auto& patchCoolingLoop = privilegeSetConfigureComponents;
+static constexpr const auto& putCoolingLoop = privilegeSetConfigureComponents;
+static constexpr const auto& deleteCoolingLoop = privilegeSetConfigureComponents;
+static constexpr const auto& postCoolingLoop = privilegeSetConfigureComponents;
 
 // CoolingLoopCollection
-const static auto& getCoolingLoopCollection = privilegeSetLogin;
-const static auto& headCoolingLoopCollection = privilegeSetLogin;
-const static auto& patchCoolingLoopCollection = privilegeSetConfigureComponents;
-const static auto& putCoolingLoopCollection = privilegeSetConfigureComponents;
-const static auto& deleteCoolingLoopCollection = privilegeSetConfigureComponents;
-const static auto& postCoolingLoopCollection = privilegeSetConfigureComponents;
+static constexpr const auto& getCoolingLoopCollection = privilegeSetLogin;
+static constexpr const auto& headCoolingLoopCollection = privilegeSetLogin;
+static constexpr const auto& patchCoolingLoopCollection = privilegeSetConfigureComponents;
+static constexpr const auto& putCoolingLoopCollection = privilegeSetConfigureComponents;
+static constexpr const auto& deleteCoolingLoopCollection = privilegeSetConfigureComponents;
+static constexpr const auto& postCoolingLoopCollection = privilegeSetConfigureComponents;
 
 // CoolingUnit
-const static auto& getCoolingUnit = privilegeSetLogin;
-const static auto& headCoolingUnit = privilegeSetLogin;
-const static auto& patchCoolingUnit = privilegeSetConfigureComponents;
-const static auto& putCoolingUnit = privilegeSetConfigureComponents;
-const static auto& deleteCoolingUnit = privilegeSetConfigureComponents;
-const static auto& postCoolingUnit = privilegeSetConfigureComponents;
+static constexpr const auto& getCoolingUnit = privilegeSetLogin;
+static constexpr const auto& headCoolingUnit = privilegeSetLogin;
+static constexpr const auto& patchCoolingUnit = privilegeSetConfigureComponents;
+static constexpr const auto& putCoolingUnit = privilegeSetConfigureComponents;
+static constexpr const auto& deleteCoolingUnit = privilegeSetConfigureComponents;
+static constexpr const auto& postCoolingUnit = privilegeSetConfigureComponents;
 
 // CoolingUnitCollection
-const static auto& getCoolingUnitCollection = privilegeSetLogin;
-const static auto& headCoolingUnitCollection = privilegeSetLogin;
-const static auto& patchCoolingUnitCollection = privilegeSetConfigureComponents;
-const static auto& putCoolingUnitCollection = privilegeSetConfigureComponents;
-const static auto& deleteCoolingUnitCollection = privilegeSetConfigureComponents;
-const static auto& postCoolingUnitCollection = privilegeSetConfigureComponents;
+static constexpr const auto& getCoolingUnitCollection = privilegeSetLogin;
+static constexpr const auto& headCoolingUnitCollection = privilegeSetLogin;
+static constexpr const auto& patchCoolingUnitCollection = privilegeSetConfigureComponents;
+static constexpr const auto& putCoolingUnitCollection = privilegeSetConfigureComponents;
+static constexpr const auto& deleteCoolingUnitCollection = privilegeSetConfigureComponents;
+static constexpr const auto& postCoolingUnitCollection = privilegeSetConfigureComponents;
 
 // CXLLogicalDevice
-const static auto& getCXLLogicalDevice = privilegeSetLogin;
-const static auto& headCXLLogicalDevice = privilegeSetLogin;
-const static auto& patchCXLLogicalDevice = privilegeSetConfigureComponents;
-const static auto& putCXLLogicalDevice = privilegeSetConfigureComponents;
-const static auto& deleteCXLLogicalDevice = privilegeSetConfigureComponents;
-const static auto& postCXLLogicalDevice = privilegeSetConfigureComponents;
+static constexpr const auto& getCXLLogicalDevice = privilegeSetLogin;
+static constexpr const auto& headCXLLogicalDevice = privilegeSetLogin;
+static constexpr const auto& patchCXLLogicalDevice = privilegeSetConfigureComponents;
+static constexpr const auto& putCXLLogicalDevice = privilegeSetConfigureComponents;
+static constexpr const auto& deleteCXLLogicalDevice = privilegeSetConfigureComponents;
+static constexpr const auto& postCXLLogicalDevice = privilegeSetConfigureComponents;
 
 // CXLLogicalDeviceCollection
-const static auto& getCXLLogicalDeviceCollection = privilegeSetLogin;
-const static auto& headCXLLogicalDeviceCollection = privilegeSetLogin;
-const static auto& patchCXLLogicalDeviceCollection = privilegeSetConfigureComponents;
-const static auto& putCXLLogicalDeviceCollection = privilegeSetConfigureComponents;
-const static auto& deleteCXLLogicalDeviceCollection = privilegeSetConfigureComponents;
-const static auto& postCXLLogicalDeviceCollection = privilegeSetConfigureComponents;
+static constexpr const auto& getCXLLogicalDeviceCollection = privilegeSetLogin;
+static constexpr const auto& headCXLLogicalDeviceCollection = privilegeSetLogin;
+static constexpr const auto& patchCXLLogicalDeviceCollection = privilegeSetConfigureComponents;
+static constexpr const auto& putCXLLogicalDeviceCollection = privilegeSetConfigureComponents;
+static constexpr const auto& deleteCXLLogicalDeviceCollection = privilegeSetConfigureComponents;
+static constexpr const auto& postCXLLogicalDeviceCollection = privilegeSetConfigureComponents;
 
 // Drive
-const static auto& getDrive = privilegeSetLogin;
-const static auto& headDrive = privilegeSetLogin;
-const static auto& patchDrive = privilegeSetConfigureComponents;
-const static auto& postDrive = privilegeSetConfigureComponents;
-const static auto& putDrive = privilegeSetConfigureComponents;
-const static auto& deleteDrive = privilegeSetConfigureComponents;
+static constexpr const auto& getDrive = privilegeSetLogin;
+static constexpr const auto& headDrive = privilegeSetLogin;
+static constexpr const auto& patchDrive = privilegeSetConfigureComponents;
+static constexpr const auto& postDrive = privilegeSetConfigureComponents;
+static constexpr const auto& putDrive = privilegeSetConfigureComponents;
+static constexpr const auto& deleteDrive = privilegeSetConfigureComponents;
 
 // DriveCollection
-const static auto& getDriveCollection = privilegeSetLogin;
-const static auto& headDriveCollection = privilegeSetLogin;
-const static auto& patchDriveCollection = privilegeSetConfigureComponents;
-const static auto& postDriveCollection = privilegeSetConfigureComponents;
-const static auto& putDriveCollection = privilegeSetConfigureComponents;
-const static auto& deleteDriveCollection = privilegeSetConfigureComponents;
+static constexpr const auto& getDriveCollection = privilegeSetLogin;
+static constexpr const auto& headDriveCollection = privilegeSetLogin;
+static constexpr const auto& patchDriveCollection = privilegeSetConfigureComponents;
+static constexpr const auto& postDriveCollection = privilegeSetConfigureComponents;
+static constexpr const auto& putDriveCollection = privilegeSetConfigureComponents;
+static constexpr const auto& deleteDriveCollection = privilegeSetConfigureComponents;
 
 // DriveMetrics
-const static auto& getDriveMetrics = privilegeSetLogin;
-const static auto& headDriveMetrics = privilegeSetLogin;
-const static auto& patchDriveMetrics = privilegeSetConfigureComponents;
-const static auto& putDriveMetrics = privilegeSetConfigureComponents;
-const static auto& deleteDriveMetrics = privilegeSetConfigureComponents;
-const static auto& postDriveMetrics = privilegeSetConfigureComponents;
+static constexpr const auto& getDriveMetrics = privilegeSetLogin;
+static constexpr const auto& headDriveMetrics = privilegeSetLogin;
+static constexpr const auto& patchDriveMetrics = privilegeSetConfigureComponents;
+static constexpr const auto& putDriveMetrics = privilegeSetConfigureComponents;
+static constexpr const auto& deleteDriveMetrics = privilegeSetConfigureComponents;
+static constexpr const auto& postDriveMetrics = privilegeSetConfigureComponents;
 
 // Endpoint
-const static auto& getEndpoint = privilegeSetLogin;
-const static auto& headEndpoint = privilegeSetLogin;
-const static auto& patchEndpoint = privilegeSetConfigureComponents;
-const static auto& postEndpoint = privilegeSetConfigureComponents;
-const static auto& putEndpoint = privilegeSetConfigureComponents;
-const static auto& deleteEndpoint = privilegeSetConfigureComponents;
+static constexpr const auto& getEndpoint = privilegeSetLogin;
+static constexpr const auto& headEndpoint = privilegeSetLogin;
+static constexpr const auto& patchEndpoint = privilegeSetConfigureComponents;
+static constexpr const auto& postEndpoint = privilegeSetConfigureComponents;
+static constexpr const auto& putEndpoint = privilegeSetConfigureComponents;
+static constexpr const auto& deleteEndpoint = privilegeSetConfigureComponents;
 
 // EndpointCollection
-const static auto& getEndpointCollection = privilegeSetLogin;
-const static auto& headEndpointCollection = privilegeSetLogin;
-const static auto& patchEndpointCollection = privilegeSetConfigureComponents;
-const static auto& postEndpointCollection = privilegeSetConfigureComponents;
-const static auto& putEndpointCollection = privilegeSetConfigureComponents;
-const static auto& deleteEndpointCollection = privilegeSetConfigureComponents;
+static constexpr const auto& getEndpointCollection = privilegeSetLogin;
+static constexpr const auto& headEndpointCollection = privilegeSetLogin;
+static constexpr const auto& patchEndpointCollection = privilegeSetConfigureComponents;
+static constexpr const auto& postEndpointCollection = privilegeSetConfigureComponents;
+static constexpr const auto& putEndpointCollection = privilegeSetConfigureComponents;
+static constexpr const auto& deleteEndpointCollection = privilegeSetConfigureComponents;
 
 // EndpointGroup
-const static auto& getEndpointGroup = privilegeSetLogin;
-const static auto& headEndpointGroup = privilegeSetLogin;
-const static auto& patchEndpointGroup = privilegeSetConfigureComponents;
-const static auto& postEndpointGroup = privilegeSetConfigureComponents;
-const static auto& putEndpointGroup = privilegeSetConfigureComponents;
-const static auto& deleteEndpointGroup = privilegeSetConfigureComponents;
+static constexpr const auto& getEndpointGroup = privilegeSetLogin;
+static constexpr const auto& headEndpointGroup = privilegeSetLogin;
+static constexpr const auto& patchEndpointGroup = privilegeSetConfigureComponents;
+static constexpr const auto& postEndpointGroup = privilegeSetConfigureComponents;
+static constexpr const auto& putEndpointGroup = privilegeSetConfigureComponents;
+static constexpr const auto& deleteEndpointGroup = privilegeSetConfigureComponents;
 
 // EndpointGroupCollection
-const static auto& getEndpointGroupCollection = privilegeSetLogin;
-const static auto& headEndpointGroupCollection = privilegeSetLogin;
-const static auto& patchEndpointGroupCollection = privilegeSetConfigureComponents;
-const static auto& postEndpointGroupCollection = privilegeSetConfigureComponents;
-const static auto& putEndpointGroupCollection = privilegeSetConfigureComponents;
-const static auto& deleteEndpointGroupCollection = privilegeSetConfigureComponents;
+static constexpr const auto& getEndpointGroupCollection = privilegeSetLogin;
+static constexpr const auto& headEndpointGroupCollection = privilegeSetLogin;
+static constexpr const auto& patchEndpointGroupCollection = privilegeSetConfigureComponents;
+static constexpr const auto& postEndpointGroupCollection = privilegeSetConfigureComponents;
+static constexpr const auto& putEndpointGroupCollection = privilegeSetConfigureComponents;
+static constexpr const auto& deleteEndpointGroupCollection = privilegeSetConfigureComponents;
 
 // EnvironmentMetrics
-const static auto& getEnvironmentMetrics = privilegeSetLogin;
-const static auto& headEnvironmentMetrics = privilegeSetLogin;
-const static auto& patchEnvironmentMetrics = privilegeSetConfigureManager;
-const static auto& putEnvironmentMetrics = privilegeSetConfigureManager;
-const static auto& deleteEnvironmentMetrics = privilegeSetConfigureManager;
-const static auto& postEnvironmentMetrics = privilegeSetConfigureManager;
+static constexpr const auto& getEnvironmentMetrics = privilegeSetLogin;
+static constexpr const auto& headEnvironmentMetrics = privilegeSetLogin;
+static constexpr const auto& patchEnvironmentMetrics = privilegeSetConfigureManager;
+static constexpr const auto& putEnvironmentMetrics = privilegeSetConfigureManager;
+static constexpr const auto& deleteEnvironmentMetrics = privilegeSetConfigureManager;
+static constexpr const auto& postEnvironmentMetrics = privilegeSetConfigureManager;
 
 // EthernetInterface
-const static auto& getEthernetInterface = privilegeSetLogin;
-const static auto& headEthernetInterface = privilegeSetLogin;
-const static auto& patchEthernetInterface = privilegeSetConfigureComponents;
-const static auto& postEthernetInterface = privilegeSetConfigureComponents;
-const static auto& putEthernetInterface = privilegeSetConfigureComponents;
-const static auto& deleteEthernetInterface = privilegeSetConfigureComponents;
+static constexpr const auto& getEthernetInterface = privilegeSetLogin;
+static constexpr const auto& headEthernetInterface = privilegeSetLogin;
+static constexpr const auto& patchEthernetInterface = privilegeSetConfigureComponents;
+static constexpr const auto& postEthernetInterface = privilegeSetConfigureComponents;
+static constexpr const auto& putEthernetInterface = privilegeSetConfigureComponents;
+static constexpr const auto& deleteEthernetInterface = privilegeSetConfigureComponents;
 
 // EthernetInterfaceCollection
-const static auto& getEthernetInterfaceCollection = privilegeSetLogin;
-const static auto& headEthernetInterfaceCollection = privilegeSetLogin;
-const static auto& patchEthernetInterfaceCollection = privilegeSetConfigureComponents;
-const static auto& postEthernetInterfaceCollection = privilegeSetConfigureComponents;
-const static auto& putEthernetInterfaceCollection = privilegeSetConfigureComponents;
-const static auto& deleteEthernetInterfaceCollection = privilegeSetConfigureComponents;
+static constexpr const auto& getEthernetInterfaceCollection = privilegeSetLogin;
+static constexpr const auto& headEthernetInterfaceCollection = privilegeSetLogin;
+static constexpr const auto& patchEthernetInterfaceCollection = privilegeSetConfigureComponents;
+static constexpr const auto& postEthernetInterfaceCollection = privilegeSetConfigureComponents;
+static constexpr const auto& putEthernetInterfaceCollection = privilegeSetConfigureComponents;
+static constexpr const auto& deleteEthernetInterfaceCollection = privilegeSetConfigureComponents;
 
 // EventDestination
-const static auto& getEventDestination = privilegeSetLogin;
-const static auto& headEventDestination = privilegeSetLogin;
-const static auto& patchEventDestination = privilegeSetConfigureManagerOrConfigureSelf;
-const static auto& postEventDestination = privilegeSetConfigureManagerOrConfigureSelf;
-const static auto& putEventDestination = privilegeSetConfigureManagerOrConfigureSelf;
-const static auto& deleteEventDestination = privilegeSetConfigureManagerOrConfigureSelf;
+static constexpr const auto& getEventDestination = privilegeSetLogin;
+static constexpr const auto& headEventDestination = privilegeSetLogin;
+static constexpr const auto& patchEventDestination = privilegeSetConfigureManagerOrConfigureSelf;
+static constexpr const auto& postEventDestination = privilegeSetConfigureManagerOrConfigureSelf;
+static constexpr const auto& putEventDestination = privilegeSetConfigureManagerOrConfigureSelf;
+static constexpr const auto& deleteEventDestination = privilegeSetConfigureManagerOrConfigureSelf;
 
 // EventDestinationCollection
-const static auto& getEventDestinationCollection = privilegeSetLogin;
-const static auto& headEventDestinationCollection = privilegeSetLogin;
-const static auto& patchEventDestinationCollection = privilegeSetConfigureManagerOrConfigureComponents;
-const static auto& postEventDestinationCollection = privilegeSetConfigureManagerOrConfigureComponents;
-const static auto& putEventDestinationCollection = privilegeSetConfigureManagerOrConfigureComponents;
-const static auto& deleteEventDestinationCollection = privilegeSetConfigureManagerOrConfigureComponents;
+static constexpr const auto& getEventDestinationCollection = privilegeSetLogin;
+static constexpr const auto& headEventDestinationCollection = privilegeSetLogin;
+static constexpr const auto& patchEventDestinationCollection = privilegeSetConfigureManagerOrConfigureComponents;
+static constexpr const auto& postEventDestinationCollection = privilegeSetConfigureManagerOrConfigureComponents;
+static constexpr const auto& putEventDestinationCollection = privilegeSetConfigureManagerOrConfigureComponents;
+static constexpr const auto& deleteEventDestinationCollection = privilegeSetConfigureManagerOrConfigureComponents;
 
 // EventService
-const static auto& getEventService = privilegeSetLogin;
-const static auto& headEventService = privilegeSetLogin;
-const static auto& patchEventService = privilegeSetConfigureManager;
-const static auto& postEventService = privilegeSetConfigureManager;
-const static auto& putEventService = privilegeSetConfigureManager;
-const static auto& deleteEventService = privilegeSetConfigureManager;
+static constexpr const auto& getEventService = privilegeSetLogin;
+static constexpr const auto& headEventService = privilegeSetLogin;
+static constexpr const auto& patchEventService = privilegeSetConfigureManager;
+static constexpr const auto& postEventService = privilegeSetConfigureManager;
+static constexpr const auto& putEventService = privilegeSetConfigureManager;
+static constexpr const auto& deleteEventService = privilegeSetConfigureManager;
 
 // ExternalAccountProvider
-const static auto& getExternalAccountProvider = privilegeSetLogin;
-const static auto& headExternalAccountProvider = privilegeSetLogin;
-const static auto& patchExternalAccountProvider = privilegeSetConfigureManager;
-const static auto& putExternalAccountProvider = privilegeSetConfigureManager;
-const static auto& deleteExternalAccountProvider = privilegeSetConfigureManager;
-const static auto& postExternalAccountProvider = privilegeSetConfigureManager;
+static constexpr const auto& getExternalAccountProvider = privilegeSetLogin;
+static constexpr const auto& headExternalAccountProvider = privilegeSetLogin;
+static constexpr const auto& patchExternalAccountProvider = privilegeSetConfigureManager;
+static constexpr const auto& putExternalAccountProvider = privilegeSetConfigureManager;
+static constexpr const auto& deleteExternalAccountProvider = privilegeSetConfigureManager;
+static constexpr const auto& postExternalAccountProvider = privilegeSetConfigureManager;
 
 // ExternalAccountProviderCollection
-const static auto& getExternalAccountProviderCollection = privilegeSetLogin;
-const static auto& headExternalAccountProviderCollection = privilegeSetLogin;
-const static auto& patchExternalAccountProviderCollection = privilegeSetConfigureManager;
-const static auto& putExternalAccountProviderCollection = privilegeSetConfigureManager;
-const static auto& deleteExternalAccountProviderCollection = privilegeSetConfigureManager;
-const static auto& postExternalAccountProviderCollection = privilegeSetConfigureManager;
+static constexpr const auto& getExternalAccountProviderCollection = privilegeSetLogin;
+static constexpr const auto& headExternalAccountProviderCollection = privilegeSetLogin;
+static constexpr const auto& patchExternalAccountProviderCollection = privilegeSetConfigureManager;
+static constexpr const auto& putExternalAccountProviderCollection = privilegeSetConfigureManager;
+static constexpr const auto& deleteExternalAccountProviderCollection = privilegeSetConfigureManager;
+static constexpr const auto& postExternalAccountProviderCollection = privilegeSetConfigureManager;
 
 // Fabric
-const static auto& getFabric = privilegeSetLogin;
-const static auto& headFabric = privilegeSetLogin;
-const static auto& patchFabric = privilegeSetConfigureComponents;
-const static auto& postFabric = privilegeSetConfigureComponents;
-const static auto& putFabric = privilegeSetConfigureComponents;
-const static auto& deleteFabric = privilegeSetConfigureComponents;
+static constexpr const auto& getFabric = privilegeSetLogin;
+static constexpr const auto& headFabric = privilegeSetLogin;
+static constexpr const auto& patchFabric = privilegeSetConfigureComponents;
+static constexpr const auto& postFabric = privilegeSetConfigureComponents;
+static constexpr const auto& putFabric = privilegeSetConfigureComponents;
+static constexpr const auto& deleteFabric = privilegeSetConfigureComponents;
 
 // FabricCollection
-const static auto& getFabricCollection = privilegeSetLogin;
-const static auto& headFabricCollection = privilegeSetLogin;
-const static auto& patchFabricCollection = privilegeSetConfigureComponents;
-const static auto& postFabricCollection = privilegeSetConfigureComponents;
-const static auto& putFabricCollection = privilegeSetConfigureComponents;
-const static auto& deleteFabricCollection = privilegeSetConfigureComponents;
+static constexpr const auto& getFabricCollection = privilegeSetLogin;
+static constexpr const auto& headFabricCollection = privilegeSetLogin;
+static constexpr const auto& patchFabricCollection = privilegeSetConfigureComponents;
+static constexpr const auto& postFabricCollection = privilegeSetConfigureComponents;
+static constexpr const auto& putFabricCollection = privilegeSetConfigureComponents;
+static constexpr const auto& deleteFabricCollection = privilegeSetConfigureComponents;
 
 // FabricAdapter
-const static auto& getFabricAdapter = privilegeSetLogin;
-const static auto& headFabricAdapter = privilegeSetLogin;
-const static auto& patchFabricAdapter = privilegeSetConfigureComponents;
-const static auto& postFabricAdapter = privilegeSetConfigureComponents;
-const static auto& putFabricAdapter = privilegeSetConfigureComponents;
-const static auto& deleteFabricAdapter = privilegeSetConfigureComponents;
+static constexpr const auto& getFabricAdapter = privilegeSetLogin;
+static constexpr const auto& headFabricAdapter = privilegeSetLogin;
+static constexpr const auto& patchFabricAdapter = privilegeSetConfigureComponents;
+static constexpr const auto& postFabricAdapter = privilegeSetConfigureComponents;
+static constexpr const auto& putFabricAdapter = privilegeSetConfigureComponents;
+static constexpr const auto& deleteFabricAdapter = privilegeSetConfigureComponents;
 
 // FabricAdapterCollection
-const static auto& getFabricAdapterCollection = privilegeSetLogin;
-const static auto& headFabricAdapterCollection = privilegeSetLogin;
-const static auto& patchFabricAdapterCollection = privilegeSetConfigureComponents;
-const static auto& postFabricAdapterCollection = privilegeSetConfigureComponents;
-const static auto& putFabricAdapterCollection = privilegeSetConfigureComponents;
-const static auto& deleteFabricAdapterCollection = privilegeSetConfigureComponents;
+static constexpr const auto& getFabricAdapterCollection = privilegeSetLogin;
+static constexpr const auto& headFabricAdapterCollection = privilegeSetLogin;
+static constexpr const auto& patchFabricAdapterCollection = privilegeSetConfigureComponents;
+static constexpr const auto& postFabricAdapterCollection = privilegeSetConfigureComponents;
+static constexpr const auto& putFabricAdapterCollection = privilegeSetConfigureComponents;
+static constexpr const auto& deleteFabricAdapterCollection = privilegeSetConfigureComponents;
 
 // Facility
-const static auto& getFacility = privilegeSetLogin;
-const static auto& headFacility = privilegeSetLogin;
-const static auto& patchFacility = privilegeSetConfigureComponents;
-const static auto& putFacility = privilegeSetConfigureComponents;
-const static auto& deleteFacility = privilegeSetConfigureComponents;
-const static auto& postFacility = privilegeSetConfigureComponents;
+static constexpr const auto& getFacility = privilegeSetLogin;
+static constexpr const auto& headFacility = privilegeSetLogin;
+static constexpr const auto& patchFacility = privilegeSetConfigureComponents;
+static constexpr const auto& putFacility = privilegeSetConfigureComponents;
+static constexpr const auto& deleteFacility = privilegeSetConfigureComponents;
+static constexpr const auto& postFacility = privilegeSetConfigureComponents;
 
 // FacilityCollection
-const static auto& getFacilityCollection = privilegeSetLogin;
-const static auto& headFacilityCollection = privilegeSetLogin;
-const static auto& patchFacilityCollection = privilegeSetConfigureComponents;
-const static auto& putFacilityCollection = privilegeSetConfigureComponents;
-const static auto& deleteFacilityCollection = privilegeSetConfigureComponents;
-const static auto& postFacilityCollection = privilegeSetConfigureComponents;
+static constexpr const auto& getFacilityCollection = privilegeSetLogin;
+static constexpr const auto& headFacilityCollection = privilegeSetLogin;
+static constexpr const auto& patchFacilityCollection = privilegeSetConfigureComponents;
+static constexpr const auto& putFacilityCollection = privilegeSetConfigureComponents;
+static constexpr const auto& deleteFacilityCollection = privilegeSetConfigureComponents;
+static constexpr const auto& postFacilityCollection = privilegeSetConfigureComponents;
 
 // Fan
-const static auto& getFan = privilegeSetLogin;
-const static auto& headFan = privilegeSetLogin;
-const static auto& patchFan = privilegeSetConfigureManager;
-const static auto& putFan = privilegeSetConfigureManager;
-const static auto& deleteFan = privilegeSetConfigureManager;
-const static auto& postFan = privilegeSetConfigureManager;
+static constexpr const auto& getFan = privilegeSetLogin;
+static constexpr const auto& headFan = privilegeSetLogin;
+static constexpr const auto& patchFan = privilegeSetConfigureManager;
+static constexpr const auto& putFan = privilegeSetConfigureManager;
+static constexpr const auto& deleteFan = privilegeSetConfigureManager;
+static constexpr const auto& postFan = privilegeSetConfigureManager;
 
 // FanCollection
-const static auto& getFanCollection = privilegeSetLogin;
-const static auto& headFanCollection = privilegeSetLogin;
-const static auto& patchFanCollection = privilegeSetConfigureManager;
-const static auto& putFanCollection = privilegeSetConfigureManager;
-const static auto& deleteFanCollection = privilegeSetConfigureManager;
-const static auto& postFanCollection = privilegeSetConfigureManager;
+static constexpr const auto& getFanCollection = privilegeSetLogin;
+static constexpr const auto& headFanCollection = privilegeSetLogin;
+static constexpr const auto& patchFanCollection = privilegeSetConfigureManager;
+static constexpr const auto& putFanCollection = privilegeSetConfigureManager;
+static constexpr const auto& deleteFanCollection = privilegeSetConfigureManager;
+static constexpr const auto& postFanCollection = privilegeSetConfigureManager;
 
 // Filter
-const static auto& getFilter = privilegeSetLogin;
-const static auto& headFilter = privilegeSetLogin;
-const static auto& patchFilter = privilegeSetConfigureComponents;
-const static auto& putFilter = privilegeSetConfigureComponents;
-const static auto& deleteFilter = privilegeSetConfigureComponents;
-const static auto& postFilter = privilegeSetConfigureComponents;
+static constexpr const auto& getFilter = privilegeSetLogin;
+static constexpr const auto& headFilter = privilegeSetLogin;
+static constexpr const auto& patchFilter = privilegeSetConfigureComponents;
+static constexpr const auto& putFilter = privilegeSetConfigureComponents;
+static constexpr const auto& deleteFilter = privilegeSetConfigureComponents;
+static constexpr const auto& postFilter = privilegeSetConfigureComponents;
 
 // FilterCollection
-const static auto& getFilterCollection = privilegeSetLogin;
-const static auto& headFilterCollection = privilegeSetLogin;
-const static auto& patchFilterCollection = privilegeSetConfigureComponents;
-const static auto& putFilterCollection = privilegeSetConfigureComponents;
-const static auto& deleteFilterCollection = privilegeSetConfigureComponents;
-const static auto& postFilterCollection = privilegeSetConfigureComponents;
+static constexpr const auto& getFilterCollection = privilegeSetLogin;
+static constexpr const auto& headFilterCollection = privilegeSetLogin;
+static constexpr const auto& patchFilterCollection = privilegeSetConfigureComponents;
+static constexpr const auto& putFilterCollection = privilegeSetConfigureComponents;
+static constexpr const auto& deleteFilterCollection = privilegeSetConfigureComponents;
+static constexpr const auto& postFilterCollection = privilegeSetConfigureComponents;
 
 // GraphicsController
-const static auto& getGraphicsController = privilegeSetLogin;
-const static auto& headGraphicsController = privilegeSetLogin;
-const static auto& patchGraphicsController = privilegeSetConfigureComponents;
-const static auto& putGraphicsController = privilegeSetConfigureComponents;
-const static auto& deleteGraphicsController = privilegeSetConfigureComponents;
-const static auto& postGraphicsController = privilegeSetConfigureComponents;
+static constexpr const auto& getGraphicsController = privilegeSetLogin;
+static constexpr const auto& headGraphicsController = privilegeSetLogin;
+static constexpr const auto& patchGraphicsController = privilegeSetConfigureComponents;
+static constexpr const auto& putGraphicsController = privilegeSetConfigureComponents;
+static constexpr const auto& deleteGraphicsController = privilegeSetConfigureComponents;
+static constexpr const auto& postGraphicsController = privilegeSetConfigureComponents;
 
 // GraphicsControllerCollection
-const static auto& getGraphicsControllerCollection = privilegeSetLogin;
-const static auto& headGraphicsControllerCollection = privilegeSetLogin;
-const static auto& patchGraphicsControllerCollection = privilegeSetConfigureComponents;
-const static auto& putGraphicsControllerCollection = privilegeSetConfigureComponents;
-const static auto& deleteGraphicsControllerCollection = privilegeSetConfigureComponents;
-const static auto& postGraphicsControllerCollection = privilegeSetConfigureComponents;
+static constexpr const auto& getGraphicsControllerCollection = privilegeSetLogin;
+static constexpr const auto& headGraphicsControllerCollection = privilegeSetLogin;
+static constexpr const auto& patchGraphicsControllerCollection = privilegeSetConfigureComponents;
+static constexpr const auto& putGraphicsControllerCollection = privilegeSetConfigureComponents;
+static constexpr const auto& deleteGraphicsControllerCollection = privilegeSetConfigureComponents;
+static constexpr const auto& postGraphicsControllerCollection = privilegeSetConfigureComponents;
 
 // Heater
-const static auto& getHeater = privilegeSetLogin;
-const static auto& headHeater = privilegeSetLogin;
-const static auto& patchHeater = privilegeSetConfigureManager;
-const static auto& putHeater = privilegeSetConfigureManager;
-const static auto& deleteHeater = privilegeSetConfigureManager;
-const static auto& postHeater = privilegeSetConfigureManager;
+static constexpr const auto& getHeater = privilegeSetLogin;
+static constexpr const auto& headHeater = privilegeSetLogin;
+static constexpr const auto& patchHeater = privilegeSetConfigureManager;
+static constexpr const auto& putHeater = privilegeSetConfigureManager;
+static constexpr const auto& deleteHeater = privilegeSetConfigureManager;
+static constexpr const auto& postHeater = privilegeSetConfigureManager;
 
 // HeaterCollection
-const static auto& getHeaterCollection = privilegeSetLogin;
-const static auto& headHeaterCollection = privilegeSetLogin;
-const static auto& patchHeaterCollection = privilegeSetConfigureManager;
-const static auto& putHeaterCollection = privilegeSetConfigureManager;
-const static auto& deleteHeaterCollection = privilegeSetConfigureManager;
-const static auto& postHeaterCollection = privilegeSetConfigureManager;
+static constexpr const auto& getHeaterCollection = privilegeSetLogin;
+static constexpr const auto& headHeaterCollection = privilegeSetLogin;
+static constexpr const auto& patchHeaterCollection = privilegeSetConfigureManager;
+static constexpr const auto& putHeaterCollection = privilegeSetConfigureManager;
+static constexpr const auto& deleteHeaterCollection = privilegeSetConfigureManager;
+static constexpr const auto& postHeaterCollection = privilegeSetConfigureManager;
 
 // HeaterMetrics
-const static auto& getHeaterMetrics = privilegeSetLogin;
-const static auto& headHeaterMetrics = privilegeSetLogin;
-const static auto& patchHeaterMetrics = privilegeSetConfigureManager;
-const static auto& putHeaterMetrics = privilegeSetConfigureManager;
-const static auto& deleteHeaterMetrics = privilegeSetConfigureManager;
-const static auto& postHeaterMetrics = privilegeSetConfigureManager;
+static constexpr const auto& getHeaterMetrics = privilegeSetLogin;
+static constexpr const auto& headHeaterMetrics = privilegeSetLogin;
+static constexpr const auto& patchHeaterMetrics = privilegeSetConfigureManager;
+static constexpr const auto& putHeaterMetrics = privilegeSetConfigureManager;
+static constexpr const auto& deleteHeaterMetrics = privilegeSetConfigureManager;
+static constexpr const auto& postHeaterMetrics = privilegeSetConfigureManager;
 
 // HostInterface
-const static auto& getHostInterface = privilegeSetLogin;
-const static auto& headHostInterface = privilegeSetLogin;
-const static auto& patchHostInterface = privilegeSetConfigureManager;
-const static auto& postHostInterface = privilegeSetConfigureManager;
-const static auto& putHostInterface = privilegeSetConfigureManager;
-const static auto& deleteHostInterface = privilegeSetConfigureManager;
+static constexpr const auto& getHostInterface = privilegeSetLogin;
+static constexpr const auto& headHostInterface = privilegeSetLogin;
+static constexpr const auto& patchHostInterface = privilegeSetConfigureManager;
+static constexpr const auto& postHostInterface = privilegeSetConfigureManager;
+static constexpr const auto& putHostInterface = privilegeSetConfigureManager;
+static constexpr const auto& deleteHostInterface = privilegeSetConfigureManager;
 
 // HostInterfaceCollection
-const static auto& getHostInterfaceCollection = privilegeSetLogin;
-const static auto& headHostInterfaceCollection = privilegeSetLogin;
-const static auto& patchHostInterfaceCollection = privilegeSetConfigureManager;
-const static auto& postHostInterfaceCollection = privilegeSetConfigureManager;
-const static auto& putHostInterfaceCollection = privilegeSetConfigureManager;
-const static auto& deleteHostInterfaceCollection = privilegeSetConfigureManager;
+static constexpr const auto& getHostInterfaceCollection = privilegeSetLogin;
+static constexpr const auto& headHostInterfaceCollection = privilegeSetLogin;
+static constexpr const auto& patchHostInterfaceCollection = privilegeSetConfigureManager;
+static constexpr const auto& postHostInterfaceCollection = privilegeSetConfigureManager;
+static constexpr const auto& putHostInterfaceCollection = privilegeSetConfigureManager;
+static constexpr const auto& deleteHostInterfaceCollection = privilegeSetConfigureManager;
 
 // Job
-const static auto& getJob = privilegeSetLogin;
-const static auto& headJob = privilegeSetLogin;
-const static auto& patchJob = privilegeSetConfigureManager;
-const static auto& putJob = privilegeSetConfigureManager;
-const static auto& deleteJob = privilegeSetConfigureManager;
-const static auto& postJob = privilegeSetConfigureManager;
+static constexpr const auto& getJob = privilegeSetLogin;
+static constexpr const auto& headJob = privilegeSetLogin;
+static constexpr const auto& patchJob = privilegeSetConfigureManager;
+static constexpr const auto& putJob = privilegeSetConfigureManager;
+static constexpr const auto& deleteJob = privilegeSetConfigureManager;
+static constexpr const auto& postJob = privilegeSetConfigureManager;
 
 // JobCollection
-const static auto& getJobCollection = privilegeSetLogin;
-const static auto& headJobCollection = privilegeSetLogin;
-const static auto& patchJobCollection = privilegeSetConfigureManager;
-const static auto& putJobCollection = privilegeSetConfigureManager;
-const static auto& deleteJobCollection = privilegeSetConfigureManager;
-const static auto& postJobCollection = privilegeSetConfigureManager;
+static constexpr const auto& getJobCollection = privilegeSetLogin;
+static constexpr const auto& headJobCollection = privilegeSetLogin;
+static constexpr const auto& patchJobCollection = privilegeSetConfigureManager;
+static constexpr const auto& putJobCollection = privilegeSetConfigureManager;
+static constexpr const auto& deleteJobCollection = privilegeSetConfigureManager;
+static constexpr const auto& postJobCollection = privilegeSetConfigureManager;
 
 // JobService
-const static auto& getJobService = privilegeSetLogin;
-const static auto& headJobService = privilegeSetLogin;
-const static auto& patchJobService = privilegeSetConfigureManager;
-const static auto& putJobService = privilegeSetConfigureManager;
-const static auto& deleteJobService = privilegeSetConfigureManager;
-const static auto& postJobService = privilegeSetConfigureManager;
+static constexpr const auto& getJobService = privilegeSetLogin;
+static constexpr const auto& headJobService = privilegeSetLogin;
+static constexpr const auto& patchJobService = privilegeSetConfigureManager;
+static constexpr const auto& putJobService = privilegeSetConfigureManager;
+static constexpr const auto& deleteJobService = privilegeSetConfigureManager;
+static constexpr const auto& postJobService = privilegeSetConfigureManager;
 
 // JsonSchemaFile
-const static auto& getJsonSchemaFile = privilegeSetLogin;
-const static auto& headJsonSchemaFile = privilegeSetLogin;
-const static auto& patchJsonSchemaFile = privilegeSetConfigureManager;
-const static auto& postJsonSchemaFile = privilegeSetConfigureManager;
-const static auto& putJsonSchemaFile = privilegeSetConfigureManager;
-const static auto& deleteJsonSchemaFile = privilegeSetConfigureManager;
+static constexpr const auto& getJsonSchemaFile = privilegeSetLogin;
+static constexpr const auto& headJsonSchemaFile = privilegeSetLogin;
+static constexpr const auto& patchJsonSchemaFile = privilegeSetConfigureManager;
+static constexpr const auto& postJsonSchemaFile = privilegeSetConfigureManager;
+static constexpr const auto& putJsonSchemaFile = privilegeSetConfigureManager;
+static constexpr const auto& deleteJsonSchemaFile = privilegeSetConfigureManager;
 
 // JsonSchemaFileCollection
-const static auto& getJsonSchemaFileCollection = privilegeSetLogin;
-const static auto& headJsonSchemaFileCollection = privilegeSetLogin;
-const static auto& patchJsonSchemaFileCollection = privilegeSetConfigureManager;
-const static auto& postJsonSchemaFileCollection = privilegeSetConfigureManager;
-const static auto& putJsonSchemaFileCollection = privilegeSetConfigureManager;
-const static auto& deleteJsonSchemaFileCollection = privilegeSetConfigureManager;
+static constexpr const auto& getJsonSchemaFileCollection = privilegeSetLogin;
+static constexpr const auto& headJsonSchemaFileCollection = privilegeSetLogin;
+static constexpr const auto& patchJsonSchemaFileCollection = privilegeSetConfigureManager;
+static constexpr const auto& postJsonSchemaFileCollection = privilegeSetConfigureManager;
+static constexpr const auto& putJsonSchemaFileCollection = privilegeSetConfigureManager;
+static constexpr const auto& deleteJsonSchemaFileCollection = privilegeSetConfigureManager;
 
 // Key
-const static auto& getKey = privilegeSetLogin;
-const static auto& headKey = privilegeSetLogin;
-const static auto& patchKey = privilegeSetConfigureManager;
-const static auto& putKey = privilegeSetConfigureManager;
-const static auto& deleteKey = privilegeSetConfigureManager;
-const static auto& postKey = privilegeSetConfigureManager;
+static constexpr const auto& getKey = privilegeSetLogin;
+static constexpr const auto& headKey = privilegeSetLogin;
+static constexpr const auto& patchKey = privilegeSetConfigureManager;
+static constexpr const auto& putKey = privilegeSetConfigureManager;
+static constexpr const auto& deleteKey = privilegeSetConfigureManager;
+static constexpr const auto& postKey = privilegeSetConfigureManager;
 
 // KeyCollection
-const static auto& getKeyCollection = privilegeSetLogin;
-const static auto& headKeyCollection = privilegeSetLogin;
-const static auto& patchKeyCollection = privilegeSetConfigureManager;
-const static auto& putKeyCollection = privilegeSetConfigureManager;
-const static auto& deleteKeyCollection = privilegeSetConfigureManager;
-const static auto& postKeyCollection = privilegeSetConfigureManager;
+static constexpr const auto& getKeyCollection = privilegeSetLogin;
+static constexpr const auto& headKeyCollection = privilegeSetLogin;
+static constexpr const auto& patchKeyCollection = privilegeSetConfigureManager;
+static constexpr const auto& putKeyCollection = privilegeSetConfigureManager;
+static constexpr const auto& deleteKeyCollection = privilegeSetConfigureManager;
+static constexpr const auto& postKeyCollection = privilegeSetConfigureManager;
 
 // KeyPolicy
-const static auto& getKeyPolicy = privilegeSetLogin;
-const static auto& headKeyPolicy = privilegeSetLogin;
-const static auto& patchKeyPolicy = privilegeSetConfigureManager;
-const static auto& putKeyPolicy = privilegeSetConfigureManager;
-const static auto& deleteKeyPolicy = privilegeSetConfigureManager;
-const static auto& postKeyPolicy = privilegeSetConfigureManager;
+static constexpr const auto& getKeyPolicy = privilegeSetLogin;
+static constexpr const auto& headKeyPolicy = privilegeSetLogin;
+static constexpr const auto& patchKeyPolicy = privilegeSetConfigureManager;
+static constexpr const auto& putKeyPolicy = privilegeSetConfigureManager;
+static constexpr const auto& deleteKeyPolicy = privilegeSetConfigureManager;
+static constexpr const auto& postKeyPolicy = privilegeSetConfigureManager;
 
 // KeyPolicyCollection
-const static auto& getKeyPolicyCollection = privilegeSetLogin;
-const static auto& headKeyPolicyCollection = privilegeSetLogin;
-const static auto& patchKeyPolicyCollection = privilegeSetConfigureManager;
-const static auto& putKeyPolicyCollection = privilegeSetConfigureManager;
-const static auto& deleteKeyPolicyCollection = privilegeSetConfigureManager;
-const static auto& postKeyPolicyCollection = privilegeSetConfigureManager;
+static constexpr const auto& getKeyPolicyCollection = privilegeSetLogin;
+static constexpr const auto& headKeyPolicyCollection = privilegeSetLogin;
+static constexpr const auto& patchKeyPolicyCollection = privilegeSetConfigureManager;
+static constexpr const auto& putKeyPolicyCollection = privilegeSetConfigureManager;
+static constexpr const auto& deleteKeyPolicyCollection = privilegeSetConfigureManager;
+static constexpr const auto& postKeyPolicyCollection = privilegeSetConfigureManager;
 
 // KeyService
-const static auto& getKeyService = privilegeSetLogin;
-const static auto& headKeyService = privilegeSetLogin;
-const static auto& patchKeyService = privilegeSetConfigureManager;
-const static auto& putKeyService = privilegeSetConfigureManager;
-const static auto& deleteKeyService = privilegeSetConfigureManager;
-const static auto& postKeyService = privilegeSetConfigureManager;
+static constexpr const auto& getKeyService = privilegeSetLogin;
+static constexpr const auto& headKeyService = privilegeSetLogin;
+static constexpr const auto& patchKeyService = privilegeSetConfigureManager;
+static constexpr const auto& putKeyService = privilegeSetConfigureManager;
+static constexpr const auto& deleteKeyService = privilegeSetConfigureManager;
+static constexpr const auto& postKeyService = privilegeSetConfigureManager;
 
 // LeakDetection
-const static auto& getLeakDetection = privilegeSetLogin;
-const static auto& headLeakDetection = privilegeSetLogin;
-const static auto& patchLeakDetection = privilegeSetConfigureComponents;
-const static auto& postLeakDetection = privilegeSetConfigureComponents;
-const static auto& putLeakDetection = privilegeSetConfigureComponents;
-const static auto& deleteLeakDetection = privilegeSetConfigureComponents;
+static constexpr const auto& getLeakDetection = privilegeSetLogin;
+static constexpr const auto& headLeakDetection = privilegeSetLogin;
+static constexpr const auto& patchLeakDetection = privilegeSetConfigureComponents;
+static constexpr const auto& postLeakDetection = privilegeSetConfigureComponents;
+static constexpr const auto& putLeakDetection = privilegeSetConfigureComponents;
+static constexpr const auto& deleteLeakDetection = privilegeSetConfigureComponents;
 
 // LeakDetector
-const static auto& getLeakDetector = privilegeSetLogin;
-const static auto& headLeakDetector = privilegeSetLogin;
-const static auto& patchLeakDetector = privilegeSetConfigureComponents;
-const static auto& postLeakDetector = privilegeSetConfigureComponents;
-const static auto& putLeakDetector = privilegeSetConfigureComponents;
-const static auto& deleteLeakDetector = privilegeSetConfigureComponents;
+static constexpr const auto& getLeakDetector = privilegeSetLogin;
+static constexpr const auto& headLeakDetector = privilegeSetLogin;
+static constexpr const auto& patchLeakDetector = privilegeSetConfigureComponents;
+static constexpr const auto& postLeakDetector = privilegeSetConfigureComponents;
+static constexpr const auto& putLeakDetector = privilegeSetConfigureComponents;
+static constexpr const auto& deleteLeakDetector = privilegeSetConfigureComponents;
 
 // LeakDetectorCollection
-const static auto& getLeakDetectorCollection = privilegeSetLogin;
-const static auto& headLeakDetectorCollection = privilegeSetLogin;
-const static auto& patchLeakDetectorCollection = privilegeSetConfigureComponents;
-const static auto& postLeakDetectorCollection = privilegeSetConfigureComponents;
-const static auto& putLeakDetectorCollection = privilegeSetConfigureComponents;
-const static auto& deleteLeakDetectorCollection = privilegeSetConfigureComponents;
+static constexpr const auto& getLeakDetectorCollection = privilegeSetLogin;
+static constexpr const auto& headLeakDetectorCollection = privilegeSetLogin;
+static constexpr const auto& patchLeakDetectorCollection = privilegeSetConfigureComponents;
+static constexpr const auto& postLeakDetectorCollection = privilegeSetConfigureComponents;
+static constexpr const auto& putLeakDetectorCollection = privilegeSetConfigureComponents;
+static constexpr const auto& deleteLeakDetectorCollection = privilegeSetConfigureComponents;
 
 // License
-const static auto& getLicense = privilegeSetLogin;
-const static auto& headLicense = privilegeSetLogin;
-const static auto& patchLicense = privilegeSetConfigureManager;
-const static auto& putLicense = privilegeSetConfigureManager;
-const static auto& deleteLicense = privilegeSetConfigureManager;
-const static auto& postLicense = privilegeSetConfigureManager;
+static constexpr const auto& getLicense = privilegeSetLogin;
+static constexpr const auto& headLicense = privilegeSetLogin;
+static constexpr const auto& patchLicense = privilegeSetConfigureManager;
+static constexpr const auto& putLicense = privilegeSetConfigureManager;
+static constexpr const auto& deleteLicense = privilegeSetConfigureManager;
+static constexpr const auto& postLicense = privilegeSetConfigureManager;
 
 // LicenseCollection
-const static auto& getLicenseCollection = privilegeSetLogin;
-const static auto& headLicenseCollection = privilegeSetLogin;
-const static auto& patchLicenseCollection = privilegeSetConfigureManager;
-const static auto& putLicenseCollection = privilegeSetConfigureManager;
-const static auto& deleteLicenseCollection = privilegeSetConfigureManager;
-const static auto& postLicenseCollection = privilegeSetConfigureManager;
+static constexpr const auto& getLicenseCollection = privilegeSetLogin;
+static constexpr const auto& headLicenseCollection = privilegeSetLogin;
+static constexpr const auto& patchLicenseCollection = privilegeSetConfigureManager;
+static constexpr const auto& putLicenseCollection = privilegeSetConfigureManager;
+static constexpr const auto& deleteLicenseCollection = privilegeSetConfigureManager;
+static constexpr const auto& postLicenseCollection = privilegeSetConfigureManager;
 
 // LicenseService
-const static auto& getLicenseService = privilegeSetLogin;
-const static auto& headLicenseService = privilegeSetLogin;
-const static auto& patchLicenseService = privilegeSetConfigureManager;
-const static auto& putLicenseService = privilegeSetConfigureManager;
-const static auto& deleteLicenseService = privilegeSetConfigureManager;
-const static auto& postLicenseService = privilegeSetConfigureManager;
+static constexpr const auto& getLicenseService = privilegeSetLogin;
+static constexpr const auto& headLicenseService = privilegeSetLogin;
+static constexpr const auto& patchLicenseService = privilegeSetConfigureManager;
+static constexpr const auto& putLicenseService = privilegeSetConfigureManager;
+static constexpr const auto& deleteLicenseService = privilegeSetConfigureManager;
+static constexpr const auto& postLicenseService = privilegeSetConfigureManager;
 
 // LogEntry
-const static auto& getLogEntry = privilegeSetLogin;
-const static auto& headLogEntry = privilegeSetLogin;
-const static auto& patchLogEntry = privilegeSetConfigureManager;
-const static auto& putLogEntry = privilegeSetConfigureManager;
-const static auto& deleteLogEntry = privilegeSetConfigureManager;
-const static auto& postLogEntry = privilegeSetConfigureManager;
+static constexpr const auto& getLogEntry = privilegeSetLogin;
+static constexpr const auto& headLogEntry = privilegeSetLogin;
+static constexpr const auto& patchLogEntry = privilegeSetConfigureManager;
+static constexpr const auto& putLogEntry = privilegeSetConfigureManager;
+static constexpr const auto& deleteLogEntry = privilegeSetConfigureManager;
+static constexpr const auto& postLogEntry = privilegeSetConfigureManager;
 
 // LogEntryCollection
-const static auto& getLogEntryCollection = privilegeSetLogin;
-const static auto& headLogEntryCollection = privilegeSetLogin;
-const static auto& patchLogEntryCollection = privilegeSetConfigureManager;
-const static auto& putLogEntryCollection = privilegeSetConfigureManager;
-const static auto& deleteLogEntryCollection = privilegeSetConfigureManager;
-const static auto& postLogEntryCollection = privilegeSetConfigureManager;
+static constexpr const auto& getLogEntryCollection = privilegeSetLogin;
+static constexpr const auto& headLogEntryCollection = privilegeSetLogin;
+static constexpr const auto& patchLogEntryCollection = privilegeSetConfigureManager;
+static constexpr const auto& putLogEntryCollection = privilegeSetConfigureManager;
+static constexpr const auto& deleteLogEntryCollection = privilegeSetConfigureManager;
+static constexpr const auto& postLogEntryCollection = privilegeSetConfigureManager;
 
 // LogService
-const static auto& getLogService = privilegeSetLogin;
-const static auto& headLogService = privilegeSetLogin;
-const static auto& patchLogService = privilegeSetConfigureManager;
-const static auto& putLogService = privilegeSetConfigureManager;
-const static auto& deleteLogService = privilegeSetConfigureManager;
-const static auto& postLogService = privilegeSetConfigureManager;
+static constexpr const auto& getLogService = privilegeSetLogin;
+static constexpr const auto& headLogService = privilegeSetLogin;
+static constexpr const auto& patchLogService = privilegeSetConfigureManager;
+static constexpr const auto& putLogService = privilegeSetConfigureManager;
+static constexpr const auto& deleteLogService = privilegeSetConfigureManager;
+static constexpr const auto& postLogService = privilegeSetConfigureManager;
 
 // LogServiceCollection
-const static auto& getLogServiceCollection = privilegeSetLogin;
-const static auto& headLogServiceCollection = privilegeSetLogin;
-const static auto& patchLogServiceCollection = privilegeSetConfigureManager;
-const static auto& putLogServiceCollection = privilegeSetConfigureManager;
-const static auto& deleteLogServiceCollection = privilegeSetConfigureManager;
-const static auto& postLogServiceCollection = privilegeSetConfigureManager;
+static constexpr const auto& getLogServiceCollection = privilegeSetLogin;
+static constexpr const auto& headLogServiceCollection = privilegeSetLogin;
+static constexpr const auto& patchLogServiceCollection = privilegeSetConfigureManager;
+static constexpr const auto& putLogServiceCollection = privilegeSetConfigureManager;
+static constexpr const auto& deleteLogServiceCollection = privilegeSetConfigureManager;
+static constexpr const auto& postLogServiceCollection = privilegeSetConfigureManager;
 
 // Manager
-const static auto& getManager = privilegeSetLogin;
-const static auto& headManager = privilegeSetLogin;
-const static auto& patchManager = privilegeSetConfigureManager;
-const static auto& postManager = privilegeSetConfigureManager;
-const static auto& putManager = privilegeSetConfigureManager;
-const static auto& deleteManager = privilegeSetConfigureManager;
+static constexpr const auto& getManager = privilegeSetLogin;
+static constexpr const auto& headManager = privilegeSetLogin;
+static constexpr const auto& patchManager = privilegeSetConfigureManager;
+static constexpr const auto& postManager = privilegeSetConfigureManager;
+static constexpr const auto& putManager = privilegeSetConfigureManager;
+static constexpr const auto& deleteManager = privilegeSetConfigureManager;
 
 // ManagerCollection
-const static auto& getManagerCollection = privilegeSetLogin;
-const static auto& headManagerCollection = privilegeSetLogin;
-const static auto& patchManagerCollection = privilegeSetConfigureManager;
-const static auto& postManagerCollection = privilegeSetConfigureManager;
-const static auto& putManagerCollection = privilegeSetConfigureManager;
-const static auto& deleteManagerCollection = privilegeSetConfigureManager;
+static constexpr const auto& getManagerCollection = privilegeSetLogin;
+static constexpr const auto& headManagerCollection = privilegeSetLogin;
+static constexpr const auto& patchManagerCollection = privilegeSetConfigureManager;
+static constexpr const auto& postManagerCollection = privilegeSetConfigureManager;
+static constexpr const auto& putManagerCollection = privilegeSetConfigureManager;
+static constexpr const auto& deleteManagerCollection = privilegeSetConfigureManager;
 
 // ManagerAccount
-const static auto& getManagerAccount = privilegeSetConfigureManagerOrConfigureUsersOrConfigureSelf;
-const static auto& headManagerAccount = privilegeSetLogin;
-const static auto& patchManagerAccount = privilegeSetConfigureUsers;
-const static auto& postManagerAccount = privilegeSetConfigureUsers;
-const static auto& putManagerAccount = privilegeSetConfigureUsers;
-const static auto& deleteManagerAccount = privilegeSetConfigureUsers;
+static constexpr const auto& getManagerAccount = privilegeSetConfigureManagerOrConfigureUsersOrConfigureSelf;
+static constexpr const auto& headManagerAccount = privilegeSetLogin;
+static constexpr const auto& patchManagerAccount = privilegeSetConfigureUsers;
+static constexpr const auto& postManagerAccount = privilegeSetConfigureUsers;
+static constexpr const auto& putManagerAccount = privilegeSetConfigureUsers;
+static constexpr const auto& deleteManagerAccount = privilegeSetConfigureUsers;
 
 // ManagerAccountCollection
-const static auto& getManagerAccountCollection = privilegeSetLogin;
-const static auto& headManagerAccountCollection = privilegeSetLogin;
-const static auto& patchManagerAccountCollection = privilegeSetConfigureUsers;
-const static auto& putManagerAccountCollection = privilegeSetConfigureUsers;
-const static auto& deleteManagerAccountCollection = privilegeSetConfigureUsers;
-const static auto& postManagerAccountCollection = privilegeSetConfigureUsers;
+static constexpr const auto& getManagerAccountCollection = privilegeSetLogin;
+static constexpr const auto& headManagerAccountCollection = privilegeSetLogin;
+static constexpr const auto& patchManagerAccountCollection = privilegeSetConfigureUsers;
+static constexpr const auto& putManagerAccountCollection = privilegeSetConfigureUsers;
+static constexpr const auto& deleteManagerAccountCollection = privilegeSetConfigureUsers;
+static constexpr const auto& postManagerAccountCollection = privilegeSetConfigureUsers;
 
 // ManagerDiagnosticData
-const static auto& getManagerDiagnosticData = privilegeSetLogin;
-const static auto& headManagerDiagnosticData = privilegeSetLogin;
-const static auto& patchManagerDiagnosticData = privilegeSetConfigureManager;
-const static auto& postManagerDiagnosticData = privilegeSetConfigureManager;
-const static auto& deleteManagerDiagnosticData = privilegeSetConfigureManager;
-const static auto& putManagerDiagnosticData = privilegeSetConfigureManager;
+static constexpr const auto& getManagerDiagnosticData = privilegeSetLogin;
+static constexpr const auto& headManagerDiagnosticData = privilegeSetLogin;
+static constexpr const auto& patchManagerDiagnosticData = privilegeSetConfigureManager;
+static constexpr const auto& postManagerDiagnosticData = privilegeSetConfigureManager;
+static constexpr const auto& deleteManagerDiagnosticData = privilegeSetConfigureManager;
+static constexpr const auto& putManagerDiagnosticData = privilegeSetConfigureManager;
 
 // ManagerNetworkProtocol
-const static auto& getManagerNetworkProtocol = privilegeSetLogin;
-const static auto& headManagerNetworkProtocol = privilegeSetLogin;
-const static auto& patchManagerNetworkProtocol = privilegeSetConfigureManager;
-const static auto& postManagerNetworkProtocol = privilegeSetConfigureManager;
-const static auto& putManagerNetworkProtocol = privilegeSetConfigureManager;
-const static auto& deleteManagerNetworkProtocol = privilegeSetConfigureManager;
+static constexpr const auto& getManagerNetworkProtocol = privilegeSetLogin;
+static constexpr const auto& headManagerNetworkProtocol = privilegeSetLogin;
+static constexpr const auto& patchManagerNetworkProtocol = privilegeSetConfigureManager;
+static constexpr const auto& postManagerNetworkProtocol = privilegeSetConfigureManager;
+static constexpr const auto& putManagerNetworkProtocol = privilegeSetConfigureManager;
+static constexpr const auto& deleteManagerNetworkProtocol = privilegeSetConfigureManager;
 
 // MediaController
-const static auto& getMediaController = privilegeSetLogin;
-const static auto& headMediaController = privilegeSetLogin;
-const static auto& patchMediaController = privilegeSetConfigureComponents;
-const static auto& postMediaController = privilegeSetConfigureComponents;
-const static auto& putMediaController = privilegeSetConfigureComponents;
-const static auto& deleteMediaController = privilegeSetConfigureComponents;
+static constexpr const auto& getMediaController = privilegeSetLogin;
+static constexpr const auto& headMediaController = privilegeSetLogin;
+static constexpr const auto& patchMediaController = privilegeSetConfigureComponents;
+static constexpr const auto& postMediaController = privilegeSetConfigureComponents;
+static constexpr const auto& putMediaController = privilegeSetConfigureComponents;
+static constexpr const auto& deleteMediaController = privilegeSetConfigureComponents;
 
 // MediaControllerCollection
-const static auto& getMediaControllerCollection = privilegeSetLogin;
-const static auto& headMediaControllerCollection = privilegeSetLogin;
-const static auto& patchMediaControllerCollection = privilegeSetConfigureComponents;
-const static auto& postMediaControllerCollection = privilegeSetConfigureComponents;
-const static auto& putMediaControllerCollection = privilegeSetConfigureComponents;
-const static auto& deleteMediaControllerCollection = privilegeSetConfigureComponents;
+static constexpr const auto& getMediaControllerCollection = privilegeSetLogin;
+static constexpr const auto& headMediaControllerCollection = privilegeSetLogin;
+static constexpr const auto& patchMediaControllerCollection = privilegeSetConfigureComponents;
+static constexpr const auto& postMediaControllerCollection = privilegeSetConfigureComponents;
+static constexpr const auto& putMediaControllerCollection = privilegeSetConfigureComponents;
+static constexpr const auto& deleteMediaControllerCollection = privilegeSetConfigureComponents;
 
 // Memory
-const static auto& getMemory = privilegeSetLogin;
-const static auto& headMemory = privilegeSetLogin;
-const static auto& patchMemory = privilegeSetConfigureComponents;
-const static auto& postMemory = privilegeSetConfigureComponents;
-const static auto& putMemory = privilegeSetConfigureComponents;
-const static auto& deleteMemory = privilegeSetConfigureComponents;
+static constexpr const auto& getMemory = privilegeSetLogin;
+static constexpr const auto& headMemory = privilegeSetLogin;
+static constexpr const auto& patchMemory = privilegeSetConfigureComponents;
+static constexpr const auto& postMemory = privilegeSetConfigureComponents;
+static constexpr const auto& putMemory = privilegeSetConfigureComponents;
+static constexpr const auto& deleteMemory = privilegeSetConfigureComponents;
 
 // MemoryCollection
-const static auto& getMemoryCollection = privilegeSetLogin;
-const static auto& headMemoryCollection = privilegeSetLogin;
-const static auto& patchMemoryCollection = privilegeSetConfigureComponents;
-const static auto& postMemoryCollection = privilegeSetConfigureComponents;
-const static auto& putMemoryCollection = privilegeSetConfigureComponents;
-const static auto& deleteMemoryCollection = privilegeSetConfigureComponents;
+static constexpr const auto& getMemoryCollection = privilegeSetLogin;
+static constexpr const auto& headMemoryCollection = privilegeSetLogin;
+static constexpr const auto& patchMemoryCollection = privilegeSetConfigureComponents;
+static constexpr const auto& postMemoryCollection = privilegeSetConfigureComponents;
+static constexpr const auto& putMemoryCollection = privilegeSetConfigureComponents;
+static constexpr const auto& deleteMemoryCollection = privilegeSetConfigureComponents;
 
 // MemoryChunks
-const static auto& getMemoryChunks = privilegeSetLogin;
-const static auto& headMemoryChunks = privilegeSetLogin;
-const static auto& patchMemoryChunks = privilegeSetConfigureComponents;
-const static auto& postMemoryChunks = privilegeSetConfigureComponents;
-const static auto& putMemoryChunks = privilegeSetConfigureComponents;
-const static auto& deleteMemoryChunks = privilegeSetConfigureComponents;
+static constexpr const auto& getMemoryChunks = privilegeSetLogin;
+static constexpr const auto& headMemoryChunks = privilegeSetLogin;
+static constexpr const auto& patchMemoryChunks = privilegeSetConfigureComponents;
+static constexpr const auto& postMemoryChunks = privilegeSetConfigureComponents;
+static constexpr const auto& putMemoryChunks = privilegeSetConfigureComponents;
+static constexpr const auto& deleteMemoryChunks = privilegeSetConfigureComponents;
 
 // MemoryChunksCollection
-const static auto& getMemoryChunksCollection = privilegeSetLogin;
-const static auto& headMemoryChunksCollection = privilegeSetLogin;
-const static auto& patchMemoryChunksCollection = privilegeSetConfigureComponents;
-const static auto& postMemoryChunksCollection = privilegeSetConfigureComponents;
-const static auto& putMemoryChunksCollection = privilegeSetConfigureComponents;
-const static auto& deleteMemoryChunksCollection = privilegeSetConfigureComponents;
+static constexpr const auto& getMemoryChunksCollection = privilegeSetLogin;
+static constexpr const auto& headMemoryChunksCollection = privilegeSetLogin;
+static constexpr const auto& patchMemoryChunksCollection = privilegeSetConfigureComponents;
+static constexpr const auto& postMemoryChunksCollection = privilegeSetConfigureComponents;
+static constexpr const auto& putMemoryChunksCollection = privilegeSetConfigureComponents;
+static constexpr const auto& deleteMemoryChunksCollection = privilegeSetConfigureComponents;
 
 // MemoryDomain
-const static auto& getMemoryDomain = privilegeSetLogin;
-const static auto& headMemoryDomain = privilegeSetLogin;
-const static auto& patchMemoryDomain = privilegeSetConfigureComponents;
-const static auto& postMemoryDomain = privilegeSetConfigureComponents;
-const static auto& putMemoryDomain = privilegeSetConfigureComponents;
-const static auto& deleteMemoryDomain = privilegeSetConfigureComponents;
+static constexpr const auto& getMemoryDomain = privilegeSetLogin;
+static constexpr const auto& headMemoryDomain = privilegeSetLogin;
+static constexpr const auto& patchMemoryDomain = privilegeSetConfigureComponents;
+static constexpr const auto& postMemoryDomain = privilegeSetConfigureComponents;
+static constexpr const auto& putMemoryDomain = privilegeSetConfigureComponents;
+static constexpr const auto& deleteMemoryDomain = privilegeSetConfigureComponents;
 
 // MemoryDomainCollection
-const static auto& getMemoryDomainCollection = privilegeSetLogin;
-const static auto& headMemoryDomainCollection = privilegeSetLogin;
-const static auto& patchMemoryDomainCollection = privilegeSetConfigureComponents;
-const static auto& postMemoryDomainCollection = privilegeSetConfigureComponents;
-const static auto& putMemoryDomainCollection = privilegeSetConfigureComponents;
-const static auto& deleteMemoryDomainCollection = privilegeSetConfigureComponents;
+static constexpr const auto& getMemoryDomainCollection = privilegeSetLogin;
+static constexpr const auto& headMemoryDomainCollection = privilegeSetLogin;
+static constexpr const auto& patchMemoryDomainCollection = privilegeSetConfigureComponents;
+static constexpr const auto& postMemoryDomainCollection = privilegeSetConfigureComponents;
+static constexpr const auto& putMemoryDomainCollection = privilegeSetConfigureComponents;
+static constexpr const auto& deleteMemoryDomainCollection = privilegeSetConfigureComponents;
 
 // MemoryMetrics
-const static auto& getMemoryMetrics = privilegeSetLogin;
-const static auto& headMemoryMetrics = privilegeSetLogin;
-const static auto& patchMemoryMetrics = privilegeSetConfigureComponents;
-const static auto& postMemoryMetrics = privilegeSetConfigureComponents;
-const static auto& putMemoryMetrics = privilegeSetConfigureComponents;
-const static auto& deleteMemoryMetrics = privilegeSetConfigureComponents;
+static constexpr const auto& getMemoryMetrics = privilegeSetLogin;
+static constexpr const auto& headMemoryMetrics = privilegeSetLogin;
+static constexpr const auto& patchMemoryMetrics = privilegeSetConfigureComponents;
+static constexpr const auto& postMemoryMetrics = privilegeSetConfigureComponents;
+static constexpr const auto& putMemoryMetrics = privilegeSetConfigureComponents;
+static constexpr const auto& deleteMemoryMetrics = privilegeSetConfigureComponents;
 
 // MemoryRegion
-const static auto& getMemoryRegion = privilegeSetLogin;
-const static auto& headMemoryRegion = privilegeSetLogin;
-const static auto& patchMemoryRegion = privilegeSetConfigureComponents;
-const static auto& postMemoryRegion = privilegeSetConfigureComponents;
-const static auto& putMemoryRegion = privilegeSetConfigureComponents;
-const static auto& deleteMemoryRegion = privilegeSetConfigureComponents;
+static constexpr const auto& getMemoryRegion = privilegeSetLogin;
+static constexpr const auto& headMemoryRegion = privilegeSetLogin;
+static constexpr const auto& patchMemoryRegion = privilegeSetConfigureComponents;
+static constexpr const auto& postMemoryRegion = privilegeSetConfigureComponents;
+static constexpr const auto& putMemoryRegion = privilegeSetConfigureComponents;
+static constexpr const auto& deleteMemoryRegion = privilegeSetConfigureComponents;
 
 // MemoryRegionCollection
-const static auto& getMemoryRegionCollection = privilegeSetLogin;
-const static auto& headMemoryRegionCollection = privilegeSetLogin;
-const static auto& patchMemoryRegionCollection = privilegeSetConfigureComponents;
-const static auto& postMemoryRegionCollection = privilegeSetConfigureComponents;
-const static auto& putMemoryRegionCollection = privilegeSetConfigureComponents;
-const static auto& deleteMemoryRegionCollection = privilegeSetConfigureComponents;
+static constexpr const auto& getMemoryRegionCollection = privilegeSetLogin;
+static constexpr const auto& headMemoryRegionCollection = privilegeSetLogin;
+static constexpr const auto& patchMemoryRegionCollection = privilegeSetConfigureComponents;
+static constexpr const auto& postMemoryRegionCollection = privilegeSetConfigureComponents;
+static constexpr const auto& putMemoryRegionCollection = privilegeSetConfigureComponents;
+static constexpr const auto& deleteMemoryRegionCollection = privilegeSetConfigureComponents;
 
 // MessageRegistry
-const static auto& getMessageRegistry = privilegeSetLogin;
-const static auto& headMessageRegistry = privilegeSetLogin;
-const static auto& patchMessageRegistry = privilegeSetConfigureManager;
-const static auto& postMessageRegistry = privilegeSetConfigureManager;
-const static auto& putMessageRegistry = privilegeSetConfigureManager;
-const static auto& deleteMessageRegistry = privilegeSetConfigureManager;
+static constexpr const auto& getMessageRegistry = privilegeSetLogin;
+static constexpr const auto& headMessageRegistry = privilegeSetLogin;
+static constexpr const auto& patchMessageRegistry = privilegeSetConfigureManager;
+static constexpr const auto& postMessageRegistry = privilegeSetConfigureManager;
+static constexpr const auto& putMessageRegistry = privilegeSetConfigureManager;
+static constexpr const auto& deleteMessageRegistry = privilegeSetConfigureManager;
 
 // MessageRegistryFile
-const static auto& getMessageRegistryFile = privilegeSetLogin;
-const static auto& headMessageRegistryFile = privilegeSetLogin;
-const static auto& patchMessageRegistryFile = privilegeSetConfigureManager;
-const static auto& postMessageRegistryFile = privilegeSetConfigureManager;
-const static auto& putMessageRegistryFile = privilegeSetConfigureManager;
-const static auto& deleteMessageRegistryFile = privilegeSetConfigureManager;
+static constexpr const auto& getMessageRegistryFile = privilegeSetLogin;
+static constexpr const auto& headMessageRegistryFile = privilegeSetLogin;
+static constexpr const auto& patchMessageRegistryFile = privilegeSetConfigureManager;
+static constexpr const auto& postMessageRegistryFile = privilegeSetConfigureManager;
+static constexpr const auto& putMessageRegistryFile = privilegeSetConfigureManager;
+static constexpr const auto& deleteMessageRegistryFile = privilegeSetConfigureManager;
 
 // MessageRegistryFileCollection
-const static auto& getMessageRegistryFileCollection = privilegeSetLogin;
-const static auto& headMessageRegistryFileCollection = privilegeSetLogin;
-const static auto& patchMessageRegistryFileCollection = privilegeSetConfigureManager;
-const static auto& postMessageRegistryFileCollection = privilegeSetConfigureManager;
-const static auto& putMessageRegistryFileCollection = privilegeSetConfigureManager;
-const static auto& deleteMessageRegistryFileCollection = privilegeSetConfigureManager;
+static constexpr const auto& getMessageRegistryFileCollection = privilegeSetLogin;
+static constexpr const auto& headMessageRegistryFileCollection = privilegeSetLogin;
+static constexpr const auto& patchMessageRegistryFileCollection = privilegeSetConfigureManager;
+static constexpr const auto& postMessageRegistryFileCollection = privilegeSetConfigureManager;
+static constexpr const auto& putMessageRegistryFileCollection = privilegeSetConfigureManager;
+static constexpr const auto& deleteMessageRegistryFileCollection = privilegeSetConfigureManager;
 
 // MetricDefinition
-const static auto& getMetricDefinition = privilegeSetLogin;
-const static auto& headMetricDefinition = privilegeSetLogin;
-const static auto& patchMetricDefinition = privilegeSetConfigureManager;
-const static auto& putMetricDefinition = privilegeSetConfigureManager;
-const static auto& deleteMetricDefinition = privilegeSetConfigureManager;
-const static auto& postMetricDefinition = privilegeSetConfigureManager;
+static constexpr const auto& getMetricDefinition = privilegeSetLogin;
+static constexpr const auto& headMetricDefinition = privilegeSetLogin;
+static constexpr const auto& patchMetricDefinition = privilegeSetConfigureManager;
+static constexpr const auto& putMetricDefinition = privilegeSetConfigureManager;
+static constexpr const auto& deleteMetricDefinition = privilegeSetConfigureManager;
+static constexpr const auto& postMetricDefinition = privilegeSetConfigureManager;
 
 // MetricDefinitionCollection
-const static auto& getMetricDefinitionCollection = privilegeSetLogin;
-const static auto& headMetricDefinitionCollection = privilegeSetLogin;
-const static auto& patchMetricDefinitionCollection = privilegeSetConfigureManager;
-const static auto& putMetricDefinitionCollection = privilegeSetConfigureManager;
-const static auto& deleteMetricDefinitionCollection = privilegeSetConfigureManager;
-const static auto& postMetricDefinitionCollection = privilegeSetConfigureManager;
+static constexpr const auto& getMetricDefinitionCollection = privilegeSetLogin;
+static constexpr const auto& headMetricDefinitionCollection = privilegeSetLogin;
+static constexpr const auto& patchMetricDefinitionCollection = privilegeSetConfigureManager;
+static constexpr const auto& putMetricDefinitionCollection = privilegeSetConfigureManager;
+static constexpr const auto& deleteMetricDefinitionCollection = privilegeSetConfigureManager;
+static constexpr const auto& postMetricDefinitionCollection = privilegeSetConfigureManager;
 
 // MetricReport
-const static auto& getMetricReport = privilegeSetLogin;
-const static auto& headMetricReport = privilegeSetLogin;
-const static auto& patchMetricReport = privilegeSetConfigureManager;
-const static auto& putMetricReport = privilegeSetConfigureManager;
-const static auto& deleteMetricReport = privilegeSetConfigureManager;
-const static auto& postMetricReport = privilegeSetConfigureManager;
+static constexpr const auto& getMetricReport = privilegeSetLogin;
+static constexpr const auto& headMetricReport = privilegeSetLogin;
+static constexpr const auto& patchMetricReport = privilegeSetConfigureManager;
+static constexpr const auto& putMetricReport = privilegeSetConfigureManager;
+static constexpr const auto& deleteMetricReport = privilegeSetConfigureManager;
+static constexpr const auto& postMetricReport = privilegeSetConfigureManager;
 
 // MetricReportCollection
-const static auto& getMetricReportCollection = privilegeSetLogin;
-const static auto& headMetricReportCollection = privilegeSetLogin;
-const static auto& patchMetricReportCollection = privilegeSetConfigureManager;
-const static auto& putMetricReportCollection = privilegeSetConfigureManager;
-const static auto& deleteMetricReportCollection = privilegeSetConfigureManager;
-const static auto& postMetricReportCollection = privilegeSetConfigureManager;
+static constexpr const auto& getMetricReportCollection = privilegeSetLogin;
+static constexpr const auto& headMetricReportCollection = privilegeSetLogin;
+static constexpr const auto& patchMetricReportCollection = privilegeSetConfigureManager;
+static constexpr const auto& putMetricReportCollection = privilegeSetConfigureManager;
+static constexpr const auto& deleteMetricReportCollection = privilegeSetConfigureManager;
+static constexpr const auto& postMetricReportCollection = privilegeSetConfigureManager;
 
 // MetricReportDefinition
-const static auto& getMetricReportDefinition = privilegeSetLogin;
-const static auto& headMetricReportDefinition = privilegeSetLogin;
-const static auto& patchMetricReportDefinition = privilegeSetConfigureManager;
-const static auto& putMetricReportDefinition = privilegeSetConfigureManager;
-const static auto& deleteMetricReportDefinition = privilegeSetConfigureManager;
-const static auto& postMetricReportDefinition = privilegeSetConfigureManager;
+static constexpr const auto& getMetricReportDefinition = privilegeSetLogin;
+static constexpr const auto& headMetricReportDefinition = privilegeSetLogin;
+static constexpr const auto& patchMetricReportDefinition = privilegeSetConfigureManager;
+static constexpr const auto& putMetricReportDefinition = privilegeSetConfigureManager;
+static constexpr const auto& deleteMetricReportDefinition = privilegeSetConfigureManager;
+static constexpr const auto& postMetricReportDefinition = privilegeSetConfigureManager;
 
 // MetricReportDefinitionCollection
-const static auto& getMetricReportDefinitionCollection = privilegeSetLogin;
-const static auto& headMetricReportDefinitionCollection = privilegeSetLogin;
-const static auto& patchMetricReportDefinitionCollection = privilegeSetConfigureManager;
-const static auto& putMetricReportDefinitionCollection = privilegeSetConfigureManager;
-const static auto& deleteMetricReportDefinitionCollection = privilegeSetConfigureManager;
-const static auto& postMetricReportDefinitionCollection = privilegeSetConfigureManager;
+static constexpr const auto& getMetricReportDefinitionCollection = privilegeSetLogin;
+static constexpr const auto& headMetricReportDefinitionCollection = privilegeSetLogin;
+static constexpr const auto& patchMetricReportDefinitionCollection = privilegeSetConfigureManager;
+static constexpr const auto& putMetricReportDefinitionCollection = privilegeSetConfigureManager;
+static constexpr const auto& deleteMetricReportDefinitionCollection = privilegeSetConfigureManager;
+static constexpr const auto& postMetricReportDefinitionCollection = privilegeSetConfigureManager;
 
 // NetworkAdapter
-const static auto& getNetworkAdapter = privilegeSetLogin;
-const static auto& headNetworkAdapter = privilegeSetLogin;
-const static auto& patchNetworkAdapter = privilegeSetConfigureComponents;
-const static auto& postNetworkAdapter = privilegeSetConfigureComponents;
-const static auto& putNetworkAdapter = privilegeSetConfigureComponents;
-const static auto& deleteNetworkAdapter = privilegeSetConfigureComponents;
+static constexpr const auto& getNetworkAdapter = privilegeSetLogin;
+static constexpr const auto& headNetworkAdapter = privilegeSetLogin;
+static constexpr const auto& patchNetworkAdapter = privilegeSetConfigureComponents;
+static constexpr const auto& postNetworkAdapter = privilegeSetConfigureComponents;
+static constexpr const auto& putNetworkAdapter = privilegeSetConfigureComponents;
+static constexpr const auto& deleteNetworkAdapter = privilegeSetConfigureComponents;
 
 // NetworkAdapterCollection
-const static auto& getNetworkAdapterCollection = privilegeSetLogin;
-const static auto& headNetworkAdapterCollection = privilegeSetLogin;
-const static auto& patchNetworkAdapterCollection = privilegeSetConfigureComponents;
-const static auto& postNetworkAdapterCollection = privilegeSetConfigureComponents;
-const static auto& putNetworkAdapterCollection = privilegeSetConfigureComponents;
-const static auto& deleteNetworkAdapterCollection = privilegeSetConfigureComponents;
+static constexpr const auto& getNetworkAdapterCollection = privilegeSetLogin;
+static constexpr const auto& headNetworkAdapterCollection = privilegeSetLogin;
+static constexpr const auto& patchNetworkAdapterCollection = privilegeSetConfigureComponents;
+static constexpr const auto& postNetworkAdapterCollection = privilegeSetConfigureComponents;
+static constexpr const auto& putNetworkAdapterCollection = privilegeSetConfigureComponents;
+static constexpr const auto& deleteNetworkAdapterCollection = privilegeSetConfigureComponents;
 
 // NetworkAdapterMetrics
-const static auto& getNetworkAdapterMetrics = privilegeSetLogin;
-const static auto& headNetworkAdapterMetrics = privilegeSetLogin;
-const static auto& patchNetworkAdapterMetrics = privilegeSetConfigureManager;
-const static auto& putNetworkAdapterMetrics = privilegeSetConfigureManager;
-const static auto& deleteNetworkAdapterMetrics = privilegeSetConfigureManager;
-const static auto& postNetworkAdapterMetrics = privilegeSetConfigureManager;
+static constexpr const auto& getNetworkAdapterMetrics = privilegeSetLogin;
+static constexpr const auto& headNetworkAdapterMetrics = privilegeSetLogin;
+static constexpr const auto& patchNetworkAdapterMetrics = privilegeSetConfigureManager;
+static constexpr const auto& putNetworkAdapterMetrics = privilegeSetConfigureManager;
+static constexpr const auto& deleteNetworkAdapterMetrics = privilegeSetConfigureManager;
+static constexpr const auto& postNetworkAdapterMetrics = privilegeSetConfigureManager;
 
 // NetworkDeviceFunction
-const static auto& getNetworkDeviceFunction = privilegeSetLogin;
-const static auto& headNetworkDeviceFunction = privilegeSetLogin;
-const static auto& patchNetworkDeviceFunction = privilegeSetConfigureComponents;
-const static auto& postNetworkDeviceFunction = privilegeSetConfigureComponents;
-const static auto& putNetworkDeviceFunction = privilegeSetConfigureComponents;
-const static auto& deleteNetworkDeviceFunction = privilegeSetConfigureComponents;
+static constexpr const auto& getNetworkDeviceFunction = privilegeSetLogin;
+static constexpr const auto& headNetworkDeviceFunction = privilegeSetLogin;
+static constexpr const auto& patchNetworkDeviceFunction = privilegeSetConfigureComponents;
+static constexpr const auto& postNetworkDeviceFunction = privilegeSetConfigureComponents;
+static constexpr const auto& putNetworkDeviceFunction = privilegeSetConfigureComponents;
+static constexpr const auto& deleteNetworkDeviceFunction = privilegeSetConfigureComponents;
 
 // NetworkDeviceFunctionCollection
-const static auto& getNetworkDeviceFunctionCollection = privilegeSetLogin;
-const static auto& headNetworkDeviceFunctionCollection = privilegeSetLogin;
-const static auto& patchNetworkDeviceFunctionCollection = privilegeSetConfigureComponents;
-const static auto& postNetworkDeviceFunctionCollection = privilegeSetConfigureComponents;
-const static auto& putNetworkDeviceFunctionCollection = privilegeSetConfigureComponents;
-const static auto& deleteNetworkDeviceFunctionCollection = privilegeSetConfigureComponents;
+static constexpr const auto& getNetworkDeviceFunctionCollection = privilegeSetLogin;
+static constexpr const auto& headNetworkDeviceFunctionCollection = privilegeSetLogin;
+static constexpr const auto& patchNetworkDeviceFunctionCollection = privilegeSetConfigureComponents;
+static constexpr const auto& postNetworkDeviceFunctionCollection = privilegeSetConfigureComponents;
+static constexpr const auto& putNetworkDeviceFunctionCollection = privilegeSetConfigureComponents;
+static constexpr const auto& deleteNetworkDeviceFunctionCollection = privilegeSetConfigureComponents;
 
 // NetworkDeviceFunctionMetrics
-const static auto& getNetworkDeviceFunctionMetrics = privilegeSetLogin;
-const static auto& headNetworkDeviceFunctionMetrics = privilegeSetLogin;
-const static auto& patchNetworkDeviceFunctionMetrics = privilegeSetConfigureManager;
-const static auto& putNetworkDeviceFunctionMetrics = privilegeSetConfigureManager;
-const static auto& deleteNetworkDeviceFunctionMetrics = privilegeSetConfigureManager;
-const static auto& postNetworkDeviceFunctionMetrics = privilegeSetConfigureManager;
+static constexpr const auto& getNetworkDeviceFunctionMetrics = privilegeSetLogin;
+static constexpr const auto& headNetworkDeviceFunctionMetrics = privilegeSetLogin;
+static constexpr const auto& patchNetworkDeviceFunctionMetrics = privilegeSetConfigureManager;
+static constexpr const auto& putNetworkDeviceFunctionMetrics = privilegeSetConfigureManager;
+static constexpr const auto& deleteNetworkDeviceFunctionMetrics = privilegeSetConfigureManager;
+static constexpr const auto& postNetworkDeviceFunctionMetrics = privilegeSetConfigureManager;
 
 // NetworkInterface
-const static auto& getNetworkInterface = privilegeSetLogin;
-const static auto& headNetworkInterface = privilegeSetLogin;
-const static auto& patchNetworkInterface = privilegeSetConfigureComponents;
-const static auto& postNetworkInterface = privilegeSetConfigureComponents;
-const static auto& putNetworkInterface = privilegeSetConfigureComponents;
-const static auto& deleteNetworkInterface = privilegeSetConfigureComponents;
+static constexpr const auto& getNetworkInterface = privilegeSetLogin;
+static constexpr const auto& headNetworkInterface = privilegeSetLogin;
+static constexpr const auto& patchNetworkInterface = privilegeSetConfigureComponents;
+static constexpr const auto& postNetworkInterface = privilegeSetConfigureComponents;
+static constexpr const auto& putNetworkInterface = privilegeSetConfigureComponents;
+static constexpr const auto& deleteNetworkInterface = privilegeSetConfigureComponents;
 
 // NetworkInterfaceCollection
-const static auto& getNetworkInterfaceCollection = privilegeSetLogin;
-const static auto& headNetworkInterfaceCollection = privilegeSetLogin;
-const static auto& patchNetworkInterfaceCollection = privilegeSetConfigureComponents;
-const static auto& postNetworkInterfaceCollection = privilegeSetConfigureComponents;
-const static auto& putNetworkInterfaceCollection = privilegeSetConfigureComponents;
-const static auto& deleteNetworkInterfaceCollection = privilegeSetConfigureComponents;
+static constexpr const auto& getNetworkInterfaceCollection = privilegeSetLogin;
+static constexpr const auto& headNetworkInterfaceCollection = privilegeSetLogin;
+static constexpr const auto& patchNetworkInterfaceCollection = privilegeSetConfigureComponents;
+static constexpr const auto& postNetworkInterfaceCollection = privilegeSetConfigureComponents;
+static constexpr const auto& putNetworkInterfaceCollection = privilegeSetConfigureComponents;
+static constexpr const auto& deleteNetworkInterfaceCollection = privilegeSetConfigureComponents;
 
 // NetworkPort
-const static auto& getNetworkPort = privilegeSetLogin;
-const static auto& headNetworkPort = privilegeSetLogin;
-const static auto& patchNetworkPort = privilegeSetConfigureComponents;
-const static auto& postNetworkPort = privilegeSetConfigureComponents;
-const static auto& putNetworkPort = privilegeSetConfigureComponents;
-const static auto& deleteNetworkPort = privilegeSetConfigureComponents;
+static constexpr const auto& getNetworkPort = privilegeSetLogin;
+static constexpr const auto& headNetworkPort = privilegeSetLogin;
+static constexpr const auto& patchNetworkPort = privilegeSetConfigureComponents;
+static constexpr const auto& postNetworkPort = privilegeSetConfigureComponents;
+static constexpr const auto& putNetworkPort = privilegeSetConfigureComponents;
+static constexpr const auto& deleteNetworkPort = privilegeSetConfigureComponents;
 
 // NetworkPortCollection
-const static auto& getNetworkPortCollection = privilegeSetLogin;
-const static auto& headNetworkPortCollection = privilegeSetLogin;
-const static auto& patchNetworkPortCollection = privilegeSetConfigureComponents;
-const static auto& postNetworkPortCollection = privilegeSetConfigureComponents;
-const static auto& putNetworkPortCollection = privilegeSetConfigureComponents;
-const static auto& deleteNetworkPortCollection = privilegeSetConfigureComponents;
+static constexpr const auto& getNetworkPortCollection = privilegeSetLogin;
+static constexpr const auto& headNetworkPortCollection = privilegeSetLogin;
+static constexpr const auto& patchNetworkPortCollection = privilegeSetConfigureComponents;
+static constexpr const auto& postNetworkPortCollection = privilegeSetConfigureComponents;
+static constexpr const auto& putNetworkPortCollection = privilegeSetConfigureComponents;
+static constexpr const auto& deleteNetworkPortCollection = privilegeSetConfigureComponents;
 
 // OperatingConfig
-const static auto& getOperatingConfig = privilegeSetLogin;
-const static auto& headOperatingConfig = privilegeSetLogin;
-const static auto& patchOperatingConfig = privilegeSetConfigureComponents;
-const static auto& postOperatingConfig = privilegeSetConfigureComponents;
-const static auto& putOperatingConfig = privilegeSetConfigureComponents;
-const static auto& deleteOperatingConfig = privilegeSetConfigureComponents;
+static constexpr const auto& getOperatingConfig = privilegeSetLogin;
+static constexpr const auto& headOperatingConfig = privilegeSetLogin;
+static constexpr const auto& patchOperatingConfig = privilegeSetConfigureComponents;
+static constexpr const auto& postOperatingConfig = privilegeSetConfigureComponents;
+static constexpr const auto& putOperatingConfig = privilegeSetConfigureComponents;
+static constexpr const auto& deleteOperatingConfig = privilegeSetConfigureComponents;
 
 // OperatingConfigCollection
-const static auto& getOperatingConfigCollection = privilegeSetLogin;
-const static auto& headOperatingConfigCollection = privilegeSetLogin;
-const static auto& patchOperatingConfigCollection = privilegeSetConfigureComponents;
-const static auto& postOperatingConfigCollection = privilegeSetConfigureComponents;
-const static auto& putOperatingConfigCollection = privilegeSetConfigureComponents;
-const static auto& deleteOperatingConfigCollection = privilegeSetConfigureComponents;
+static constexpr const auto& getOperatingConfigCollection = privilegeSetLogin;
+static constexpr const auto& headOperatingConfigCollection = privilegeSetLogin;
+static constexpr const auto& patchOperatingConfigCollection = privilegeSetConfigureComponents;
+static constexpr const auto& postOperatingConfigCollection = privilegeSetConfigureComponents;
+static constexpr const auto& putOperatingConfigCollection = privilegeSetConfigureComponents;
+static constexpr const auto& deleteOperatingConfigCollection = privilegeSetConfigureComponents;
 
 // OperatingSystem
-const static auto& getOperatingSystem = privilegeSetLogin;
-const static auto& headOperatingSystem = privilegeSetLogin;
-const static auto& patchOperatingSystem = privilegeSetConfigureComponents;
-const static auto& postOperatingSystem = privilegeSetConfigureComponents;
-const static auto& putOperatingSystem = privilegeSetConfigureComponents;
-const static auto& deleteOperatingSystem = privilegeSetConfigureComponents;
+static constexpr const auto& getOperatingSystem = privilegeSetLogin;
+static constexpr const auto& headOperatingSystem = privilegeSetLogin;
+static constexpr const auto& patchOperatingSystem = privilegeSetConfigureComponents;
+static constexpr const auto& postOperatingSystem = privilegeSetConfigureComponents;
+static constexpr const auto& putOperatingSystem = privilegeSetConfigureComponents;
+static constexpr const auto& deleteOperatingSystem = privilegeSetConfigureComponents;
 
 // OutboundConnection
-const static auto& getOutboundConnection = privilegeSetLogin;
-const static auto& headOutboundConnection = privilegeSetLogin;
-const static auto& patchOutboundConnection = privilegeSetConfigureManager;
-const static auto& putOutboundConnection = privilegeSetConfigureManager;
-const static auto& deleteOutboundConnection = privilegeSetConfigureManager;
-const static auto& postOutboundConnection = privilegeSetConfigureManager;
+static constexpr const auto& getOutboundConnection = privilegeSetLogin;
+static constexpr const auto& headOutboundConnection = privilegeSetLogin;
+static constexpr const auto& patchOutboundConnection = privilegeSetConfigureManager;
+static constexpr const auto& putOutboundConnection = privilegeSetConfigureManager;
+static constexpr const auto& deleteOutboundConnection = privilegeSetConfigureManager;
+static constexpr const auto& postOutboundConnection = privilegeSetConfigureManager;
 
 // OutboundConnectionCollection
-const static auto& getOutboundConnectionCollection = privilegeSetLogin;
-const static auto& headOutboundConnectionCollection = privilegeSetLogin;
-const static auto& patchOutboundConnectionCollection = privilegeSetConfigureManager;
-const static auto& putOutboundConnectionCollection = privilegeSetConfigureManager;
-const static auto& deleteOutboundConnectionCollection = privilegeSetConfigureManager;
-const static auto& postOutboundConnectionCollection = privilegeSetConfigureManager;
+static constexpr const auto& getOutboundConnectionCollection = privilegeSetLogin;
+static constexpr const auto& headOutboundConnectionCollection = privilegeSetLogin;
+static constexpr const auto& patchOutboundConnectionCollection = privilegeSetConfigureManager;
+static constexpr const auto& putOutboundConnectionCollection = privilegeSetConfigureManager;
+static constexpr const auto& deleteOutboundConnectionCollection = privilegeSetConfigureManager;
+static constexpr const auto& postOutboundConnectionCollection = privilegeSetConfigureManager;
 
 // Outlet
-const static auto& getOutlet = privilegeSetLogin;
-const static auto& headOutlet = privilegeSetLogin;
-const static auto& patchOutlet = privilegeSetConfigureComponents;
-const static auto& postOutlet = privilegeSetConfigureComponents;
-const static auto& putOutlet = privilegeSetConfigureComponents;
-const static auto& deleteOutlet = privilegeSetConfigureComponents;
+static constexpr const auto& getOutlet = privilegeSetLogin;
+static constexpr const auto& headOutlet = privilegeSetLogin;
+static constexpr const auto& patchOutlet = privilegeSetConfigureComponents;
+static constexpr const auto& postOutlet = privilegeSetConfigureComponents;
+static constexpr const auto& putOutlet = privilegeSetConfigureComponents;
+static constexpr const auto& deleteOutlet = privilegeSetConfigureComponents;
 
 // OutletCollection
-const static auto& getOutletCollection = privilegeSetLogin;
-const static auto& headOutletCollection = privilegeSetLogin;
-const static auto& patchOutletCollection = privilegeSetConfigureComponents;
-const static auto& postOutletCollection = privilegeSetConfigureComponents;
-const static auto& putOutletCollection = privilegeSetConfigureComponents;
-const static auto& deleteOutletCollection = privilegeSetConfigureComponents;
+static constexpr const auto& getOutletCollection = privilegeSetLogin;
+static constexpr const auto& headOutletCollection = privilegeSetLogin;
+static constexpr const auto& patchOutletCollection = privilegeSetConfigureComponents;
+static constexpr const auto& postOutletCollection = privilegeSetConfigureComponents;
+static constexpr const auto& putOutletCollection = privilegeSetConfigureComponents;
+static constexpr const auto& deleteOutletCollection = privilegeSetConfigureComponents;
 
 // OutletGroup
-const static auto& getOutletGroup = privilegeSetLogin;
-const static auto& headOutletGroup = privilegeSetLogin;
-const static auto& patchOutletGroup = privilegeSetConfigureComponents;
-const static auto& postOutletGroup = privilegeSetConfigureComponents;
-const static auto& putOutletGroup = privilegeSetConfigureComponents;
-const static auto& deleteOutletGroup = privilegeSetConfigureComponents;
+static constexpr const auto& getOutletGroup = privilegeSetLogin;
+static constexpr const auto& headOutletGroup = privilegeSetLogin;
+static constexpr const auto& patchOutletGroup = privilegeSetConfigureComponents;
+static constexpr const auto& postOutletGroup = privilegeSetConfigureComponents;
+static constexpr const auto& putOutletGroup = privilegeSetConfigureComponents;
+static constexpr const auto& deleteOutletGroup = privilegeSetConfigureComponents;
 
 // OutletGroupCollection
-const static auto& getOutletGroupCollection = privilegeSetLogin;
-const static auto& headOutletGroupCollection = privilegeSetLogin;
-const static auto& patchOutletGroupCollection = privilegeSetConfigureComponents;
-const static auto& postOutletGroupCollection = privilegeSetConfigureComponents;
-const static auto& putOutletGroupCollection = privilegeSetConfigureComponents;
-const static auto& deleteOutletGroupCollection = privilegeSetConfigureComponents;
+static constexpr const auto& getOutletGroupCollection = privilegeSetLogin;
+static constexpr const auto& headOutletGroupCollection = privilegeSetLogin;
+static constexpr const auto& patchOutletGroupCollection = privilegeSetConfigureComponents;
+static constexpr const auto& postOutletGroupCollection = privilegeSetConfigureComponents;
+static constexpr const auto& putOutletGroupCollection = privilegeSetConfigureComponents;
+static constexpr const auto& deleteOutletGroupCollection = privilegeSetConfigureComponents;
 
 // PCIeDevice
-const static auto& getPCIeDevice = privilegeSetLogin;
-const static auto& headPCIeDevice = privilegeSetLogin;
-const static auto& patchPCIeDevice = privilegeSetConfigureComponents;
-const static auto& postPCIeDevice = privilegeSetConfigureComponents;
-const static auto& putPCIeDevice = privilegeSetConfigureComponents;
-const static auto& deletePCIeDevice = privilegeSetConfigureComponents;
+static constexpr const auto& getPCIeDevice = privilegeSetLogin;
+static constexpr const auto& headPCIeDevice = privilegeSetLogin;
+static constexpr const auto& patchPCIeDevice = privilegeSetConfigureComponents;
+static constexpr const auto& postPCIeDevice = privilegeSetConfigureComponents;
+static constexpr const auto& putPCIeDevice = privilegeSetConfigureComponents;
+static constexpr const auto& deletePCIeDevice = privilegeSetConfigureComponents;
 
 // PCIeDeviceCollection
-const static auto& getPCIeDeviceCollection = privilegeSetLogin;
-const static auto& headPCIeDeviceCollection = privilegeSetLogin;
-const static auto& patchPCIeDeviceCollection = privilegeSetConfigureComponents;
-const static auto& postPCIeDeviceCollection = privilegeSetConfigureComponents;
-const static auto& putPCIeDeviceCollection = privilegeSetConfigureComponents;
-const static auto& deletePCIeDeviceCollection = privilegeSetConfigureComponents;
+static constexpr const auto& getPCIeDeviceCollection = privilegeSetLogin;
+static constexpr const auto& headPCIeDeviceCollection = privilegeSetLogin;
+static constexpr const auto& patchPCIeDeviceCollection = privilegeSetConfigureComponents;
+static constexpr const auto& postPCIeDeviceCollection = privilegeSetConfigureComponents;
+static constexpr const auto& putPCIeDeviceCollection = privilegeSetConfigureComponents;
+static constexpr const auto& deletePCIeDeviceCollection = privilegeSetConfigureComponents;
 
 // PCIeFunction
-const static auto& getPCIeFunction = privilegeSetLogin;
-const static auto& headPCIeFunction = privilegeSetLogin;
-const static auto& patchPCIeFunction = privilegeSetConfigureComponents;
-const static auto& postPCIeFunction = privilegeSetConfigureComponents;
-const static auto& putPCIeFunction = privilegeSetConfigureComponents;
-const static auto& deletePCIeFunction = privilegeSetConfigureComponents;
+static constexpr const auto& getPCIeFunction = privilegeSetLogin;
+static constexpr const auto& headPCIeFunction = privilegeSetLogin;
+static constexpr const auto& patchPCIeFunction = privilegeSetConfigureComponents;
+static constexpr const auto& postPCIeFunction = privilegeSetConfigureComponents;
+static constexpr const auto& putPCIeFunction = privilegeSetConfigureComponents;
+static constexpr const auto& deletePCIeFunction = privilegeSetConfigureComponents;
 
 // PCIeFunctionCollection
-const static auto& getPCIeFunctionCollection = privilegeSetLogin;
-const static auto& headPCIeFunctionCollection = privilegeSetLogin;
-const static auto& patchPCIeFunctionCollection = privilegeSetConfigureComponents;
-const static auto& postPCIeFunctionCollection = privilegeSetConfigureComponents;
-const static auto& putPCIeFunctionCollection = privilegeSetConfigureComponents;
-const static auto& deletePCIeFunctionCollection = privilegeSetConfigureComponents;
+static constexpr const auto& getPCIeFunctionCollection = privilegeSetLogin;
+static constexpr const auto& headPCIeFunctionCollection = privilegeSetLogin;
+static constexpr const auto& patchPCIeFunctionCollection = privilegeSetConfigureComponents;
+static constexpr const auto& postPCIeFunctionCollection = privilegeSetConfigureComponents;
+static constexpr const auto& putPCIeFunctionCollection = privilegeSetConfigureComponents;
+static constexpr const auto& deletePCIeFunctionCollection = privilegeSetConfigureComponents;
 
 // PCIeSlots
-const static auto& getPCIeSlots = privilegeSetLogin;
-const static auto& headPCIeSlots = privilegeSetLogin;
-const static auto& patchPCIeSlots = privilegeSetConfigureComponents;
-const static auto& postPCIeSlots = privilegeSetConfigureComponents;
-const static auto& putPCIeSlots = privilegeSetConfigureComponents;
-const static auto& deletePCIeSlots = privilegeSetConfigureComponents;
+static constexpr const auto& getPCIeSlots = privilegeSetLogin;
+static constexpr const auto& headPCIeSlots = privilegeSetLogin;
+static constexpr const auto& patchPCIeSlots = privilegeSetConfigureComponents;
+static constexpr const auto& postPCIeSlots = privilegeSetConfigureComponents;
+static constexpr const auto& putPCIeSlots = privilegeSetConfigureComponents;
+static constexpr const auto& deletePCIeSlots = privilegeSetConfigureComponents;
 
 // Port
-const static auto& getPort = privilegeSetLogin;
-const static auto& headPort = privilegeSetLogin;
-const static auto& patchPort = privilegeSetConfigureComponents;
-const static auto& postPort = privilegeSetConfigureComponents;
-const static auto& putPort = privilegeSetConfigureComponents;
-const static auto& deletePort = privilegeSetConfigureComponents;
+static constexpr const auto& getPort = privilegeSetLogin;
+static constexpr const auto& headPort = privilegeSetLogin;
+static constexpr const auto& patchPort = privilegeSetConfigureComponents;
+static constexpr const auto& postPort = privilegeSetConfigureComponents;
+static constexpr const auto& putPort = privilegeSetConfigureComponents;
+static constexpr const auto& deletePort = privilegeSetConfigureComponents;
 
 // PortCollection
-const static auto& getPortCollection = privilegeSetLogin;
-const static auto& headPortCollection = privilegeSetLogin;
-const static auto& patchPortCollection = privilegeSetConfigureComponents;
-const static auto& postPortCollection = privilegeSetConfigureComponents;
-const static auto& putPortCollection = privilegeSetConfigureComponents;
-const static auto& deletePortCollection = privilegeSetConfigureComponents;
+static constexpr const auto& getPortCollection = privilegeSetLogin;
+static constexpr const auto& headPortCollection = privilegeSetLogin;
+static constexpr const auto& patchPortCollection = privilegeSetConfigureComponents;
+static constexpr const auto& postPortCollection = privilegeSetConfigureComponents;
+static constexpr const auto& putPortCollection = privilegeSetConfigureComponents;
+static constexpr const auto& deletePortCollection = privilegeSetConfigureComponents;
 
 // PortMetrics
-const static auto& getPortMetrics = privilegeSetLogin;
-const static auto& headPortMetrics = privilegeSetLogin;
-const static auto& patchPortMetrics = privilegeSetConfigureComponents;
-const static auto& postPortMetrics = privilegeSetConfigureComponents;
-const static auto& putPortMetrics = privilegeSetConfigureComponents;
-const static auto& deletePortMetrics = privilegeSetConfigureComponents;
+static constexpr const auto& getPortMetrics = privilegeSetLogin;
+static constexpr const auto& headPortMetrics = privilegeSetLogin;
+static constexpr const auto& patchPortMetrics = privilegeSetConfigureComponents;
+static constexpr const auto& postPortMetrics = privilegeSetConfigureComponents;
+static constexpr const auto& putPortMetrics = privilegeSetConfigureComponents;
+static constexpr const auto& deletePortMetrics = privilegeSetConfigureComponents;
 
 // Power
-const static auto& getPower = privilegeSetLogin;
-const static auto& headPower = privilegeSetLogin;
-const static auto& patchPower = privilegeSetConfigureManager;
-const static auto& putPower = privilegeSetConfigureManager;
-const static auto& deletePower = privilegeSetConfigureManager;
-const static auto& postPower = privilegeSetConfigureManager;
+static constexpr const auto& getPower = privilegeSetLogin;
+static constexpr const auto& headPower = privilegeSetLogin;
+static constexpr const auto& patchPower = privilegeSetConfigureManager;
+static constexpr const auto& putPower = privilegeSetConfigureManager;
+static constexpr const auto& deletePower = privilegeSetConfigureManager;
+static constexpr const auto& postPower = privilegeSetConfigureManager;
 
 // PowerDistribution
-const static auto& getPowerDistribution = privilegeSetLogin;
-const static auto& headPowerDistribution = privilegeSetLogin;
-const static auto& patchPowerDistribution = privilegeSetConfigureComponents;
-const static auto& postPowerDistribution = privilegeSetConfigureComponents;
-const static auto& putPowerDistribution = privilegeSetConfigureComponents;
-const static auto& deletePowerDistribution = privilegeSetConfigureComponents;
+static constexpr const auto& getPowerDistribution = privilegeSetLogin;
+static constexpr const auto& headPowerDistribution = privilegeSetLogin;
+static constexpr const auto& patchPowerDistribution = privilegeSetConfigureComponents;
+static constexpr const auto& postPowerDistribution = privilegeSetConfigureComponents;
+static constexpr const auto& putPowerDistribution = privilegeSetConfigureComponents;
+static constexpr const auto& deletePowerDistribution = privilegeSetConfigureComponents;
 
 // PowerDistributionCollection
-const static auto& getPowerDistributionCollection = privilegeSetLogin;
-const static auto& headPowerDistributionCollection = privilegeSetLogin;
-const static auto& patchPowerDistributionCollection = privilegeSetConfigureComponents;
-const static auto& postPowerDistributionCollection = privilegeSetConfigureComponents;
-const static auto& putPowerDistributionCollection = privilegeSetConfigureComponents;
-const static auto& deletePowerDistributionCollection = privilegeSetConfigureComponents;
+static constexpr const auto& getPowerDistributionCollection = privilegeSetLogin;
+static constexpr const auto& headPowerDistributionCollection = privilegeSetLogin;
+static constexpr const auto& patchPowerDistributionCollection = privilegeSetConfigureComponents;
+static constexpr const auto& postPowerDistributionCollection = privilegeSetConfigureComponents;
+static constexpr const auto& putPowerDistributionCollection = privilegeSetConfigureComponents;
+static constexpr const auto& deletePowerDistributionCollection = privilegeSetConfigureComponents;
 
 // PowerDistributionMetrics
-const static auto& getPowerDistributionMetrics = privilegeSetLogin;
-const static auto& headPowerDistributionMetrics = privilegeSetLogin;
-const static auto& patchPowerDistributionMetrics = privilegeSetConfigureComponents;
-const static auto& postPowerDistributionMetrics = privilegeSetConfigureComponents;
-const static auto& putPowerDistributionMetrics = privilegeSetConfigureComponents;
-const static auto& deletePowerDistributionMetrics = privilegeSetConfigureComponents;
+static constexpr const auto& getPowerDistributionMetrics = privilegeSetLogin;
+static constexpr const auto& headPowerDistributionMetrics = privilegeSetLogin;
+static constexpr const auto& patchPowerDistributionMetrics = privilegeSetConfigureComponents;
+static constexpr const auto& postPowerDistributionMetrics = privilegeSetConfigureComponents;
+static constexpr const auto& putPowerDistributionMetrics = privilegeSetConfigureComponents;
+static constexpr const auto& deletePowerDistributionMetrics = privilegeSetConfigureComponents;
 
 // PowerDomain
-const static auto& getPowerDomain = privilegeSetLogin;
-const static auto& headPowerDomain = privilegeSetLogin;
-const static auto& patchPowerDomain = privilegeSetConfigureManager;
-const static auto& putPowerDomain = privilegeSetConfigureManager;
-const static auto& deletePowerDomain = privilegeSetConfigureManager;
-const static auto& postPowerDomain = privilegeSetConfigureManager;
+static constexpr const auto& getPowerDomain = privilegeSetLogin;
+static constexpr const auto& headPowerDomain = privilegeSetLogin;
+static constexpr const auto& patchPowerDomain = privilegeSetConfigureManager;
+static constexpr const auto& putPowerDomain = privilegeSetConfigureManager;
+static constexpr const auto& deletePowerDomain = privilegeSetConfigureManager;
+static constexpr const auto& postPowerDomain = privilegeSetConfigureManager;
 
 // PowerDomainCollection
-const static auto& getPowerDomainCollection = privilegeSetLogin;
-const static auto& headPowerDomainCollection = privilegeSetLogin;
-const static auto& patchPowerDomainCollection = privilegeSetConfigureManager;
-const static auto& putPowerDomainCollection = privilegeSetConfigureManager;
-const static auto& deletePowerDomainCollection = privilegeSetConfigureManager;
-const static auto& postPowerDomainCollection = privilegeSetConfigureManager;
+static constexpr const auto& getPowerDomainCollection = privilegeSetLogin;
+static constexpr const auto& headPowerDomainCollection = privilegeSetLogin;
+static constexpr const auto& patchPowerDomainCollection = privilegeSetConfigureManager;
+static constexpr const auto& putPowerDomainCollection = privilegeSetConfigureManager;
+static constexpr const auto& deletePowerDomainCollection = privilegeSetConfigureManager;
+static constexpr const auto& postPowerDomainCollection = privilegeSetConfigureManager;
 
 // PowerEquipment
-const static auto& getPowerEquipment = privilegeSetLogin;
-const static auto& headPowerEquipment = privilegeSetLogin;
-const static auto& patchPowerEquipment = privilegeSetConfigureManager;
-const static auto& putPowerEquipment = privilegeSetConfigureManager;
-const static auto& deletePowerEquipment = privilegeSetConfigureManager;
-const static auto& postPowerEquipment = privilegeSetConfigureManager;
+static constexpr const auto& getPowerEquipment = privilegeSetLogin;
+static constexpr const auto& headPowerEquipment = privilegeSetLogin;
+static constexpr const auto& patchPowerEquipment = privilegeSetConfigureManager;
+static constexpr const auto& putPowerEquipment = privilegeSetConfigureManager;
+static constexpr const auto& deletePowerEquipment = privilegeSetConfigureManager;
+static constexpr const auto& postPowerEquipment = privilegeSetConfigureManager;
 
 // PowerSubsystem
-const static auto& getPowerSubsystem = privilegeSetLogin;
-const static auto& headPowerSubsystem = privilegeSetLogin;
-const static auto& patchPowerSubsystem = privilegeSetConfigureManager;
-const static auto& putPowerSubsystem = privilegeSetConfigureManager;
-const static auto& deletePowerSubsystem = privilegeSetConfigureManager;
-const static auto& postPowerSubsystem = privilegeSetConfigureManager;
+static constexpr const auto& getPowerSubsystem = privilegeSetLogin;
+static constexpr const auto& headPowerSubsystem = privilegeSetLogin;
+static constexpr const auto& patchPowerSubsystem = privilegeSetConfigureManager;
+static constexpr const auto& putPowerSubsystem = privilegeSetConfigureManager;
+static constexpr const auto& deletePowerSubsystem = privilegeSetConfigureManager;
+static constexpr const auto& postPowerSubsystem = privilegeSetConfigureManager;
 
 // PowerSupply
-const static auto& getPowerSupply = privilegeSetLogin;
-const static auto& headPowerSupply = privilegeSetLogin;
-const static auto& patchPowerSupply = privilegeSetConfigureManager;
-const static auto& putPowerSupply = privilegeSetConfigureManager;
-const static auto& deletePowerSupply = privilegeSetConfigureManager;
-const static auto& postPowerSupply = privilegeSetConfigureManager;
+static constexpr const auto& getPowerSupply = privilegeSetLogin;
+static constexpr const auto& headPowerSupply = privilegeSetLogin;
+static constexpr const auto& patchPowerSupply = privilegeSetConfigureManager;
+static constexpr const auto& putPowerSupply = privilegeSetConfigureManager;
+static constexpr const auto& deletePowerSupply = privilegeSetConfigureManager;
+static constexpr const auto& postPowerSupply = privilegeSetConfigureManager;
 
 // PowerSupplyCollection
-const static auto& getPowerSupplyCollection = privilegeSetLogin;
-const static auto& headPowerSupplyCollection = privilegeSetLogin;
-const static auto& patchPowerSupplyCollection = privilegeSetConfigureManager;
-const static auto& putPowerSupplyCollection = privilegeSetConfigureManager;
-const static auto& deletePowerSupplyCollection = privilegeSetConfigureManager;
-const static auto& postPowerSupplyCollection = privilegeSetConfigureManager;
+static constexpr const auto& getPowerSupplyCollection = privilegeSetLogin;
+static constexpr const auto& headPowerSupplyCollection = privilegeSetLogin;
+static constexpr const auto& patchPowerSupplyCollection = privilegeSetConfigureManager;
+static constexpr const auto& putPowerSupplyCollection = privilegeSetConfigureManager;
+static constexpr const auto& deletePowerSupplyCollection = privilegeSetConfigureManager;
+static constexpr const auto& postPowerSupplyCollection = privilegeSetConfigureManager;
 
 // PowerSupplyMetrics
-const static auto& getPowerSupplyMetrics = privilegeSetLogin;
-const static auto& headPowerSupplyMetrics = privilegeSetLogin;
-const static auto& patchPowerSupplyMetrics = privilegeSetConfigureManager;
-const static auto& putPowerSupplyMetrics = privilegeSetConfigureManager;
-const static auto& deletePowerSupplyMetrics = privilegeSetConfigureManager;
-const static auto& postPowerSupplyMetrics = privilegeSetConfigureManager;
+static constexpr const auto& getPowerSupplyMetrics = privilegeSetLogin;
+static constexpr const auto& headPowerSupplyMetrics = privilegeSetLogin;
+static constexpr const auto& patchPowerSupplyMetrics = privilegeSetConfigureManager;
+static constexpr const auto& putPowerSupplyMetrics = privilegeSetConfigureManager;
+static constexpr const auto& deletePowerSupplyMetrics = privilegeSetConfigureManager;
+static constexpr const auto& postPowerSupplyMetrics = privilegeSetConfigureManager;
 
 // PrivilegeRegistry
-const static auto& getPrivilegeRegistry = privilegeSetLogin;
-const static auto& headPrivilegeRegistry = privilegeSetLogin;
-const static auto& patchPrivilegeRegistry = privilegeSetConfigureManager;
-const static auto& postPrivilegeRegistry = privilegeSetConfigureManager;
-const static auto& putPrivilegeRegistry = privilegeSetConfigureManager;
-const static auto& deletePrivilegeRegistry = privilegeSetConfigureManager;
+static constexpr const auto& getPrivilegeRegistry = privilegeSetLogin;
+static constexpr const auto& headPrivilegeRegistry = privilegeSetLogin;
+static constexpr const auto& patchPrivilegeRegistry = privilegeSetConfigureManager;
+static constexpr const auto& postPrivilegeRegistry = privilegeSetConfigureManager;
+static constexpr const auto& putPrivilegeRegistry = privilegeSetConfigureManager;
+static constexpr const auto& deletePrivilegeRegistry = privilegeSetConfigureManager;
 
 // Processor
-const static auto& getProcessor = privilegeSetLogin;
-const static auto& headProcessor = privilegeSetLogin;
-const static auto& patchProcessor = privilegeSetConfigureComponents;
-const static auto& putProcessor = privilegeSetConfigureComponents;
-const static auto& deleteProcessor = privilegeSetConfigureComponents;
-const static auto& postProcessor = privilegeSetConfigureComponents;
+static constexpr const auto& getProcessor = privilegeSetLogin;
+static constexpr const auto& headProcessor = privilegeSetLogin;
+static constexpr const auto& patchProcessor = privilegeSetConfigureComponents;
+static constexpr const auto& putProcessor = privilegeSetConfigureComponents;
+static constexpr const auto& deleteProcessor = privilegeSetConfigureComponents;
+static constexpr const auto& postProcessor = privilegeSetConfigureComponents;
 
 // ProcessorCollection
-const static auto& getProcessorCollection = privilegeSetLogin;
-const static auto& headProcessorCollection = privilegeSetLogin;
-const static auto& patchProcessorCollection = privilegeSetConfigureComponents;
-const static auto& putProcessorCollection = privilegeSetConfigureComponents;
-const static auto& deleteProcessorCollection = privilegeSetConfigureComponents;
-const static auto& postProcessorCollection = privilegeSetConfigureComponents;
+static constexpr const auto& getProcessorCollection = privilegeSetLogin;
+static constexpr const auto& headProcessorCollection = privilegeSetLogin;
+static constexpr const auto& patchProcessorCollection = privilegeSetConfigureComponents;
+static constexpr const auto& putProcessorCollection = privilegeSetConfigureComponents;
+static constexpr const auto& deleteProcessorCollection = privilegeSetConfigureComponents;
+static constexpr const auto& postProcessorCollection = privilegeSetConfigureComponents;
 
 // ProcessorMetrics
-const static auto& getProcessorMetrics = privilegeSetLogin;
-const static auto& headProcessorMetrics = privilegeSetLogin;
-const static auto& patchProcessorMetrics = privilegeSetConfigureComponents;
-const static auto& putProcessorMetrics = privilegeSetConfigureComponents;
-const static auto& deleteProcessorMetrics = privilegeSetConfigureComponents;
-const static auto& postProcessorMetrics = privilegeSetConfigureComponents;
+static constexpr const auto& getProcessorMetrics = privilegeSetLogin;
+static constexpr const auto& headProcessorMetrics = privilegeSetLogin;
+static constexpr const auto& patchProcessorMetrics = privilegeSetConfigureComponents;
+static constexpr const auto& putProcessorMetrics = privilegeSetConfigureComponents;
+static constexpr const auto& deleteProcessorMetrics = privilegeSetConfigureComponents;
+static constexpr const auto& postProcessorMetrics = privilegeSetConfigureComponents;
 
 // Pump
-const static auto& getPump = privilegeSetLogin;
-const static auto& headPump = privilegeSetLogin;
-const static auto& patchPump = privilegeSetConfigureComponents;
-const static auto& putPump = privilegeSetConfigureComponents;
-const static auto& deletePump = privilegeSetConfigureComponents;
-const static auto& postPump = privilegeSetConfigureComponents;
+static constexpr const auto& getPump = privilegeSetLogin;
+static constexpr const auto& headPump = privilegeSetLogin;
+static constexpr const auto& patchPump = privilegeSetConfigureComponents;
+static constexpr const auto& putPump = privilegeSetConfigureComponents;
+static constexpr const auto& deletePump = privilegeSetConfigureComponents;
+static constexpr const auto& postPump = privilegeSetConfigureComponents;
 
 // PumpCollection
-const static auto& getPumpCollection = privilegeSetLogin;
-const static auto& headPumpCollection = privilegeSetLogin;
-const static auto& patchPumpCollection = privilegeSetConfigureComponents;
-const static auto& putPumpCollection = privilegeSetConfigureComponents;
-const static auto& deletePumpCollection = privilegeSetConfigureComponents;
-const static auto& postPumpCollection = privilegeSetConfigureComponents;
+static constexpr const auto& getPumpCollection = privilegeSetLogin;
+static constexpr const auto& headPumpCollection = privilegeSetLogin;
+static constexpr const auto& patchPumpCollection = privilegeSetConfigureComponents;
+static constexpr const auto& putPumpCollection = privilegeSetConfigureComponents;
+static constexpr const auto& deletePumpCollection = privilegeSetConfigureComponents;
+static constexpr const auto& postPumpCollection = privilegeSetConfigureComponents;
 
 // RegisteredClient
-const static auto& getRegisteredClient = privilegeSetLogin;
-const static auto& headRegisteredClient = privilegeSetLogin;
-const static auto& patchRegisteredClient = privilegeSetConfigureManagerOrConfigureSelf;
-const static auto& postRegisteredClient = privilegeSetConfigureManagerOrConfigureSelf;
-const static auto& putRegisteredClient = privilegeSetConfigureManagerOrConfigureSelf;
-const static auto& deleteRegisteredClient = privilegeSetConfigureManagerOrConfigureSelf;
+static constexpr const auto& getRegisteredClient = privilegeSetLogin;
+static constexpr const auto& headRegisteredClient = privilegeSetLogin;
+static constexpr const auto& patchRegisteredClient = privilegeSetConfigureManagerOrConfigureSelf;
+static constexpr const auto& postRegisteredClient = privilegeSetConfigureManagerOrConfigureSelf;
+static constexpr const auto& putRegisteredClient = privilegeSetConfigureManagerOrConfigureSelf;
+static constexpr const auto& deleteRegisteredClient = privilegeSetConfigureManagerOrConfigureSelf;
 
 // RegisteredClientCollection
-const static auto& getRegisteredClientCollection = privilegeSetLogin;
-const static auto& headRegisteredClientCollection = privilegeSetLogin;
-const static auto& patchRegisteredClientCollection = privilegeSetConfigureManagerOrConfigureComponents;
-const static auto& postRegisteredClientCollection = privilegeSetConfigureManagerOrConfigureComponents;
-const static auto& putRegisteredClientCollection = privilegeSetConfigureManagerOrConfigureComponents;
-const static auto& deleteRegisteredClientCollection = privilegeSetConfigureManagerOrConfigureComponents;
+static constexpr const auto& getRegisteredClientCollection = privilegeSetLogin;
+static constexpr const auto& headRegisteredClientCollection = privilegeSetLogin;
+static constexpr const auto& patchRegisteredClientCollection = privilegeSetConfigureManagerOrConfigureComponents;
+static constexpr const auto& postRegisteredClientCollection = privilegeSetConfigureManagerOrConfigureComponents;
+static constexpr const auto& putRegisteredClientCollection = privilegeSetConfigureManagerOrConfigureComponents;
+static constexpr const auto& deleteRegisteredClientCollection = privilegeSetConfigureManagerOrConfigureComponents;
 
 // Reservoir
-const static auto& getReservoir = privilegeSetLogin;
-const static auto& headReservoir = privilegeSetLogin;
-const static auto& patchReservoir = privilegeSetConfigureComponents;
-const static auto& putReservoir = privilegeSetConfigureComponents;
-const static auto& deleteReservoir = privilegeSetConfigureComponents;
-const static auto& postReservoir = privilegeSetConfigureComponents;
+static constexpr const auto& getReservoir = privilegeSetLogin;
+static constexpr const auto& headReservoir = privilegeSetLogin;
+static constexpr const auto& patchReservoir = privilegeSetConfigureComponents;
+static constexpr const auto& putReservoir = privilegeSetConfigureComponents;
+static constexpr const auto& deleteReservoir = privilegeSetConfigureComponents;
+static constexpr const auto& postReservoir = privilegeSetConfigureComponents;
 
 // ReservoirCollection
-const static auto& getReservoirCollection = privilegeSetLogin;
-const static auto& headReservoirCollection = privilegeSetLogin;
-const static auto& patchReservoirCollection = privilegeSetConfigureComponents;
-const static auto& putReservoirCollection = privilegeSetConfigureComponents;
-const static auto& deleteReservoirCollection = privilegeSetConfigureComponents;
-const static auto& postReservoirCollection = privilegeSetConfigureComponents;
+static constexpr const auto& getReservoirCollection = privilegeSetLogin;
+static constexpr const auto& headReservoirCollection = privilegeSetLogin;
+static constexpr const auto& patchReservoirCollection = privilegeSetConfigureComponents;
+static constexpr const auto& putReservoirCollection = privilegeSetConfigureComponents;
+static constexpr const auto& deleteReservoirCollection = privilegeSetConfigureComponents;
+static constexpr const auto& postReservoirCollection = privilegeSetConfigureComponents;
 
 // ResourceBlock
-const static auto& getResourceBlock = privilegeSetLogin;
-const static auto& headResourceBlock = privilegeSetLogin;
-const static auto& patchResourceBlock = privilegeSetConfigureComponents;
-const static auto& putResourceBlock = privilegeSetConfigureComponents;
-const static auto& deleteResourceBlock = privilegeSetConfigureComponents;
-const static auto& postResourceBlock = privilegeSetConfigureComponents;
+static constexpr const auto& getResourceBlock = privilegeSetLogin;
+static constexpr const auto& headResourceBlock = privilegeSetLogin;
+static constexpr const auto& patchResourceBlock = privilegeSetConfigureComponents;
+static constexpr const auto& putResourceBlock = privilegeSetConfigureComponents;
+static constexpr const auto& deleteResourceBlock = privilegeSetConfigureComponents;
+static constexpr const auto& postResourceBlock = privilegeSetConfigureComponents;
 
 // ResourceBlockCollection
-const static auto& getResourceBlockCollection = privilegeSetLogin;
-const static auto& headResourceBlockCollection = privilegeSetLogin;
-const static auto& patchResourceBlockCollection = privilegeSetConfigureComponents;
-const static auto& putResourceBlockCollection = privilegeSetConfigureComponents;
-const static auto& deleteResourceBlockCollection = privilegeSetConfigureComponents;
-const static auto& postResourceBlockCollection = privilegeSetConfigureComponents;
+static constexpr const auto& getResourceBlockCollection = privilegeSetLogin;
+static constexpr const auto& headResourceBlockCollection = privilegeSetLogin;
+static constexpr const auto& patchResourceBlockCollection = privilegeSetConfigureComponents;
+static constexpr const auto& putResourceBlockCollection = privilegeSetConfigureComponents;
+static constexpr const auto& deleteResourceBlockCollection = privilegeSetConfigureComponents;
+static constexpr const auto& postResourceBlockCollection = privilegeSetConfigureComponents;
 
 // Role
-const static auto& getRole = privilegeSetLogin;
-const static auto& headRole = privilegeSetLogin;
-const static auto& patchRole = privilegeSetConfigureManager;
-const static auto& putRole = privilegeSetConfigureManager;
-const static auto& deleteRole = privilegeSetConfigureManager;
-const static auto& postRole = privilegeSetConfigureManager;
+static constexpr const auto& getRole = privilegeSetLogin;
+static constexpr const auto& headRole = privilegeSetLogin;
+static constexpr const auto& patchRole = privilegeSetConfigureManager;
+static constexpr const auto& putRole = privilegeSetConfigureManager;
+static constexpr const auto& deleteRole = privilegeSetConfigureManager;
+static constexpr const auto& postRole = privilegeSetConfigureManager;
 
 // RoleCollection
-const static auto& getRoleCollection = privilegeSetLogin;
-const static auto& headRoleCollection = privilegeSetLogin;
-const static auto& patchRoleCollection = privilegeSetConfigureManager;
-const static auto& putRoleCollection = privilegeSetConfigureManager;
-const static auto& deleteRoleCollection = privilegeSetConfigureManager;
-const static auto& postRoleCollection = privilegeSetConfigureManager;
+static constexpr const auto& getRoleCollection = privilegeSetLogin;
+static constexpr const auto& headRoleCollection = privilegeSetLogin;
+static constexpr const auto& patchRoleCollection = privilegeSetConfigureManager;
+static constexpr const auto& putRoleCollection = privilegeSetConfigureManager;
+static constexpr const auto& deleteRoleCollection = privilegeSetConfigureManager;
+static constexpr const auto& postRoleCollection = privilegeSetConfigureManager;
 
 // RouteEntry
-const static auto& getRouteEntry = privilegeSetLogin;
-const static auto& headRouteEntry = privilegeSetLogin;
-const static auto& patchRouteEntry = privilegeSetConfigureComponents;
-const static auto& putRouteEntry = privilegeSetConfigureComponents;
-const static auto& deleteRouteEntry = privilegeSetConfigureComponents;
-const static auto& postRouteEntry = privilegeSetConfigureComponents;
+static constexpr const auto& getRouteEntry = privilegeSetLogin;
+static constexpr const auto& headRouteEntry = privilegeSetLogin;
+static constexpr const auto& patchRouteEntry = privilegeSetConfigureComponents;
+static constexpr const auto& putRouteEntry = privilegeSetConfigureComponents;
+static constexpr const auto& deleteRouteEntry = privilegeSetConfigureComponents;
+static constexpr const auto& postRouteEntry = privilegeSetConfigureComponents;
 
 // RouteEntryCollection
-const static auto& getRouteEntryCollection = privilegeSetLogin;
-const static auto& headRouteEntryCollection = privilegeSetLogin;
-const static auto& patchRouteEntryCollection = privilegeSetConfigureComponents;
-const static auto& putRouteEntryCollection = privilegeSetConfigureComponents;
-const static auto& deleteRouteEntryCollection = privilegeSetConfigureComponents;
-const static auto& postRouteEntryCollection = privilegeSetConfigureComponents;
+static constexpr const auto& getRouteEntryCollection = privilegeSetLogin;
+static constexpr const auto& headRouteEntryCollection = privilegeSetLogin;
+static constexpr const auto& patchRouteEntryCollection = privilegeSetConfigureComponents;
+static constexpr const auto& putRouteEntryCollection = privilegeSetConfigureComponents;
+static constexpr const auto& deleteRouteEntryCollection = privilegeSetConfigureComponents;
+static constexpr const auto& postRouteEntryCollection = privilegeSetConfigureComponents;
 
 // RouteSetEntry
-const static auto& getRouteSetEntry = privilegeSetLogin;
-const static auto& headRouteSetEntry = privilegeSetLogin;
-const static auto& patchRouteSetEntry = privilegeSetConfigureComponents;
-const static auto& putRouteSetEntry = privilegeSetConfigureComponents;
-const static auto& deleteRouteSetEntry = privilegeSetConfigureComponents;
-const static auto& postRouteSetEntry = privilegeSetConfigureComponents;
+static constexpr const auto& getRouteSetEntry = privilegeSetLogin;
+static constexpr const auto& headRouteSetEntry = privilegeSetLogin;
+static constexpr const auto& patchRouteSetEntry = privilegeSetConfigureComponents;
+static constexpr const auto& putRouteSetEntry = privilegeSetConfigureComponents;
+static constexpr const auto& deleteRouteSetEntry = privilegeSetConfigureComponents;
+static constexpr const auto& postRouteSetEntry = privilegeSetConfigureComponents;
 
 // RouteSetEntryCollection
-const static auto& getRouteSetEntryCollection = privilegeSetLogin;
-const static auto& headRouteSetEntryCollection = privilegeSetLogin;
-const static auto& patchRouteSetEntryCollection = privilegeSetConfigureComponents;
-const static auto& putRouteSetEntryCollection = privilegeSetConfigureComponents;
-const static auto& deleteRouteSetEntryCollection = privilegeSetConfigureComponents;
-const static auto& postRouteSetEntryCollection = privilegeSetConfigureComponents;
+static constexpr const auto& getRouteSetEntryCollection = privilegeSetLogin;
+static constexpr const auto& headRouteSetEntryCollection = privilegeSetLogin;
+static constexpr const auto& patchRouteSetEntryCollection = privilegeSetConfigureComponents;
+static constexpr const auto& putRouteSetEntryCollection = privilegeSetConfigureComponents;
+static constexpr const auto& deleteRouteSetEntryCollection = privilegeSetConfigureComponents;
+static constexpr const auto& postRouteSetEntryCollection = privilegeSetConfigureComponents;
 
 // SecureBoot
-const static auto& getSecureBoot = privilegeSetLogin;
-const static auto& headSecureBoot = privilegeSetLogin;
-const static auto& patchSecureBoot = privilegeSetConfigureComponents;
-const static auto& postSecureBoot = privilegeSetConfigureComponents;
-const static auto& putSecureBoot = privilegeSetConfigureComponents;
-const static auto& deleteSecureBoot = privilegeSetConfigureComponents;
+static constexpr const auto& getSecureBoot = privilegeSetLogin;
+static constexpr const auto& headSecureBoot = privilegeSetLogin;
+static constexpr const auto& patchSecureBoot = privilegeSetConfigureComponents;
+static constexpr const auto& postSecureBoot = privilegeSetConfigureComponents;
+static constexpr const auto& putSecureBoot = privilegeSetConfigureComponents;
+static constexpr const auto& deleteSecureBoot = privilegeSetConfigureComponents;
 
 // SecureBootDatabase
-const static auto& getSecureBootDatabase = privilegeSetLogin;
-const static auto& headSecureBootDatabase = privilegeSetLogin;
-const static auto& patchSecureBootDatabase = privilegeSetConfigureComponents;
-const static auto& postSecureBootDatabase = privilegeSetConfigureComponents;
-const static auto& putSecureBootDatabase = privilegeSetConfigureComponents;
-const static auto& deleteSecureBootDatabase = privilegeSetConfigureComponents;
+static constexpr const auto& getSecureBootDatabase = privilegeSetLogin;
+static constexpr const auto& headSecureBootDatabase = privilegeSetLogin;
+static constexpr const auto& patchSecureBootDatabase = privilegeSetConfigureComponents;
+static constexpr const auto& postSecureBootDatabase = privilegeSetConfigureComponents;
+static constexpr const auto& putSecureBootDatabase = privilegeSetConfigureComponents;
+static constexpr const auto& deleteSecureBootDatabase = privilegeSetConfigureComponents;
 
 // SecureBootDatabaseCollection
-const static auto& getSecureBootDatabaseCollection = privilegeSetLogin;
-const static auto& headSecureBootDatabaseCollection = privilegeSetLogin;
-const static auto& patchSecureBootDatabaseCollection = privilegeSetConfigureComponents;
-const static auto& postSecureBootDatabaseCollection = privilegeSetConfigureComponents;
-const static auto& putSecureBootDatabaseCollection = privilegeSetConfigureComponents;
-const static auto& deleteSecureBootDatabaseCollection = privilegeSetConfigureComponents;
+static constexpr const auto& getSecureBootDatabaseCollection = privilegeSetLogin;
+static constexpr const auto& headSecureBootDatabaseCollection = privilegeSetLogin;
+static constexpr const auto& patchSecureBootDatabaseCollection = privilegeSetConfigureComponents;
+static constexpr const auto& postSecureBootDatabaseCollection = privilegeSetConfigureComponents;
+static constexpr const auto& putSecureBootDatabaseCollection = privilegeSetConfigureComponents;
+static constexpr const auto& deleteSecureBootDatabaseCollection = privilegeSetConfigureComponents;
 
 // SecurityPolicy
-const static auto& getSecurityPolicy = privilegeSetLogin;
-const static auto& headSecurityPolicy = privilegeSetLogin;
-const static auto& patchSecurityPolicy = privilegeSetConfigureManager;
-const static auto& putSecurityPolicy = privilegeSetConfigureManager;
-const static auto& deleteSecurityPolicy = privilegeSetConfigureManager;
-const static auto& postSecurityPolicy = privilegeSetConfigureManager;
+static constexpr const auto& getSecurityPolicy = privilegeSetLogin;
+static constexpr const auto& headSecurityPolicy = privilegeSetLogin;
+static constexpr const auto& patchSecurityPolicy = privilegeSetConfigureManager;
+static constexpr const auto& putSecurityPolicy = privilegeSetConfigureManager;
+static constexpr const auto& deleteSecurityPolicy = privilegeSetConfigureManager;
+static constexpr const auto& postSecurityPolicy = privilegeSetConfigureManager;
 
 // Sensor
-const static auto& getSensor = privilegeSetLogin;
-const static auto& headSensor = privilegeSetLogin;
-const static auto& patchSensor = privilegeSetConfigureComponents;
-const static auto& postSensor = privilegeSetConfigureComponents;
-const static auto& putSensor = privilegeSetConfigureComponents;
-const static auto& deleteSensor = privilegeSetConfigureComponents;
+static constexpr const auto& getSensor = privilegeSetLogin;
+static constexpr const auto& headSensor = privilegeSetLogin;
+static constexpr const auto& patchSensor = privilegeSetConfigureComponents;
+static constexpr const auto& postSensor = privilegeSetConfigureComponents;
+static constexpr const auto& putSensor = privilegeSetConfigureComponents;
+static constexpr const auto& deleteSensor = privilegeSetConfigureComponents;
 
 // SensorCollection
-const static auto& getSensorCollection = privilegeSetLogin;
-const static auto& headSensorCollection = privilegeSetLogin;
-const static auto& patchSensorCollection = privilegeSetConfigureComponents;
-const static auto& postSensorCollection = privilegeSetConfigureComponents;
-const static auto& putSensorCollection = privilegeSetConfigureComponents;
-const static auto& deleteSensorCollection = privilegeSetConfigureComponents;
+static constexpr const auto& getSensorCollection = privilegeSetLogin;
+static constexpr const auto& headSensorCollection = privilegeSetLogin;
+static constexpr const auto& patchSensorCollection = privilegeSetConfigureComponents;
+static constexpr const auto& postSensorCollection = privilegeSetConfigureComponents;
+static constexpr const auto& putSensorCollection = privilegeSetConfigureComponents;
+static constexpr const auto& deleteSensorCollection = privilegeSetConfigureComponents;
 
 // SerialInterface
-const static auto& getSerialInterface = privilegeSetLogin;
-const static auto& headSerialInterface = privilegeSetLogin;
-const static auto& patchSerialInterface = privilegeSetConfigureManager;
-const static auto& putSerialInterface = privilegeSetConfigureManager;
-const static auto& deleteSerialInterface = privilegeSetConfigureManager;
-const static auto& postSerialInterface = privilegeSetConfigureManager;
+static constexpr const auto& getSerialInterface = privilegeSetLogin;
+static constexpr const auto& headSerialInterface = privilegeSetLogin;
+static constexpr const auto& patchSerialInterface = privilegeSetConfigureManager;
+static constexpr const auto& putSerialInterface = privilegeSetConfigureManager;
+static constexpr const auto& deleteSerialInterface = privilegeSetConfigureManager;
+static constexpr const auto& postSerialInterface = privilegeSetConfigureManager;
 
 // SerialInterfaceCollection
-const static auto& getSerialInterfaceCollection = privilegeSetLogin;
-const static auto& headSerialInterfaceCollection = privilegeSetLogin;
-const static auto& patchSerialInterfaceCollection = privilegeSetConfigureManager;
-const static auto& putSerialInterfaceCollection = privilegeSetConfigureManager;
-const static auto& deleteSerialInterfaceCollection = privilegeSetConfigureManager;
-const static auto& postSerialInterfaceCollection = privilegeSetConfigureManager;
+static constexpr const auto& getSerialInterfaceCollection = privilegeSetLogin;
+static constexpr const auto& headSerialInterfaceCollection = privilegeSetLogin;
+static constexpr const auto& patchSerialInterfaceCollection = privilegeSetConfigureManager;
+static constexpr const auto& putSerialInterfaceCollection = privilegeSetConfigureManager;
+static constexpr const auto& deleteSerialInterfaceCollection = privilegeSetConfigureManager;
+static constexpr const auto& postSerialInterfaceCollection = privilegeSetConfigureManager;
 
 // ServiceConditions
-const static auto& getServiceConditions = privilegeSetLogin;
-const static auto& headServiceConditions = privilegeSetLogin;
-const static auto& patchServiceConditions = privilegeSetConfigureManager;
-const static auto& putServiceConditions = privilegeSetConfigureManager;
-const static auto& deleteServiceConditions = privilegeSetConfigureManager;
-const static auto& postServiceConditions = privilegeSetConfigureManager;
+static constexpr const auto& getServiceConditions = privilegeSetLogin;
+static constexpr const auto& headServiceConditions = privilegeSetLogin;
+static constexpr const auto& patchServiceConditions = privilegeSetConfigureManager;
+static constexpr const auto& putServiceConditions = privilegeSetConfigureManager;
+static constexpr const auto& deleteServiceConditions = privilegeSetConfigureManager;
+static constexpr const auto& postServiceConditions = privilegeSetConfigureManager;
 
 // ServiceRoot
-const static auto& getServiceRoot = privilegeSetLoginOrNoAuth;
-const static auto& headServiceRoot = privilegeSetLoginOrNoAuth;
-const static auto& patchServiceRoot = privilegeSetConfigureManager;
-const static auto& putServiceRoot = privilegeSetConfigureManager;
-const static auto& deleteServiceRoot = privilegeSetConfigureManager;
-const static auto& postServiceRoot = privilegeSetConfigureManager;
+static constexpr const auto& getServiceRoot = privilegeSetLoginOrNoAuth;
+static constexpr const auto& headServiceRoot = privilegeSetLoginOrNoAuth;
+static constexpr const auto& patchServiceRoot = privilegeSetConfigureManager;
+static constexpr const auto& putServiceRoot = privilegeSetConfigureManager;
+static constexpr const auto& deleteServiceRoot = privilegeSetConfigureManager;
+static constexpr const auto& postServiceRoot = privilegeSetConfigureManager;
 
 // Session
-const static auto& getSession = privilegeSetConfigureManagerOrConfigureSelf;
-const static auto& headSession = privilegeSetConfigureManagerOrConfigureSelf;
-const static auto& patchSession = privilegeSetConfigureManager;
-const static auto& putSession = privilegeSetConfigureManager;
-const static auto& deleteSession = privilegeSetConfigureManagerOrConfigureSelf;
-const static auto& postSession = privilegeSetConfigureManager;
+static constexpr const auto& getSession = privilegeSetConfigureManagerOrConfigureSelf;
+static constexpr const auto& headSession = privilegeSetConfigureManagerOrConfigureSelf;
+static constexpr const auto& patchSession = privilegeSetConfigureManager;
+static constexpr const auto& putSession = privilegeSetConfigureManager;
+static constexpr const auto& deleteSession = privilegeSetConfigureManagerOrConfigureSelf;
+static constexpr const auto& postSession = privilegeSetConfigureManager;
 
 // SessionCollection
-const static auto& getSessionCollection = privilegeSetLogin;
-const static auto& headSessionCollection = privilegeSetLogin;
-const static auto& patchSessionCollection = privilegeSetConfigureManager;
-const static auto& putSessionCollection = privilegeSetConfigureManager;
-const static auto& deleteSessionCollection = privilegeSetConfigureManager;
-const static auto& postSessionCollection = privilegeSetLogin;
+static constexpr const auto& getSessionCollection = privilegeSetLogin;
+static constexpr const auto& headSessionCollection = privilegeSetLogin;
+static constexpr const auto& patchSessionCollection = privilegeSetConfigureManager;
+static constexpr const auto& putSessionCollection = privilegeSetConfigureManager;
+static constexpr const auto& deleteSessionCollection = privilegeSetConfigureManager;
+static constexpr const auto& postSessionCollection = privilegeSetLogin;
 
 // SessionService
-const static auto& getSessionService = privilegeSetLogin;
-const static auto& headSessionService = privilegeSetLogin;
-const static auto& patchSessionService = privilegeSetConfigureManager;
-const static auto& putSessionService = privilegeSetConfigureManager;
-const static auto& deleteSessionService = privilegeSetConfigureManager;
-const static auto& postSessionService = privilegeSetConfigureManager;
+static constexpr const auto& getSessionService = privilegeSetLogin;
+static constexpr const auto& headSessionService = privilegeSetLogin;
+static constexpr const auto& patchSessionService = privilegeSetConfigureManager;
+static constexpr const auto& putSessionService = privilegeSetConfigureManager;
+static constexpr const auto& deleteSessionService = privilegeSetConfigureManager;
+static constexpr const auto& postSessionService = privilegeSetConfigureManager;
 
 // Signature
-const static auto& getSignature = privilegeSetLogin;
-const static auto& headSignature = privilegeSetLogin;
-const static auto& patchSignature = privilegeSetConfigureComponents;
-const static auto& postSignature = privilegeSetConfigureComponents;
-const static auto& putSignature = privilegeSetConfigureComponents;
-const static auto& deleteSignature = privilegeSetConfigureComponents;
+static constexpr const auto& getSignature = privilegeSetLogin;
+static constexpr const auto& headSignature = privilegeSetLogin;
+static constexpr const auto& patchSignature = privilegeSetConfigureComponents;
+static constexpr const auto& postSignature = privilegeSetConfigureComponents;
+static constexpr const auto& putSignature = privilegeSetConfigureComponents;
+static constexpr const auto& deleteSignature = privilegeSetConfigureComponents;
 
 // SignatureCollection
-const static auto& getSignatureCollection = privilegeSetLogin;
-const static auto& headSignatureCollection = privilegeSetLogin;
-const static auto& patchSignatureCollection = privilegeSetConfigureComponents;
-const static auto& postSignatureCollection = privilegeSetConfigureComponents;
-const static auto& putSignatureCollection = privilegeSetConfigureComponents;
-const static auto& deleteSignatureCollection = privilegeSetConfigureComponents;
+static constexpr const auto& getSignatureCollection = privilegeSetLogin;
+static constexpr const auto& headSignatureCollection = privilegeSetLogin;
+static constexpr const auto& patchSignatureCollection = privilegeSetConfigureComponents;
+static constexpr const auto& postSignatureCollection = privilegeSetConfigureComponents;
+static constexpr const auto& putSignatureCollection = privilegeSetConfigureComponents;
+static constexpr const auto& deleteSignatureCollection = privilegeSetConfigureComponents;
 
 // SimpleStorage
-const static auto& getSimpleStorage = privilegeSetLogin;
-const static auto& headSimpleStorage = privilegeSetLogin;
-const static auto& patchSimpleStorage = privilegeSetConfigureComponents;
-const static auto& postSimpleStorage = privilegeSetConfigureComponents;
-const static auto& putSimpleStorage = privilegeSetConfigureComponents;
-const static auto& deleteSimpleStorage = privilegeSetConfigureComponents;
+static constexpr const auto& getSimpleStorage = privilegeSetLogin;
+static constexpr const auto& headSimpleStorage = privilegeSetLogin;
+static constexpr const auto& patchSimpleStorage = privilegeSetConfigureComponents;
+static constexpr const auto& postSimpleStorage = privilegeSetConfigureComponents;
+static constexpr const auto& putSimpleStorage = privilegeSetConfigureComponents;
+static constexpr const auto& deleteSimpleStorage = privilegeSetConfigureComponents;
 
 // SimpleStorageCollection
-const static auto& getSimpleStorageCollection = privilegeSetLogin;
-const static auto& headSimpleStorageCollection = privilegeSetLogin;
-const static auto& patchSimpleStorageCollection = privilegeSetConfigureComponents;
-const static auto& postSimpleStorageCollection = privilegeSetConfigureComponents;
-const static auto& putSimpleStorageCollection = privilegeSetConfigureComponents;
-const static auto& deleteSimpleStorageCollection = privilegeSetConfigureComponents;
+static constexpr const auto& getSimpleStorageCollection = privilegeSetLogin;
+static constexpr const auto& headSimpleStorageCollection = privilegeSetLogin;
+static constexpr const auto& patchSimpleStorageCollection = privilegeSetConfigureComponents;
+static constexpr const auto& postSimpleStorageCollection = privilegeSetConfigureComponents;
+static constexpr const auto& putSimpleStorageCollection = privilegeSetConfigureComponents;
+static constexpr const auto& deleteSimpleStorageCollection = privilegeSetConfigureComponents;
 
 // SoftwareInventory
-const static auto& getSoftwareInventory = privilegeSetLogin;
-const static auto& headSoftwareInventory = privilegeSetLogin;
-const static auto& patchSoftwareInventory = privilegeSetConfigureComponents;
-const static auto& postSoftwareInventory = privilegeSetConfigureComponents;
-const static auto& putSoftwareInventory = privilegeSetConfigureComponents;
-const static auto& deleteSoftwareInventory = privilegeSetConfigureComponents;
+static constexpr const auto& getSoftwareInventory = privilegeSetLogin;
+static constexpr const auto& headSoftwareInventory = privilegeSetLogin;
+static constexpr const auto& patchSoftwareInventory = privilegeSetConfigureComponents;
+static constexpr const auto& postSoftwareInventory = privilegeSetConfigureComponents;
+static constexpr const auto& putSoftwareInventory = privilegeSetConfigureComponents;
+static constexpr const auto& deleteSoftwareInventory = privilegeSetConfigureComponents;
 
 // SoftwareInventoryCollection
-const static auto& getSoftwareInventoryCollection = privilegeSetLogin;
-const static auto& headSoftwareInventoryCollection = privilegeSetLogin;
-const static auto& patchSoftwareInventoryCollection = privilegeSetConfigureComponents;
-const static auto& postSoftwareInventoryCollection = privilegeSetConfigureComponents;
-const static auto& putSoftwareInventoryCollection = privilegeSetConfigureComponents;
-const static auto& deleteSoftwareInventoryCollection = privilegeSetConfigureComponents;
+static constexpr const auto& getSoftwareInventoryCollection = privilegeSetLogin;
+static constexpr const auto& headSoftwareInventoryCollection = privilegeSetLogin;
+static constexpr const auto& patchSoftwareInventoryCollection = privilegeSetConfigureComponents;
+static constexpr const auto& postSoftwareInventoryCollection = privilegeSetConfigureComponents;
+static constexpr const auto& putSoftwareInventoryCollection = privilegeSetConfigureComponents;
+static constexpr const auto& deleteSoftwareInventoryCollection = privilegeSetConfigureComponents;
 
 // Storage
-const static auto& getStorage = privilegeSetLogin;
-const static auto& headStorage = privilegeSetLogin;
-const static auto& patchStorage = privilegeSetConfigureComponents;
-const static auto& postStorage = privilegeSetConfigureComponents;
-const static auto& putStorage = privilegeSetConfigureComponents;
-const static auto& deleteStorage = privilegeSetConfigureComponents;
+static constexpr const auto& getStorage = privilegeSetLogin;
+static constexpr const auto& headStorage = privilegeSetLogin;
+static constexpr const auto& patchStorage = privilegeSetConfigureComponents;
+static constexpr const auto& postStorage = privilegeSetConfigureComponents;
+static constexpr const auto& putStorage = privilegeSetConfigureComponents;
+static constexpr const auto& deleteStorage = privilegeSetConfigureComponents;
 
 // StorageCollection
-const static auto& getStorageCollection = privilegeSetLogin;
-const static auto& headStorageCollection = privilegeSetLogin;
-const static auto& patchStorageCollection = privilegeSetConfigureComponents;
-const static auto& postStorageCollection = privilegeSetConfigureComponents;
-const static auto& putStorageCollection = privilegeSetConfigureComponents;
-const static auto& deleteStorageCollection = privilegeSetConfigureComponents;
+static constexpr const auto& getStorageCollection = privilegeSetLogin;
+static constexpr const auto& headStorageCollection = privilegeSetLogin;
+static constexpr const auto& patchStorageCollection = privilegeSetConfigureComponents;
+static constexpr const auto& postStorageCollection = privilegeSetConfigureComponents;
+static constexpr const auto& putStorageCollection = privilegeSetConfigureComponents;
+static constexpr const auto& deleteStorageCollection = privilegeSetConfigureComponents;
 
 // StorageController
-const static auto& getStorageController = privilegeSetLogin;
-const static auto& headStorageController = privilegeSetLogin;
-const static auto& patchStorageController = privilegeSetConfigureComponents;
-const static auto& postStorageController = privilegeSetConfigureComponents;
-const static auto& putStorageController = privilegeSetConfigureComponents;
-const static auto& deleteStorageController = privilegeSetConfigureComponents;
+static constexpr const auto& getStorageController = privilegeSetLogin;
+static constexpr const auto& headStorageController = privilegeSetLogin;
+static constexpr const auto& patchStorageController = privilegeSetConfigureComponents;
+static constexpr const auto& postStorageController = privilegeSetConfigureComponents;
+static constexpr const auto& putStorageController = privilegeSetConfigureComponents;
+static constexpr const auto& deleteStorageController = privilegeSetConfigureComponents;
 
 // StorageControllerCollection
-const static auto& getStorageControllerCollection = privilegeSetLogin;
-const static auto& headStorageControllerCollection = privilegeSetLogin;
-const static auto& patchStorageControllerCollection = privilegeSetConfigureComponents;
-const static auto& postStorageControllerCollection = privilegeSetConfigureComponents;
-const static auto& putStorageControllerCollection = privilegeSetConfigureComponents;
-const static auto& deleteStorageControllerCollection = privilegeSetConfigureComponents;
+static constexpr const auto& getStorageControllerCollection = privilegeSetLogin;
+static constexpr const auto& headStorageControllerCollection = privilegeSetLogin;
+static constexpr const auto& patchStorageControllerCollection = privilegeSetConfigureComponents;
+static constexpr const auto& postStorageControllerCollection = privilegeSetConfigureComponents;
+static constexpr const auto& putStorageControllerCollection = privilegeSetConfigureComponents;
+static constexpr const auto& deleteStorageControllerCollection = privilegeSetConfigureComponents;
 
 // StorageControllerMetrics
-const static auto& getStorageControllerMetrics = privilegeSetLogin;
-const static auto& headStorageControllerMetrics = privilegeSetLogin;
-const static auto& patchStorageControllerMetrics = privilegeSetConfigureComponents;
-const static auto& postStorageControllerMetrics = privilegeSetConfigureComponents;
-const static auto& putStorageControllerMetrics = privilegeSetConfigureComponents;
-const static auto& deleteStorageControllerMetrics = privilegeSetConfigureComponents;
+static constexpr const auto& getStorageControllerMetrics = privilegeSetLogin;
+static constexpr const auto& headStorageControllerMetrics = privilegeSetLogin;
+static constexpr const auto& patchStorageControllerMetrics = privilegeSetConfigureComponents;
+static constexpr const auto& postStorageControllerMetrics = privilegeSetConfigureComponents;
+static constexpr const auto& putStorageControllerMetrics = privilegeSetConfigureComponents;
+static constexpr const auto& deleteStorageControllerMetrics = privilegeSetConfigureComponents;
 
 // Switch
-const static auto& getSwitch = privilegeSetLogin;
-const static auto& headSwitch = privilegeSetLogin;
-const static auto& patchSwitch = privilegeSetConfigureComponents;
-const static auto& postSwitch = privilegeSetConfigureComponents;
-const static auto& putSwitch = privilegeSetConfigureComponents;
-const static auto& deleteSwitch = privilegeSetConfigureComponents;
+static constexpr const auto& getSwitch = privilegeSetLogin;
+static constexpr const auto& headSwitch = privilegeSetLogin;
+static constexpr const auto& patchSwitch = privilegeSetConfigureComponents;
+static constexpr const auto& postSwitch = privilegeSetConfigureComponents;
+static constexpr const auto& putSwitch = privilegeSetConfigureComponents;
+static constexpr const auto& deleteSwitch = privilegeSetConfigureComponents;
 
 // SwitchCollection
-const static auto& getSwitchCollection = privilegeSetLogin;
-const static auto& headSwitchCollection = privilegeSetLogin;
-const static auto& patchSwitchCollection = privilegeSetConfigureComponents;
-const static auto& postSwitchCollection = privilegeSetConfigureComponents;
-const static auto& putSwitchCollection = privilegeSetConfigureComponents;
-const static auto& deleteSwitchCollection = privilegeSetConfigureComponents;
+static constexpr const auto& getSwitchCollection = privilegeSetLogin;
+static constexpr const auto& headSwitchCollection = privilegeSetLogin;
+static constexpr const auto& patchSwitchCollection = privilegeSetConfigureComponents;
+static constexpr const auto& postSwitchCollection = privilegeSetConfigureComponents;
+static constexpr const auto& putSwitchCollection = privilegeSetConfigureComponents;
+static constexpr const auto& deleteSwitchCollection = privilegeSetConfigureComponents;
 
 // SwitchMetrics
-const static auto& getSwitchMetrics = privilegeSetLogin;
-const static auto& headSwitchMetrics = privilegeSetLogin;
-const static auto& patchSwitchMetrics = privilegeSetConfigureComponents;
-const static auto& postSwitchMetrics = privilegeSetConfigureComponents;
-const static auto& putSwitchMetrics = privilegeSetConfigureComponents;
-const static auto& deleteSwitchMetrics = privilegeSetConfigureComponents;
+static constexpr const auto& getSwitchMetrics = privilegeSetLogin;
+static constexpr const auto& headSwitchMetrics = privilegeSetLogin;
+static constexpr const auto& patchSwitchMetrics = privilegeSetConfigureComponents;
+static constexpr const auto& postSwitchMetrics = privilegeSetConfigureComponents;
+static constexpr const auto& putSwitchMetrics = privilegeSetConfigureComponents;
+static constexpr const auto& deleteSwitchMetrics = privilegeSetConfigureComponents;
 
 // Task
-const static auto& getTask = privilegeSetLogin;
-const static auto& headTask = privilegeSetLogin;
-const static auto& patchTask = privilegeSetConfigureManager;
-const static auto& putTask = privilegeSetConfigureManager;
-const static auto& deleteTask = privilegeSetConfigureManager;
-const static auto& postTask = privilegeSetConfigureManager;
+static constexpr const auto& getTask = privilegeSetLogin;
+static constexpr const auto& headTask = privilegeSetLogin;
+static constexpr const auto& patchTask = privilegeSetConfigureManager;
+static constexpr const auto& putTask = privilegeSetConfigureManager;
+static constexpr const auto& deleteTask = privilegeSetConfigureManager;
+static constexpr const auto& postTask = privilegeSetConfigureManager;
 
 // TaskCollection
-const static auto& getTaskCollection = privilegeSetLogin;
-const static auto& headTaskCollection = privilegeSetLogin;
-const static auto& patchTaskCollection = privilegeSetConfigureManager;
-const static auto& putTaskCollection = privilegeSetConfigureManager;
-const static auto& deleteTaskCollection = privilegeSetConfigureManager;
-const static auto& postTaskCollection = privilegeSetConfigureManager;
+static constexpr const auto& getTaskCollection = privilegeSetLogin;
+static constexpr const auto& headTaskCollection = privilegeSetLogin;
+static constexpr const auto& patchTaskCollection = privilegeSetConfigureManager;
+static constexpr const auto& putTaskCollection = privilegeSetConfigureManager;
+static constexpr const auto& deleteTaskCollection = privilegeSetConfigureManager;
+static constexpr const auto& postTaskCollection = privilegeSetConfigureManager;
 
 // TaskService
-const static auto& getTaskService = privilegeSetLogin;
-const static auto& headTaskService = privilegeSetLogin;
-const static auto& patchTaskService = privilegeSetConfigureManager;
-const static auto& putTaskService = privilegeSetConfigureManager;
-const static auto& deleteTaskService = privilegeSetConfigureManager;
-const static auto& postTaskService = privilegeSetConfigureManager;
+static constexpr const auto& getTaskService = privilegeSetLogin;
+static constexpr const auto& headTaskService = privilegeSetLogin;
+static constexpr const auto& patchTaskService = privilegeSetConfigureManager;
+static constexpr const auto& putTaskService = privilegeSetConfigureManager;
+static constexpr const auto& deleteTaskService = privilegeSetConfigureManager;
+static constexpr const auto& postTaskService = privilegeSetConfigureManager;
 
 // TelemetryService
-const static auto& getTelemetryService = privilegeSetLogin;
-const static auto& headTelemetryService = privilegeSetLogin;
-const static auto& patchTelemetryService = privilegeSetConfigureManager;
-const static auto& putTelemetryService = privilegeSetConfigureManager;
-const static auto& deleteTelemetryService = privilegeSetConfigureManager;
-const static auto& postTelemetryService = privilegeSetConfigureManager;
+static constexpr const auto& getTelemetryService = privilegeSetLogin;
+static constexpr const auto& headTelemetryService = privilegeSetLogin;
+static constexpr const auto& patchTelemetryService = privilegeSetConfigureManager;
+static constexpr const auto& putTelemetryService = privilegeSetConfigureManager;
+static constexpr const auto& deleteTelemetryService = privilegeSetConfigureManager;
+static constexpr const auto& postTelemetryService = privilegeSetConfigureManager;
 
 // Thermal
-const static auto& getThermal = privilegeSetLogin;
-const static auto& headThermal = privilegeSetLogin;
-const static auto& patchThermal = privilegeSetConfigureManager;
-const static auto& putThermal = privilegeSetConfigureManager;
-const static auto& deleteThermal = privilegeSetConfigureManager;
-const static auto& postThermal = privilegeSetConfigureManager;
+static constexpr const auto& getThermal = privilegeSetLogin;
+static constexpr const auto& headThermal = privilegeSetLogin;
+static constexpr const auto& patchThermal = privilegeSetConfigureManager;
+static constexpr const auto& putThermal = privilegeSetConfigureManager;
+static constexpr const auto& deleteThermal = privilegeSetConfigureManager;
+static constexpr const auto& postThermal = privilegeSetConfigureManager;
 
 // ThermalEquipment
-const static auto& getThermalEquipment = privilegeSetLogin;
-const static auto& headThermalEquipment = privilegeSetLogin;
-const static auto& patchThermalEquipment = privilegeSetConfigureManager;
-const static auto& putThermalEquipment = privilegeSetConfigureManager;
-const static auto& deleteThermalEquipment = privilegeSetConfigureManager;
-const static auto& postThermalEquipment = privilegeSetConfigureManager;
+static constexpr const auto& getThermalEquipment = privilegeSetLogin;
+static constexpr const auto& headThermalEquipment = privilegeSetLogin;
+static constexpr const auto& patchThermalEquipment = privilegeSetConfigureManager;
+static constexpr const auto& putThermalEquipment = privilegeSetConfigureManager;
+static constexpr const auto& deleteThermalEquipment = privilegeSetConfigureManager;
+static constexpr const auto& postThermalEquipment = privilegeSetConfigureManager;
 
 // ThermalMetrics
-const static auto& getThermalMetrics = privilegeSetLogin;
-const static auto& headThermalMetrics = privilegeSetLogin;
-const static auto& patchThermalMetrics = privilegeSetConfigureManager;
-const static auto& putThermalMetrics = privilegeSetConfigureManager;
-const static auto& deleteThermalMetrics = privilegeSetConfigureManager;
-const static auto& postThermalMetrics = privilegeSetConfigureManager;
+static constexpr const auto& getThermalMetrics = privilegeSetLogin;
+static constexpr const auto& headThermalMetrics = privilegeSetLogin;
+static constexpr const auto& patchThermalMetrics = privilegeSetConfigureManager;
+static constexpr const auto& putThermalMetrics = privilegeSetConfigureManager;
+static constexpr const auto& deleteThermalMetrics = privilegeSetConfigureManager;
+static constexpr const auto& postThermalMetrics = privilegeSetConfigureManager;
 
 // ThermalSubsystem
-const static auto& getThermalSubsystem = privilegeSetLogin;
-const static auto& headThermalSubsystem = privilegeSetLogin;
-const static auto& patchThermalSubsystem = privilegeSetConfigureManager;
-const static auto& putThermalSubsystem = privilegeSetConfigureManager;
-const static auto& deleteThermalSubsystem = privilegeSetConfigureManager;
-const static auto& postThermalSubsystem = privilegeSetConfigureManager;
+static constexpr const auto& getThermalSubsystem = privilegeSetLogin;
+static constexpr const auto& headThermalSubsystem = privilegeSetLogin;
+static constexpr const auto& patchThermalSubsystem = privilegeSetConfigureManager;
+static constexpr const auto& putThermalSubsystem = privilegeSetConfigureManager;
+static constexpr const auto& deleteThermalSubsystem = privilegeSetConfigureManager;
+static constexpr const auto& postThermalSubsystem = privilegeSetConfigureManager;
 
 // Triggers
-const static auto& getTriggers = privilegeSetLogin;
-const static auto& headTriggers = privilegeSetLogin;
-const static auto& patchTriggers = privilegeSetConfigureManager;
-const static auto& putTriggers = privilegeSetConfigureManager;
-const static auto& deleteTriggers = privilegeSetConfigureManager;
-const static auto& postTriggers = privilegeSetConfigureManager;
+static constexpr const auto& getTriggers = privilegeSetLogin;
+static constexpr const auto& headTriggers = privilegeSetLogin;
+static constexpr const auto& patchTriggers = privilegeSetConfigureManager;
+static constexpr const auto& putTriggers = privilegeSetConfigureManager;
+static constexpr const auto& deleteTriggers = privilegeSetConfigureManager;
+static constexpr const auto& postTriggers = privilegeSetConfigureManager;
 
 // TriggersCollection
-const static auto& getTriggersCollection = privilegeSetLogin;
-const static auto& headTriggersCollection = privilegeSetLogin;
-const static auto& patchTriggersCollection = privilegeSetConfigureManager;
-const static auto& putTriggersCollection = privilegeSetConfigureManager;
-const static auto& deleteTriggersCollection = privilegeSetConfigureManager;
-const static auto& postTriggersCollection = privilegeSetConfigureManager;
+static constexpr const auto& getTriggersCollection = privilegeSetLogin;
+static constexpr const auto& headTriggersCollection = privilegeSetLogin;
+static constexpr const auto& patchTriggersCollection = privilegeSetConfigureManager;
+static constexpr const auto& putTriggersCollection = privilegeSetConfigureManager;
+static constexpr const auto& deleteTriggersCollection = privilegeSetConfigureManager;
+static constexpr const auto& postTriggersCollection = privilegeSetConfigureManager;
 
 // TrustedComponent
-const static auto& getTrustedComponent = privilegeSetLogin;
-const static auto& headTrustedComponent = privilegeSetLogin;
-const static auto& patchTrustedComponent = privilegeSetConfigureManager;
-const static auto& putTrustedComponent = privilegeSetConfigureManager;
-const static auto& deleteTrustedComponent = privilegeSetConfigureManager;
-const static auto& postTrustedComponent = privilegeSetConfigureManager;
+static constexpr const auto& getTrustedComponent = privilegeSetLogin;
+static constexpr const auto& headTrustedComponent = privilegeSetLogin;
+static constexpr const auto& patchTrustedComponent = privilegeSetConfigureManager;
+static constexpr const auto& putTrustedComponent = privilegeSetConfigureManager;
+static constexpr const auto& deleteTrustedComponent = privilegeSetConfigureManager;
+static constexpr const auto& postTrustedComponent = privilegeSetConfigureManager;
 
 // TrustedComponentCollection
-const static auto& getTrustedComponentCollection = privilegeSetLogin;
-const static auto& headTrustedComponentCollection = privilegeSetLogin;
-const static auto& patchTrustedComponentCollection = privilegeSetConfigureManager;
-const static auto& putTrustedComponentCollection = privilegeSetConfigureManager;
-const static auto& deleteTrustedComponentCollection = privilegeSetConfigureManager;
-const static auto& postTrustedComponentCollection = privilegeSetConfigureManager;
+static constexpr const auto& getTrustedComponentCollection = privilegeSetLogin;
+static constexpr const auto& headTrustedComponentCollection = privilegeSetLogin;
+static constexpr const auto& patchTrustedComponentCollection = privilegeSetConfigureManager;
+static constexpr const auto& putTrustedComponentCollection = privilegeSetConfigureManager;
+static constexpr const auto& deleteTrustedComponentCollection = privilegeSetConfigureManager;
+static constexpr const auto& postTrustedComponentCollection = privilegeSetConfigureManager;
 
 // UpdateService
-const static auto& getUpdateService = privilegeSetLogin;
-const static auto& headUpdateService = privilegeSetLogin;
-const static auto& patchUpdateService = privilegeSetConfigureComponents;
-const static auto& postUpdateService = privilegeSetConfigureComponents;
-const static auto& putUpdateService = privilegeSetConfigureComponents;
-const static auto& deleteUpdateService = privilegeSetConfigureComponents;
+static constexpr const auto& getUpdateService = privilegeSetLogin;
+static constexpr const auto& headUpdateService = privilegeSetLogin;
+static constexpr const auto& patchUpdateService = privilegeSetConfigureComponents;
+static constexpr const auto& postUpdateService = privilegeSetConfigureComponents;
+static constexpr const auto& putUpdateService = privilegeSetConfigureComponents;
+static constexpr const auto& deleteUpdateService = privilegeSetConfigureComponents;
 
 // USBController
-const static auto& getUSBController = privilegeSetLogin;
-const static auto& headUSBController = privilegeSetLogin;
-const static auto& patchUSBController = privilegeSetConfigureComponents;
-const static auto& putUSBController = privilegeSetConfigureComponents;
-const static auto& deleteUSBController = privilegeSetConfigureComponents;
-const static auto& postUSBController = privilegeSetConfigureComponents;
+static constexpr const auto& getUSBController = privilegeSetLogin;
+static constexpr const auto& headUSBController = privilegeSetLogin;
+static constexpr const auto& patchUSBController = privilegeSetConfigureComponents;
+static constexpr const auto& putUSBController = privilegeSetConfigureComponents;
+static constexpr const auto& deleteUSBController = privilegeSetConfigureComponents;
+static constexpr const auto& postUSBController = privilegeSetConfigureComponents;
 
 // USBControllerCollection
-const static auto& getUSBControllerCollection = privilegeSetLogin;
-const static auto& headUSBControllerCollection = privilegeSetLogin;
-const static auto& patchUSBControllerCollection = privilegeSetConfigureComponents;
-const static auto& putUSBControllerCollection = privilegeSetConfigureComponents;
-const static auto& deleteUSBControllerCollection = privilegeSetConfigureComponents;
-const static auto& postUSBControllerCollection = privilegeSetConfigureComponents;
+static constexpr const auto& getUSBControllerCollection = privilegeSetLogin;
+static constexpr const auto& headUSBControllerCollection = privilegeSetLogin;
+static constexpr const auto& patchUSBControllerCollection = privilegeSetConfigureComponents;
+static constexpr const auto& putUSBControllerCollection = privilegeSetConfigureComponents;
+static constexpr const auto& deleteUSBControllerCollection = privilegeSetConfigureComponents;
+static constexpr const auto& postUSBControllerCollection = privilegeSetConfigureComponents;
 
 // VCATEntry
-const static auto& getVCATEntry = privilegeSetLogin;
-const static auto& headVCATEntry = privilegeSetLogin;
-const static auto& patchVCATEntry = privilegeSetConfigureComponents;
-const static auto& putVCATEntry = privilegeSetConfigureComponents;
-const static auto& deleteVCATEntry = privilegeSetConfigureComponents;
-const static auto& postVCATEntry = privilegeSetConfigureComponents;
+static constexpr const auto& getVCATEntry = privilegeSetLogin;
+static constexpr const auto& headVCATEntry = privilegeSetLogin;
+static constexpr const auto& patchVCATEntry = privilegeSetConfigureComponents;
+static constexpr const auto& putVCATEntry = privilegeSetConfigureComponents;
+static constexpr const auto& deleteVCATEntry = privilegeSetConfigureComponents;
+static constexpr const auto& postVCATEntry = privilegeSetConfigureComponents;
 
 // VCATEntryCollection
-const static auto& getVCATEntryCollection = privilegeSetLogin;
-const static auto& headVCATEntryCollection = privilegeSetLogin;
-const static auto& patchVCATEntryCollection = privilegeSetConfigureComponents;
-const static auto& putVCATEntryCollection = privilegeSetConfigureComponents;
-const static auto& deleteVCATEntryCollection = privilegeSetConfigureComponents;
-const static auto& postVCATEntryCollection = privilegeSetConfigureComponents;
+static constexpr const auto& getVCATEntryCollection = privilegeSetLogin;
+static constexpr const auto& headVCATEntryCollection = privilegeSetLogin;
+static constexpr const auto& patchVCATEntryCollection = privilegeSetConfigureComponents;
+static constexpr const auto& putVCATEntryCollection = privilegeSetConfigureComponents;
+static constexpr const auto& deleteVCATEntryCollection = privilegeSetConfigureComponents;
+static constexpr const auto& postVCATEntryCollection = privilegeSetConfigureComponents;
 
 // VLanNetworkInterface
-const static auto& getVLanNetworkInterface = privilegeSetLogin;
-const static auto& headVLanNetworkInterface = privilegeSetLogin;
-const static auto& patchVLanNetworkInterface = privilegeSetConfigureManager;
-const static auto& putVLanNetworkInterface = privilegeSetConfigureManager;
-const static auto& deleteVLanNetworkInterface = privilegeSetConfigureManager;
-const static auto& postVLanNetworkInterface = privilegeSetConfigureManager;
+static constexpr const auto& getVLanNetworkInterface = privilegeSetLogin;
+static constexpr const auto& headVLanNetworkInterface = privilegeSetLogin;
+static constexpr const auto& patchVLanNetworkInterface = privilegeSetConfigureManager;
+static constexpr const auto& putVLanNetworkInterface = privilegeSetConfigureManager;
+static constexpr const auto& deleteVLanNetworkInterface = privilegeSetConfigureManager;
+static constexpr const auto& postVLanNetworkInterface = privilegeSetConfigureManager;
 
 // VLanNetworkInterfaceCollection
-const static auto& getVLanNetworkInterfaceCollection = privilegeSetLogin;
-const static auto& headVLanNetworkInterfaceCollection = privilegeSetLogin;
-const static auto& patchVLanNetworkInterfaceCollection = privilegeSetConfigureManager;
-const static auto& putVLanNetworkInterfaceCollection = privilegeSetConfigureManager;
-const static auto& deleteVLanNetworkInterfaceCollection = privilegeSetConfigureManager;
-const static auto& postVLanNetworkInterfaceCollection = privilegeSetConfigureManager;
+static constexpr const auto& getVLanNetworkInterfaceCollection = privilegeSetLogin;
+static constexpr const auto& headVLanNetworkInterfaceCollection = privilegeSetLogin;
+static constexpr const auto& patchVLanNetworkInterfaceCollection = privilegeSetConfigureManager;
+static constexpr const auto& putVLanNetworkInterfaceCollection = privilegeSetConfigureManager;
+static constexpr const auto& deleteVLanNetworkInterfaceCollection = privilegeSetConfigureManager;
+static constexpr const auto& postVLanNetworkInterfaceCollection = privilegeSetConfigureManager;
 
 // VirtualMedia
-const static auto& getVirtualMedia = privilegeSetLogin;
-const static auto& headVirtualMedia = privilegeSetLogin;
-const static auto& patchVirtualMedia = privilegeSetConfigureManager;
-const static auto& putVirtualMedia = privilegeSetConfigureManager;
-const static auto& deleteVirtualMedia = privilegeSetConfigureManager;
-const static auto& postVirtualMedia = privilegeSetConfigureManager;
+static constexpr const auto& getVirtualMedia = privilegeSetLogin;
+static constexpr const auto& headVirtualMedia = privilegeSetLogin;
+static constexpr const auto& patchVirtualMedia = privilegeSetConfigureManager;
+static constexpr const auto& putVirtualMedia = privilegeSetConfigureManager;
+static constexpr const auto& deleteVirtualMedia = privilegeSetConfigureManager;
+static constexpr const auto& postVirtualMedia = privilegeSetConfigureManager;
 
 // VirtualMediaCollection
-const static auto& getVirtualMediaCollection = privilegeSetLogin;
-const static auto& headVirtualMediaCollection = privilegeSetLogin;
-const static auto& patchVirtualMediaCollection = privilegeSetConfigureManager;
-const static auto& putVirtualMediaCollection = privilegeSetConfigureManager;
-const static auto& deleteVirtualMediaCollection = privilegeSetConfigureManager;
-const static auto& postVirtualMediaCollection = privilegeSetConfigureManager;
+static constexpr const auto& getVirtualMediaCollection = privilegeSetLogin;
+static constexpr const auto& headVirtualMediaCollection = privilegeSetLogin;
+static constexpr const auto& patchVirtualMediaCollection = privilegeSetConfigureManager;
+static constexpr const auto& putVirtualMediaCollection = privilegeSetConfigureManager;
+static constexpr const auto& deleteVirtualMediaCollection = privilegeSetConfigureManager;
+static constexpr const auto& postVirtualMediaCollection = privilegeSetConfigureManager;
 
 // Volume
-const static auto& getVolume = privilegeSetLogin;
-const static auto& headVolume = privilegeSetLogin;
-const static auto& patchVolume = privilegeSetConfigureComponents;
-const static auto& postVolume = privilegeSetConfigureComponents;
-const static auto& putVolume = privilegeSetConfigureComponents;
-const static auto& deleteVolume = privilegeSetConfigureComponents;
+static constexpr const auto& getVolume = privilegeSetLogin;
+static constexpr const auto& headVolume = privilegeSetLogin;
+static constexpr const auto& patchVolume = privilegeSetConfigureComponents;
+static constexpr const auto& postVolume = privilegeSetConfigureComponents;
+static constexpr const auto& putVolume = privilegeSetConfigureComponents;
+static constexpr const auto& deleteVolume = privilegeSetConfigureComponents;
 
 // VolumeCollection
-const static auto& getVolumeCollection = privilegeSetLogin;
-const static auto& headVolumeCollection = privilegeSetLogin;
-const static auto& patchVolumeCollection = privilegeSetConfigureComponents;
-const static auto& postVolumeCollection = privilegeSetConfigureComponents;
-const static auto& putVolumeCollection = privilegeSetConfigureComponents;
-const static auto& deleteVolumeCollection = privilegeSetConfigureComponents;
+static constexpr const auto& getVolumeCollection = privilegeSetLogin;
+static constexpr const auto& headVolumeCollection = privilegeSetLogin;
+static constexpr const auto& patchVolumeCollection = privilegeSetConfigureComponents;
+static constexpr const auto& postVolumeCollection = privilegeSetConfigureComponents;
+static constexpr const auto& putVolumeCollection = privilegeSetConfigureComponents;
+static constexpr const auto& deleteVolumeCollection = privilegeSetConfigureComponents;
 
 // Zone
-const static auto& getZone = privilegeSetLogin;
-const static auto& headZone = privilegeSetLogin;
-const static auto& patchZone = privilegeSetConfigureComponents;
-const static auto& postZone = privilegeSetConfigureComponents;
-const static auto& putZone = privilegeSetConfigureComponents;
-const static auto& deleteZone = privilegeSetConfigureComponents;
+static constexpr const auto& getZone = privilegeSetLogin;
+static constexpr const auto& headZone = privilegeSetLogin;
+static constexpr const auto& patchZone = privilegeSetConfigureComponents;
+static constexpr const auto& postZone = privilegeSetConfigureComponents;
+static constexpr const auto& putZone = privilegeSetConfigureComponents;
+static constexpr const auto& deleteZone = privilegeSetConfigureComponents;
 
 // ZoneCollection
-const static auto& getZoneCollection = privilegeSetLogin;
-const static auto& headZoneCollection = privilegeSetLogin;
-const static auto& patchZoneCollection = privilegeSetConfigureComponents;
-const static auto& postZoneCollection = privilegeSetConfigureComponents;
-const static auto& putZoneCollection = privilegeSetConfigureComponents;
-const static auto& deleteZoneCollection = privilegeSetConfigureComponents;
+static constexpr const auto& getZoneCollection = privilegeSetLogin;
+static constexpr const auto& headZoneCollection = privilegeSetLogin;
+static constexpr const auto& patchZoneCollection = privilegeSetConfigureComponents;
+static constexpr const auto& postZoneCollection = privilegeSetConfigureComponents;
+static constexpr const auto& putZoneCollection = privilegeSetConfigureComponents;
+static constexpr const auto& deleteZoneCollection = privilegeSetConfigureComponents;
 
 } // namespace redfish::privileges
 // clang-format on
@@ -14,9 +14,11 @@
 #include <boost/asio/io_context.hpp>
 #include <boost/asio/steady_timer.hpp>
 #include <boost/url/url_view_base.hpp>
+#include <nlohmann/json.hpp>
 
 #include <cstdint>
 #include <functional>
+#include <map>
 #include <memory>
 #include <optional>
 #include <string>
@@ -41,6 +43,49 @@ struct TestEvent
     std::optional<std::string> severity;
 };
 
+// A MetricReport that is built and serialized once per report update and
+// then shared by every subscriber.  Context is the only per subscriber field,
+// so one payload is kept for each distinct Context value.  The report is only
+// built once a subscriber's filter matches it.  The readings are not kept;
+// they belong to the signal being handled.
+class SharedMetricReport
+{
+  public:
+    explicit SharedMetricReport(const std::string& reportIdIn);
+
+    struct Payload
+    {
+        std::string msg;
+        crow::sse_socket::SseEvent sseFrame;
+    };
+
+    // Builds the report from the readings on first use
+    bool valid(const telemetry::TimestampReadings& readings)
+    {
+        build(readings);
+        return filled;
+    }
+
+    const std::string& definitionUri() const
+    {
+        return mrdUri;
+    }
+
+    // Only valid once valid() has returned true
+    Payload& payloadFor(const std::string& context);
+
+  private:
+    void build(const telemetry::TimestampReadings& readings);
+
+    std::string reportId;
+    std::string mrdUri;
+    nlohmann::json report;
+    bool built = false;
+    bool filled = false;
+    // std::map so that payload references stay valid as contexts are added
+    std::map<std::string, Payload> payloads;
+};
+
 class Subscription : public std::enable_shared_from_this<Subscription>
 {
   public:
@@ -69,11 +114,17 @@ class Subscription : public std::enable_shared_from_this<Subscription>
 
     bool sendEventToSubscriber(uint64_t eventId, std::string&& msg);
 
+    // Sends an event whose payload is identical for several subscribers.  The
+    // SSE frame is formatted by the first SSE subscriber and shared by
+    // reference with the rest.
+    bool sendSharedEventToSubscriber(uint64_t eventId, const std::string& msg,
+                                     crow::sse_socket::SseEvent& sseFrame);
+
     void filterAndSendEventLogs(
         uint64_t eventId, const std::vector<EventLogObjectsType>& eventRecords);
 
-    void filterAndSendReports(uint64_t eventId, const std::string& reportId,
-                              const telemetry::TimestampReadings& var);
+    void filterAndSendReports(uint64_t eventId, SharedMetricReport& report,
+                              const telemetry::TimestampReadings& readings);
 
     void updateRetryConfig(uint32_t retryAttempts,
                            uint32_t retryTimeoutInterval);
@@ -0,0 +1,201 @@
+// SPDX-License-Identifier: Apache-2.0
+// SPDX-FileCopyrightText: Copyright OpenBMC Authors
+#pragma once
+
+#include "logging.hpp"
+
+#include <chrono>
+#include <cstddef>
+#include <format>
+#include <functional>
+#include <initializer_list>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace redfish
+{
+
+// Runs asynchronous stages as a dependency graph.  Each stage starts as soon
+// as every stage it depends on has finished, so stages that don't depend on
+// each other run concurrently.  A stage is handed a callback to call when it
+// finishes; a stage that fails reports its own error and never calls it, in
+// which case the rest of the graph is dropped along with the last reference.
+class StageGraph : public std::enable_shared_from_this<StageGraph>
+{
+  public:
+    using Clock = std::chrono::steady_clock;
+    using Done = std::function<void()>;
+    using Stage = std::function<void(Done&&)>;
+
+    struct Timing
+    {
+        std::string_view name;
+        // Offset from the start of the graph
+        Clock::duration started{};
+        Clock::duration elapsed{};
+    };
+
+    // Adds a stage and returns its id.  Stages may only depend on stages
+    // added before them, so the graph can't contain a cycle.
+    size_t add(std::string_view name, std::initializer_list<size_t> dependsOn,
+               Stage&& run)
+    {
+        size_t id = nodes.size();
+        Node& node = nodes.emplace_back();
+        node.name = name;
+        node.run = std::move(run);
+        for (size_t dependency : dependsOn)
+        {
+            if (dependency >= id)
+            {
+                BMCWEB_LOG_CRITICAL("Stage {} depends on a later stage", name);
+                continue;
+            }
+            nodes[dependency].dependents.push_back(id);
+            node.waitingFor++;
+        }
+        return id;
+    }
+
+    // Starts every stage without dependencies.  onComplete is called once all
+    // stages have finished.
+    void run(std::function<void(const StageGraph&)>&& onCompleteIn)
+    {
+        onComplete = std::move(onCompleteIn);
+        startTime = Clock::now();
+        if (nodes.empty())
+        {
+            complete();
+            return;
+        }
+        for (size_t id = 0; id < nodes.size(); id++)
+        {
+            // Earlier stages may already have started it if they finished
+            // synchronously
+            if (nodes[id].waitingFor == 0 && !nodes[id].running)
+            {
+                start(id);
+            }
+        }
+    }
+
+    std::vector<Timing> timings() const
+    {
+        std::vector<Timing> result;
+        result.reserve(nodes.size());
+        for (const Node& node : nodes)
+        {
+            result.emplace_back(
+                Timing{node.name, node.started - startTime,
+                       node.finished ? node.finishTime - node.started
+                                     : Clock::duration{}});
+        }
+        return result;
+    }
+
+    // Time from run() until the last stage finished
+    Clock::duration elapsed() const
+    {
+        return endTime - startTime;
+    }
+
+    // Per stage latency, for logging, e.g. "chassis=1.2ms@0.0ms ..."
+    std::string formatTimings() const
+    {
+        std::string out;
+        for (const Timing& timing : timings())
+        {
+            using Ms = std::chrono::duration<double, std::milli>;
+            out += std::format("{}={:.1f}ms@{:.1f}ms ", timing.name,
+                               Ms(timing.elapsed).count(),
+                               Ms(timing.started).count());
+        }
+        out += std::format(
+            "total={:.1f}ms",
+            std::chrono::duration<double, std::milli>(elapsed()).count());
+        return out;
+    }
+
+  private:
+    struct Node
+    {
+        std::string_view name;
+        Stage run;
+        std::vector<size_t> dependents;
+        size_t waitingFor = 0;
+        bool running = false;
+        bool finished = false;
+        Clock::time_point started;
+        Clock::time_point finishTime;
+    };
+
+    void start(size_t id)
+    {
+        Node& node = nodes[id];
+        node.running = true;
+        node.started = Clock::now();
+        // The stage may finish before it returns, so it is moved out of the
+        // node rather than run in place
+        Stage run = std::move(node.run);
+        run([self(shared_from_this()), id]() { self->finish(id); });
+    }
+
+    void finish(size_t id)
+    {
+        Node& node = nodes[id];
+        if (node.finished)
+        {
+            BMCWEB_LOG_CRITICAL("Stage {} finished twice", node.name);
+            return;
+        }
+        node.finished = true;
+        node.finishTime = Clock::now();
+        finishedCount++;
+        std::vector<size_t> ready;
+        for (size_t dependent : node.dependents)
+        {
+            if (--nodes[dependent].waitingFor == 0)
+            {
+                ready.push_back(dependent);
+            }
+        }
+        for (size_t dependent : ready)
+        {
+            start(dependent);
+        }
+        if (finishedCount == nodes.size())
+        {
+            complete();
+        }
+    }
+
+    void complete()
+    {
+        // A stage finishing synchronously inside another may already have
+        // completed the graph
+        if (completed)
+        {
+            return;
+        }
+        completed = true;
+        endTime = Clock::now();
+        if (onComplete)
+        {
+            std::function<void(const StageGraph&)> callback =
+                std::move(onComplete);
+            callback(*this);
+        }
+    }
+
+    std::vector<Node> nodes;
+    size_t finishedCount = 0;
+    bool completed = false;
+    Clock::time_point startTime;
+    Clock::time_point endTime;
+    std::function<void(const StageGraph&)> onComplete;
+};
+
+} // namespace redfish
@@ -7,6 +7,7 @@
 
 #include "app.hpp"
 #include "async_resp.hpp"
+#include "basic_auth_cache.hpp"
 #include "boost_formatters.hpp"
 #include "certificate_service.hpp"
 #include "dbus_utility.hpp"
@@ -1152,6 +1153,9 @@ inline void afterVerifyUserExists(
         {
             // Remove existing sessions of the user when password
             // changed
+            bmcweb::BasicAuthCache::getInstance().invalidate(params.username);
+            persistent_data::SessionStore::getInstance().invalidateUserInfo(
+                params.username);
             persistent_data::SessionStore::getInstance()
                 .removeSessionsByUsernameExceptSession(params.username,
                                                        params.session);
@@ -1517,9 +1521,11 @@ inline void handleCertificateMappingAttributePatch(
         return;
     }
 
-    persistent_data::AuthConfigMethods& authMethodsConfig =
+    persistent_data::AuthConfigMethods authMethodsConfig =
         persistent_data::SessionStore::getInstance().getAuthMethodsConfig();
     authMethodsConfig.mTLSCommonNameParsingMode = parseMode;
+    persistent_data::SessionStore::getInstance().updateAuthMethodsConfig(
+        authMethodsConfig);
 }
 
 inline void handleRespondToUnauthenticatedClientsPatch(
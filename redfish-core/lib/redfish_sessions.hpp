@@ -11,7 +11,7 @@
 #include "error_messages.hpp"
 #include "http_request.hpp"
 #include "http_response.hpp"
-#include "pam_authenticate.hpp"
+#include "pam_worker_pool.hpp"
 #include "privileges.hpp"
 #include "query.hpp"
 #include "registries/privilege_registry.hpp"
@@ -24,6 +24,7 @@
 #include <boost/beast/http/status.hpp>
 #include <boost/beast/http/verb.hpp>
 #include <boost/url/format.hpp>
+#include <boost/url/url.hpp>
 
 #include <chrono>
 #include <cstdint>
@@ -31,6 +32,7 @@
 #include <memory>
 #include <optional>
 #include <string>
+#include <string_view>
 #include <utility>
 #include <vector>
 
@@ -207,13 +209,13 @@ inline void handleSessionCollectionMembersGet(
 
 inline void processAfterSessionCreation(
     const std::shared_ptr<bmcweb::AsyncResp>& asyncResp,
-    const crow::Request& req, const std::string& username,
+    std::string_view requestedWith, const std::string& username,
     std::shared_ptr<persistent_data::UserSession>& session)
 {
     // When session is created by webui-vue give it session cookies as a
     // non-standard Redfish extension. This is needed for authentication for
     // WebSockets-based functionality.
-    if (!req.getHeaderValue("X-Requested-With").empty())
+    if (!requestedWith.empty())
     {
         bmcweb::setSessionCookies(asyncResp->res, *session);
     }
@@ -276,26 +278,34 @@ inline void handleSessionCollectionPost(
         return;
     }
 
-    int pamrc = pamAuthenticateUser(username, password, token);
-    bool isConfigureSelfOnly = pamrc == PAM_NEW_AUTHTOK_REQD;
-    if ((pamrc != PAM_SUCCESS) && !isConfigureSelfOnly)
-    {
-        messages::resourceAtUriUnauthorized(asyncResp->res, req.url(),
-                                            "Invalid username or password");
-        return;
-    }
-
-    // User is authenticated - create session
-    std::shared_ptr<persistent_data::UserSession> session =
-        persistent_data::SessionStore::getInstance().generateUserSession(
-            username, req.ipAddress, clientId,
-            persistent_data::SessionType::Session, isConfigureSelfOnly);
-    if (session == nullptr)
-    {
-        messages::internalError(asyncResp->res);
-        return;
-    }
-    processAfterSessionCreation(asyncResp, req, username, session);
+    bmcweb::pamAuthenticateUserAsync(
+        username, password, std::move(token),
+        [asyncResp, username, clientId, ipAddress = req.ipAddress,
+         url = boost::urls::url(req.url()),
+         requestedWith = std::string(req.getHeaderValue("X-Requested-With"))](
+            int pamrc) {
+            bool isConfigureSelfOnly = pamrc == PAM_NEW_AUTHTOK_REQD;
+            if ((pamrc != PAM_SUCCESS) && !isConfigureSelfOnly)
+            {
+                messages::resourceAtUriUnauthorized(
+                    asyncResp->res, url, "Invalid username or password");
+                return;
+            }
+
+            // User is authenticated - create session
+            std::shared_ptr<persistent_data::UserSession> session =
+                persistent_data::SessionStore::getInstance()
+                    .generateUserSession(username, ipAddress, clientId,
+                                         persistent_data::SessionType::Session,
+                                         isConfigureSelfOnly);
+            if (session == nullptr)
+            {
+                messages::internalError(asyncResp->res);
+                return;
+            }
+            processAfterSessionCreation(asyncResp, requestedWith, username,
+                                        session);
+        });
 }
 
 inline void handleSessionServiceHead(
@@ -6,6 +6,7 @@
 #include "bmcweb_config.h"
 
 #include "app.hpp"
+#include "association_graph.hpp"
 #include "async_resp.hpp"
 #include "dbus_singleton.hpp"
 #include "dbus_utility.hpp"
@@ -22,6 +23,7 @@
 #include "utils/json_utils.hpp"
 #include "utils/query_param.hpp"
 #include "utils/sensor_utils.hpp"
+#include "utils/stage_graph.hpp"
 
 #include <asm-generic/errno.h>
 
@@ -49,6 +51,7 @@
 #include <span>
 #include <string>
 #include <string_view>
+#include <type_traits>
 #include <unordered_map>
 #include <utility>
 #include <variant>
@@ -1187,13 +1190,12 @@ void getInventoryItemAssociations(
 {
     BMCWEB_LOG_DEBUG("getInventoryItemAssociations enter");
 
-    // Call GetManagedObjects on the ObjectMapper to get all associations
-    sdbusplus::message::object_path path("/");
-    dbus::utility::getManagedObjects(
-        "xyz.openbmc_project.ObjectMapper", path,
+    // Associations are held in memory and kept current from mapper signals,
+    // so only the sensors requested are looked at
+    MapperAssociations::getInstance().getGraph(
         [callback = std::forward<Callback>(callback), sensorsAsyncResp,
          sensorNames](const boost::system::error_code& ec,
-                      const dbus::utility::ManagedObjectType& resp) mutable {
+                      const AssociationGraph& graph) mutable {
             BMCWEB_LOG_DEBUG("getInventoryItemAssociations respHandler enter");
             if (ec)
             {
@@ -1208,100 +1210,37 @@ void getInventoryItemAssociations(
             std::shared_ptr<std::vector<InventoryItem>> inventoryItems =
                 std::make_shared<std::vector<InventoryItem>>();
 
-            // Loop through returned object paths
+            // Find the inventory association for each of the sensors
             std::string sensorAssocPath;
             sensorAssocPath.reserve(128); // avoid memory allocations
-            for (const auto& objDictEntry : resp)
+            for (const std::string& sensorName : *sensorNames)
             {
-                const std::string& objPath =
-                    static_cast<const std::string&>(objDictEntry.first);
-
-                // If path is inventory association for one of the specified
-                // sensors
-                for (const std::string& sensorName : *sensorNames)
+                sensorAssocPath = sensorName;
+                sensorAssocPath += "/inventory";
+                const std::vector<std::string>* endpoints =
+                    graph.getEndpoints(sensorAssocPath);
+                if (endpoints != nullptr && !endpoints->empty())
                 {
-                    sensorAssocPath = sensorName;
-                    sensorAssocPath += "/inventory";
-                    if (objPath == sensorAssocPath)
-                    {
-                        // Get Association interface for object path
-                        for (const auto& [interface, values] :
-                             objDictEntry.second)
-                        {
-                            if (interface == "xyz.openbmc_project.Association")
-                            {
-                                for (const auto& [valueName, value] : values)
-                                {
-                                    if (valueName == "endpoints")
-                                    {
-                                        const std::vector<std::string>*
-                                            endpoints = std::get_if<
-                                                std::vector<std::string>>(
-                                                &value);
-                                        if ((endpoints != nullptr) &&
-                                            !endpoints->empty())
-                                        {
-                                            // Add inventory item to vector
-                                            const std::string& invItemPath =
-                                                endpoints->front();
-                                            addInventoryItem(inventoryItems,
-                                                             invItemPath,
-                                                             sensorName);
-                                        }
-                                    }
-                                }
-                            }
-                        }
-                        break;
-                    }
+                    // Add inventory item to vector
+                    addInventoryItem(inventoryItems, endpoints->front(),
+                                     sensorName);
                 }
             }
 
-            // Now loop through the returned object paths again, this time to
-            // find the leds associated with the inventory items we just found
+            // Then find the leds associated with the inventory items we just
+            // found
             std::string inventoryAssocPath;
             inventoryAssocPath.reserve(128); // avoid memory allocations
-            for (const auto& objDictEntry : resp)
+            for (InventoryItem& inventoryItem : *inventoryItems)
             {
-                const std::string& objPath =
-                    static_cast<const std::string&>(objDictEntry.first);
-
-                for (InventoryItem& inventoryItem : *inventoryItems)
+                inventoryAssocPath = inventoryItem.objectPath;
+                inventoryAssocPath += "/leds";
+                const std::vector<std::string>* endpoints =
+                    graph.getEndpoints(inventoryAssocPath);
+                if (endpoints != nullptr && !endpoints->empty())
                 {
-                    inventoryAssocPath = inventoryItem.objectPath;
-                    inventoryAssocPath += "/leds";
-                    if (objPath == inventoryAssocPath)
-                    {
-                        for (const auto& [interface, values] :
-                             objDictEntry.second)
-                        {
-                            if (interface == "xyz.openbmc_project.Association")
-                            {
-                                for (const auto& [valueName, value] : values)
-                                {
-                                    if (valueName == "endpoints")
-                                    {
-                                        const std::vector<std::string>*
-                                            endpoints = std::get_if<
-                                                std::vector<std::string>>(
-                                                &value);
-                                        if ((endpoints != nullptr) &&
-                                            !endpoints->empty())
-                                        {
-                                            // Add inventory item to vector
-                                            // Store LED path in inventory item
-                                            const std::string& ledPath =
-                                                endpoints->front();
-                                            inventoryItem.ledObjectPath =
-                                                ledPath;
-                                        }
-                                    }
-                                }
-                            }
-                        }
-
-                        break;
-                    }
+                    // Store LED path in inventory item
+                    inventoryItem.ledObjectPath = endpoints->front();
                 }
             }
             callback(inventoryItems);
@@ -1689,92 +1628,6 @@ void getPowerSupplyAttributes(
     BMCWEB_LOG_DEBUG("getPowerSupplyAttributes exit");
 }
 
-/**
- * @brief Gets inventory items associated with sensors.
- *
- * Finds the inventory items that are associated with the specified sensors.
- * Then gets D-Bus data for the inventory items, such as presence and VPD.
- *
- * This data is later used to provide sensor property values in the JSON
- * response.
- *
- * Finds the inventory items asynchronously.  Invokes callback when the
- * inventory items have been obtained.
- *
- * The callback must have the following signature:
- *   @code
- *   callback(std::shared_ptr<std::vector<InventoryItem>> inventoryItems)
- *   @endcode
- *
- * @param sensorsAsyncResp Pointer to object holding response data.
- * @param sensorNames All sensors within the current chassis.
- * implements ObjectManager.
- * @param callback Callback to invoke when inventory items have been obtained.
- */
-template <typename Callback>
-inline void getInventoryItems(
-    const std::shared_ptr<SensorsAsyncResp>& sensorsAsyncResp,
-    const std::shared_ptr<std::set<std::string>>& sensorNames,
-    Callback&& callback)
-{
-    BMCWEB_LOG_DEBUG("getInventoryItems enter");
-    auto getInventoryItemAssociationsCb =
-        [sensorsAsyncResp, callback = std::forward<Callback>(callback)](
-            const std::shared_ptr<std::vector<InventoryItem>>&
-                inventoryItems) mutable {
-            BMCWEB_LOG_DEBUG("getInventoryItemAssociationsCb enter");
-            auto getInventoryItemsConnectionsCb =
-                [sensorsAsyncResp, inventoryItems,
-                 callback = std::forward<Callback>(callback)](
-                    const std::shared_ptr<std::set<std::string>>&
-                        invConnections) mutable {
-                    BMCWEB_LOG_DEBUG("getInventoryItemsConnectionsCb enter");
-                    auto getInventoryItemsDataCb =
-                        [sensorsAsyncResp, inventoryItems,
-                         callback =
-                             std::forward<Callback>(callback)]() mutable {
-                            BMCWEB_LOG_DEBUG("getInventoryItemsDataCb enter");
-
-                            auto getInventoryLedsCb =
-                                [sensorsAsyncResp, inventoryItems,
-                                 callback = std::forward<Callback>(
-                                     callback)]() mutable {
-                                    BMCWEB_LOG_DEBUG(
-                                        "getInventoryLedsCb enter");
-                                    // Find Power Supply Attributes and get the
-                                    // data
-                                    getPowerSupplyAttributes(
-                                        sensorsAsyncResp, inventoryItems,
-                                        std::move(callback));
-                                    BMCWEB_LOG_DEBUG("getInventoryLedsCb exit");
-                                };
-
-                            // Find led connections and get the data
-                            getInventoryLeds(sensorsAsyncResp, inventoryItems,
-                                             std::move(getInventoryLedsCb));
-                            BMCWEB_LOG_DEBUG("getInventoryItemsDataCb exit");
-                        };
-
-                    // Get inventory item data from connections
-                    getInventoryItemsData(sensorsAsyncResp, inventoryItems,
-                                          invConnections,
-                                          std::move(getInventoryItemsDataCb));
-                    BMCWEB_LOG_DEBUG("getInventoryItemsConnectionsCb exit");
-                };
-
-            // Get connections that provide inventory item data
-            getInventoryItemsConnections(
-                sensorsAsyncResp, inventoryItems,
-                std::move(getInventoryItemsConnectionsCb));
-            BMCWEB_LOG_DEBUG("getInventoryItemAssociationsCb exit");
-        };
-
-    // Get associations from sensors to inventory items
-    getInventoryItemAssociations(sensorsAsyncResp, sensorNames,
-                                 std::move(getInventoryItemAssociationsCb));
-    BMCWEB_LOG_DEBUG("getInventoryItems exit");
-}
-
 /**
  * @brief Returns JSON PowerSupply object for the specified inventory item.
  *
@@ -1849,37 +1702,261 @@ inline nlohmann::json& getPowerSupply(nlohmann::json& powerSupplyArray,
 }
 
 /**
- * @brief Gets the values of the specified sensors.
+ * @brief Stores the values of the specified sensors as JSON.
  *
  * Stores the results as JSON in the SensorsAsyncResp.
  *
- * Gets the sensor values asynchronously.  Stores the results later when the
- * information has been obtained.
- *
  * The sensorNames set contains all requested sensors for the current chassis.
+ * Objects in the response that aren't requested sensors are skipped.
+ *
+ * The InventoryItem vector contains D-Bus inventory items associated with the
+ * sensors.  Inventory item data is needed for some Redfish sensor properties.
+ *
+ * @param sensorsAsyncResp Pointer to object holding response data.
+ * @param sensorNames All requested sensors within the current chassis.
+ * @param inventoryItems Inventory items associated with the sensors.
+ * @param resp GetManagedObjects response from a connection that provides
+ * sensor values.
+ */
+inline void storeSensorData(
+    const std::shared_ptr<SensorsAsyncResp>& sensorsAsyncResp,
+    const std::set<std::string>& sensorNames,
+    const std::shared_ptr<std::vector<InventoryItem>>& inventoryItems,
+    const dbus::utility::ManagedObjectType& resp)
+{
+    auto chassisSubNode = sensor_utils::chassisSubNodeFromString(
+        sensorsAsyncResp->chassisSubNode);
+    // Go through all objects and update response with sensor data
+    for (const auto& objDictEntry : resp)
+    {
+        const std::string& objPath =
+            static_cast<const std::string&>(objDictEntry.first);
+        BMCWEB_LOG_DEBUG("storeSensorData parsing object {}", objPath);
+
+        std::vector<std::string> split;
+        // Reserve space for
+        // /xyz/openbmc_project/sensors/<name>/<subname>
+        split.reserve(6);
+        // NOLINTNEXTLINE
+        bmcweb::split(split, objPath, '/');
+        if (split.size() < 6)
+        {
+            BMCWEB_LOG_ERROR("Got path that isn't long enough {}", objPath);
+            continue;
+        }
+        // These indexes aren't intuitive, as split puts an empty
+        // string at the beginning
+        const std::string& sensorType = split[4];
+        const std::string& sensorName = split[5];
+        BMCWEB_LOG_DEBUG("sensorName {} sensorType {}", sensorName,
+                         sensorType);
+        if (!sensorNames.contains(objPath))
+        {
+            BMCWEB_LOG_DEBUG("{} not in sensor list ", sensorName);
+            continue;
+        }
+
+        // Find inventory item (if any) associated with sensor
+        InventoryItem* inventoryItem =
+            findInventoryItemForSensor(inventoryItems, objPath);
+
+        const std::string& sensorSchema = sensorsAsyncResp->chassisSubNode;
+
+        nlohmann::json* sensorJson = nullptr;
+
+        if (sensorSchema == sensors::sensorsNodeStr &&
+            !sensorsAsyncResp->efficientExpand)
+        {
+            std::string sensorId =
+                redfish::sensor_utils::getSensorId(sensorName, sensorType);
+
+            sensorsAsyncResp->asyncResp->res.jsonValue["@odata.id"] =
+                boost::urls::format("/redfish/v1/Chassis/{}/{}/{}",
+                                    sensorsAsyncResp->chassisId,
+                                    sensorsAsyncResp->chassisSubNode,
+                                    sensorId);
+            sensorJson = &(sensorsAsyncResp->asyncResp->res.jsonValue);
+        }
+        else
+        {
+            std::string fieldName;
+            if (sensorsAsyncResp->efficientExpand)
+            {
+                fieldName = "Members";
+            }
+            else if (sensorType == "temperature")
+            {
+                fieldName = "Temperatures";
+            }
+            else if (sensorType == "fan" || sensorType == "fan_tach" ||
+                     sensorType == "fan_pwm")
+            {
+                fieldName = "Fans";
+            }
+            else if (sensorType == "voltage")
+            {
+                fieldName = "Voltages";
+            }
+            else if (sensorType == "power")
+            {
+                if (sensorName == "total_power")
+                {
+                    fieldName = "PowerControl";
+                }
+                else if ((inventoryItem != nullptr) &&
+                         (inventoryItem->isPowerSupply))
+                {
+                    fieldName = "PowerSupplies";
+                }
+                else
+                {
+                    // Other power sensors are in SensorCollection
+                    continue;
+                }
+            }
+            else
+            {
+                BMCWEB_LOG_ERROR("Unsure how to handle sensorType {}",
+                                 sensorType);
+                continue;
+            }
+
+            nlohmann::json& tempArray =
+                sensorsAsyncResp->asyncResp->res.jsonValue[fieldName];
+            if (fieldName == "PowerControl")
+            {
+                if (tempArray.empty())
+                {
+                    // Put multiple "sensors" into a single
+                    // PowerControl. Follows MemberId naming and
+                    // naming in power.hpp.
+                    nlohmann::json::object_t power;
+                    boost::urls::url url = boost::urls::format(
+                        "/redfish/v1/Chassis/{}/{}",
+                        sensorsAsyncResp->chassisId,
+                        sensorsAsyncResp->chassisSubNode);
+                    url.set_fragment(
+                        (""_json_pointer / fieldName / "0").to_string());
+                    power["@odata.id"] = std::move(url);
+                    tempArray.emplace_back(std::move(power));
+                }
+                sensorJson = &(tempArray.back());
+            }
+            else if (fieldName == "PowerSupplies")
+            {
+                if (inventoryItem != nullptr)
+                {
+                    sensorJson = &(getPowerSupply(tempArray, *inventoryItem,
+                                                  sensorsAsyncResp->chassisId));
+                }
+            }
+            else if (fieldName == "Members")
+            {
+                std::string sensorId =
+                    redfish::sensor_utils::getSensorId(sensorName, sensorType);
+
+                nlohmann::json::object_t member;
+                member["@odata.id"] = boost::urls::format(
+                    "/redfish/v1/Chassis/{}/{}/{}", sensorsAsyncResp->chassisId,
+                    sensorsAsyncResp->chassisSubNode, sensorId);
+                tempArray.emplace_back(std::move(member));
+                sensorJson = &(tempArray.back());
+            }
+            else
+            {
+                nlohmann::json::object_t member;
+                boost::urls::url url = boost::urls::format(
+                    "/redfish/v1/Chassis/{}/{}", sensorsAsyncResp->chassisId,
+                    sensorsAsyncResp->chassisSubNode);
+                url.set_fragment((""_json_pointer / fieldName).to_string());
+                member["@odata.id"] = std::move(url);
+                tempArray.emplace_back(std::move(member));
+                sensorJson = &(tempArray.back());
+            }
+        }
+
+        if (sensorJson != nullptr)
+        {
+            objectInterfacesToJson(sensorName, sensorType, chassisSubNode,
+                                   objDictEntry.second, *sensorJson,
+                                   inventoryItem);
+
+            std::string path = "/xyz/openbmc_project/sensors/";
+            path += sensorType;
+            path += "/";
+            path += sensorName;
+            sensorsAsyncResp->addMetadata(*sensorJson, path);
+        }
+    }
+}
+
+/**
+ * @brief Sorts the stored sensors and fills in the properties that depend on
+ * all of them.  Called once every sensor has been stored.
+ *
+ * @param sensorsAsyncResp Pointer to object holding response data.
+ */
+inline void finishSensorData(
+    const std::shared_ptr<SensorsAsyncResp>& sensorsAsyncResp)
+{
+    auto chassisSubNode = sensor_utils::chassisSubNodeFromString(
+        sensorsAsyncResp->chassisSubNode);
+    sortJSONResponse(sensorsAsyncResp);
+    if (chassisSubNode == sensor_utils::ChassisSubNode::sensorsNode &&
+        sensorsAsyncResp->efficientExpand)
+    {
+        sensorsAsyncResp->asyncResp->res.jsonValue["Members@odata.count"] =
+            sensorsAsyncResp->asyncResp->res.jsonValue["Members"].size();
+    }
+    else if (chassisSubNode == sensor_utils::ChassisSubNode::thermalNode)
+    {
+        populateFanRedundancy(sensorsAsyncResp);
+    }
+}
+
+/**
+ * @brief Gets the values of the specified sensors.
  *
  * To minimize the number of DBus calls, the DBus method
  * org.freedesktop.DBus.ObjectManager.GetManagedObjects() is used to get the
- * values of all sensors provided by a connection (service).
+ * values of all sensors provided by a connection (service).  All connections
+ * are queried at once.
  *
  * The connections set contains all the connections that provide sensor values.
  *
- * The InventoryItem vector contains D-Bus inventory items associated with the
- * sensors.  Inventory item data is needed for some Redfish sensor properties.
+ * Gets the sensor values asynchronously.  Invokes onReply with each
+ * connection's response as it arrives; the response is only valid for the
+ * duration of the call.  Invokes callback once every connection has answered.
  *
- * @param SensorsAsyncResp Pointer to object holding response data.
- * @param sensorNames All requested sensors within the current chassis.
+ * The callbacks must have the following signatures:
+ *   @code
+ *   onReply(const dbus::utility::ManagedObjectType& resp)
+ *   callback()
+ *   @endcode
+ *
+ * @param sensorsAsyncResp Pointer to object holding response data.
  * @param connections Connections that provide sensor values.
- * implements ObjectManager.
- * @param inventoryItems Inventory items associated with the sensors.
+ * @param onReply Callback to invoke with each connection's response.
+ * @param callback Callback to invoke when the values have been obtained.
  */
-inline void getSensorData(
-    const std::shared_ptr<SensorsAsyncResp>& sensorsAsyncResp,
-    const std::shared_ptr<std::set<std::string>>& sensorNames,
-    const std::set<std::string>& connections,
-    const std::shared_ptr<std::vector<InventoryItem>>& inventoryItems)
+template <typename OnReply, typename Callback>
+void getSensorData(const std::shared_ptr<SensorsAsyncResp>& sensorsAsyncResp,
+                   const std::set<std::string>& connections, OnReply&& onReply,
+                   Callback&& callback)
 {
     BMCWEB_LOG_DEBUG("getSensorData enter");
+    if (connections.empty())
+    {
+        callback();
+        BMCWEB_LOG_DEBUG("getSensorData exit");
+        return;
+    }
+    auto sharedOnReply = std::make_shared<std::decay_t<OnReply>>(
+        std::forward<OnReply>(onReply));
+    auto sharedCallback = std::make_shared<std::decay_t<Callback>>(
+        std::forward<Callback>(callback));
+    auto remaining = std::make_shared<size_t>(connections.size());
+
     // Get managed objects from all services exposing sensors
     for (const std::string& connection : connections)
     {
@@ -1887,9 +1964,9 @@ inline void getSensorData(
             "/xyz/openbmc_project/sensors");
         dbus::utility::getManagedObjects(
             connection, sensorPath,
-            [sensorsAsyncResp, sensorNames,
-             inventoryItems](const boost::system::error_code& ec,
-                             const dbus::utility::ManagedObjectType& resp) {
+            [sensorsAsyncResp, sharedOnReply, sharedCallback,
+             remaining](const boost::system::error_code& ec,
+                        const dbus::utility::ManagedObjectType& resp) {
                 BMCWEB_LOG_DEBUG("getManagedObjectsCb enter");
                 if (ec)
                 {
@@ -1897,202 +1974,10 @@ inline void getSensorData(
                     messages::internalError(sensorsAsyncResp->asyncResp->res);
                     return;
                 }
-                auto chassisSubNode = sensor_utils::chassisSubNodeFromString(
-                    sensorsAsyncResp->chassisSubNode);
-                // Go through all objects and update response with sensor data
-                for (const auto& objDictEntry : resp)
-                {
-                    const std::string& objPath =
-                        static_cast<const std::string&>(objDictEntry.first);
-                    BMCWEB_LOG_DEBUG("getManagedObjectsCb parsing object {}",
-                                     objPath);
-
-                    std::vector<std::string> split;
-                    // Reserve space for
-                    // /xyz/openbmc_project/sensors/<name>/<subname>
-                    split.reserve(6);
-                    // NOLINTNEXTLINE
-                    bmcweb::split(split, objPath, '/');
-                    if (split.size() < 6)
-                    {
-                        BMCWEB_LOG_ERROR("Got path that isn't long enough {}",
-                                         objPath);
-                        continue;
-                    }
-                    // These indexes aren't intuitive, as split puts an empty
-                    // string at the beginning
-                    const std::string& sensorType = split[4];
-                    const std::string& sensorName = split[5];
-                    BMCWEB_LOG_DEBUG("sensorName {} sensorType {}", sensorName,
-                                     sensorType);
-                    if (!sensorNames->contains(objPath))
-                    {
-                        BMCWEB_LOG_DEBUG("{} not in sensor list ", sensorName);
-                        continue;
-                    }
-
-                    // Find inventory item (if any) associated with sensor
-                    InventoryItem* inventoryItem =
-                        findInventoryItemForSensor(inventoryItems, objPath);
-
-                    const std::string& sensorSchema =
-                        sensorsAsyncResp->chassisSubNode;
-
-                    nlohmann::json* sensorJson = nullptr;
-
-                    if (sensorSchema == sensors::sensorsNodeStr &&
-                        !sensorsAsyncResp->efficientExpand)
-                    {
-                        std::string sensorId =
-                            redfish::sensor_utils::getSensorId(sensorName,
-                                                               sensorType);
-
-                        sensorsAsyncResp->asyncResp->res
-                            .jsonValue["@odata.id"] = boost::urls::format(
-                            "/redfish/v1/Chassis/{}/{}/{}",
-                            sensorsAsyncResp->chassisId,
-                            sensorsAsyncResp->chassisSubNode, sensorId);
-                        sensorJson =
-                            &(sensorsAsyncResp->asyncResp->res.jsonValue);
-                    }
-                    else
-                    {
-                        std::string fieldName;
-                        if (sensorsAsyncResp->efficientExpand)
-                        {
-                            fieldName = "Members";
-                        }
-                        else if (sensorType == "temperature")
-                        {
-                            fieldName = "Temperatures";
-                        }
-                        else if (sensorType == "fan" ||
-                                 sensorType == "fan_tach" ||
-                                 sensorType == "fan_pwm")
-                        {
-                            fieldName = "Fans";
-                        }
-                        else if (sensorType == "voltage")
-                        {
-                            fieldName = "Voltages";
-                        }
-                        else if (sensorType == "power")
-                        {
-                            if (sensorName == "total_power")
-                            {
-                                fieldName = "PowerControl";
-                            }
-                            else if ((inventoryItem != nullptr) &&
-                                     (inventoryItem->isPowerSupply))
-                            {
-                                fieldName = "PowerSupplies";
-                            }
-                            else
-                            {
-                                // Other power sensors are in SensorCollection
-                                continue;
-                            }
-                        }
-                        else
-                        {
-                            BMCWEB_LOG_ERROR(
-                                "Unsure how to handle sensorType {}",
-                                sensorType);
-                            continue;
-                        }
-
-                        nlohmann::json& tempArray =
-                            sensorsAsyncResp->asyncResp->res
-                                .jsonValue[fieldName];
-                        if (fieldName == "PowerControl")
-                        {
-                            if (tempArray.empty())
-                            {
-                                // Put multiple "sensors" into a single
-                                // PowerControl. Follows MemberId naming and
-                                // naming in power.hpp.
-                                nlohmann::json::object_t power;
-                                boost::urls::url url = boost::urls::format(
-                                    "/redfish/v1/Chassis/{}/{}",
-                                    sensorsAsyncResp->chassisId,
-                                    sensorsAsyncResp->chassisSubNode);
-                                url.set_fragment(
-                                    (""_json_pointer / fieldName / "0")
-                                        .to_string());
-                                power["@odata.id"] = std::move(url);
-                                tempArray.emplace_back(std::move(power));
-                            }
-                            sensorJson = &(tempArray.back());
-                        }
-                        else if (fieldName == "PowerSupplies")
-                        {
-                            if (inventoryItem != nullptr)
-                            {
-                                sensorJson = &(getPowerSupply(
-                                    tempArray, *inventoryItem,
-                                    sensorsAsyncResp->chassisId));
-                            }
-                        }
-                        else if (fieldName == "Members")
-                        {
-                            std::string sensorId =
-                                redfish::sensor_utils::getSensorId(sensorName,
-                                                                   sensorType);
-
-                            nlohmann::json::object_t member;
-                            member["@odata.id"] = boost::urls::format(
-                                "/redfish/v1/Chassis/{}/{}/{}",
-                                sensorsAsyncResp->chassisId,
-                                sensorsAsyncResp->chassisSubNode, sensorId);
-                            tempArray.emplace_back(std::move(member));
-                            sensorJson = &(tempArray.back());
-                        }
-                        else
-                        {
-                            nlohmann::json::object_t member;
-                            boost::urls::url url = boost::urls::format(
-                                "/redfish/v1/Chassis/{}/{}",
-                                sensorsAsyncResp->chassisId,
-                                sensorsAsyncResp->chassisSubNode);
-                            url.set_fragment(
-                                (""_json_pointer / fieldName).to_string());
-                            member["@odata.id"] = std::move(url);
-                            tempArray.emplace_back(std::move(member));
-                            sensorJson = &(tempArray.back());
-                        }
-                    }
-
-                    if (sensorJson != nullptr)
-                    {
-                        objectInterfacesToJson(
-                            sensorName, sensorType, chassisSubNode,
-                            objDictEntry.second, *sensorJson, inventoryItem);
-
-                        std::string path = "/xyz/openbmc_project/sensors/";
-                        path += sensorType;
-                        path += "/";
-                        path += sensorName;
-                        sensorsAsyncResp->addMetadata(*sensorJson, path);
-                    }
-                }
-                if (sensorsAsyncResp.use_count() == 1)
+                (*sharedOnReply)(resp);
+                if (--(*remaining) == 0)
                 {
-                    sortJSONResponse(sensorsAsyncResp);
-                    if (chassisSubNode ==
-                            sensor_utils::ChassisSubNode::sensorsNode &&
-                        sensorsAsyncResp->efficientExpand)
-                    {
-                        sensorsAsyncResp->asyncResp->res
-                            .jsonValue["Members@odata.count"] =
-                            sensorsAsyncResp->asyncResp->res
-                                .jsonValue["Members"]
-                                .size();
-                    }
-                    else if (chassisSubNode ==
-                             sensor_utils::ChassisSubNode::thermalNode)
-                    {
-                        populateFanRedundancy(sensorsAsyncResp);
-                    }
+                    (*sharedCallback)();
                 }
                 BMCWEB_LOG_DEBUG("getManagedObjectsCb exit");
             });
@@ -2100,33 +1985,147 @@ inline void getSensorData(
     BMCWEB_LOG_DEBUG("getSensorData exit");
 }
 
+/**
+ * @brief Builds the response for the specified sensors.
+ *
+ * Sensor values and inventory data come from different services, so rather
+ * than waiting on each D-Bus call in turn, the calls are run as a dependency
+ * graph: every call starts as soon as the data it needs is available.  The
+ * sensor values are fetched alongside the inventory items, and the inventory
+ * LEDs alongside the inventory item data.  Sensors are stored as JSON straight
+ * from each reply once the inventory items are complete; only the requested
+ * sensors from replies that arrive earlier are held until then.  The latency
+ * of each stage is logged at debug level.
+ *
+ * @param sensorsAsyncResp Pointer to object holding response data.
+ * @param sensorNames All requested sensors within the current chassis.
+ */
 inline void processSensorList(
     const std::shared_ptr<SensorsAsyncResp>& sensorsAsyncResp,
     const std::shared_ptr<std::set<std::string>>& sensorNames)
 {
-    auto getConnectionCb = [sensorsAsyncResp, sensorNames](
-                               const std::set<std::string>& connections) {
-        BMCWEB_LOG_DEBUG("getConnectionCb enter");
-        auto getInventoryItemsCb =
-            [sensorsAsyncResp, sensorNames, connections](
-                const std::shared_ptr<std::vector<InventoryItem>>&
-                    inventoryItems) mutable {
-                BMCWEB_LOG_DEBUG("getInventoryItemsCb enter");
-                // Get sensor data and store results in JSON
-                getSensorData(sensorsAsyncResp, sensorNames, connections,
-                              inventoryItems);
-                BMCWEB_LOG_DEBUG("getInventoryItemsCb exit");
-            };
-
-        // Get inventory items associated with sensors
-        getInventoryItems(sensorsAsyncResp, sensorNames,
-                          std::move(getInventoryItemsCb));
-
-        BMCWEB_LOG_DEBUG("getConnectionCb exit");
+    // Results handed from one stage to the next
+    struct SensorPipeline
+    {
+        std::set<std::string> connections;
+        std::shared_ptr<std::vector<InventoryItem>> inventoryItems;
+        std::shared_ptr<std::set<std::string>> invConnections;
+        bool inventoryReady = false;
+        // Requested sensors from replies that arrived before the inventory
+        dbus::utility::ManagedObjectType heldSensors;
     };
-
-    // Get set of connections that provide sensor values
-    getConnections(sensorsAsyncResp, sensorNames, std::move(getConnectionCb));
+    auto pipeline = std::make_shared<SensorPipeline>();
+    // stage_graph_test.cpp copies the shape of this graph, so keep it in step
+    auto graph = std::make_shared<StageGraph>();
+
+    size_t associations = graph->add(
+        "associations", {},
+        [sensorsAsyncResp, sensorNames, pipeline](StageGraph::Done&& done) {
+            getInventoryItemAssociations(
+                sensorsAsyncResp, sensorNames,
+                [pipeline, done{std::move(done)}](
+                    const std::shared_ptr<std::vector<InventoryItem>>&
+                        inventoryItems) {
+                    pipeline->inventoryItems = inventoryItems;
+                    done();
+                });
+        });
+    size_t inventoryConnections = graph->add(
+        "inventoryConnections", {associations},
+        [sensorsAsyncResp, pipeline](StageGraph::Done&& done) {
+            getInventoryItemsConnections(
+                sensorsAsyncResp, pipeline->inventoryItems,
+                [pipeline, done{std::move(done)}](
+                    const std::shared_ptr<std::set<std::string>>&
+                        invConnections) {
+                    pipeline->invConnections = invConnections;
+                    done();
+                });
+        });
+    size_t inventoryData = graph->add(
+        "inventoryData", {inventoryConnections},
+        [sensorsAsyncResp, pipeline](StageGraph::Done&& done) {
+            getInventoryItemsData(sensorsAsyncResp, pipeline->inventoryItems,
+                                  pipeline->invConnections, std::move(done));
+        });
+    size_t leds = graph->add(
+        "leds", {associations},
+        [sensorsAsyncResp, pipeline](StageGraph::Done&& done) {
+            getInventoryLeds(sensorsAsyncResp, pipeline->inventoryItems,
+                             std::move(done));
+        });
+    // Needs to know which inventory items are power supplies
+    size_t powerSupplyAttributes = graph->add(
+        "powerSupplyAttributes", {inventoryData},
+        [sensorsAsyncResp, pipeline](StageGraph::Done&& done) {
+            getPowerSupplyAttributes(
+                sensorsAsyncResp, pipeline->inventoryItems,
+                [done{std::move(done)}](
+                    const std::shared_ptr<std::vector<InventoryItem>>&) {
+                    done();
+                });
+        });
+    size_t connections = graph->add(
+        "connections", {},
+        [sensorsAsyncResp, sensorNames, pipeline](StageGraph::Done&& done) {
+            getConnections(sensorsAsyncResp, sensorNames,
+                           [pipeline, done{std::move(done)}](
+                               const std::set<std::string>& sensorConnections) {
+                               pipeline->connections = sensorConnections;
+                               done();
+                           });
+        });
+    size_t sensorValues = graph->add(
+        "sensorValues", {connections},
+        [sensorsAsyncResp, sensorNames, pipeline](StageGraph::Done&& done) {
+            getSensorData(
+                sensorsAsyncResp, pipeline->connections,
+                [sensorsAsyncResp, sensorNames,
+                 pipeline](const dbus::utility::ManagedObjectType& resp) {
+                    if (pipeline->inventoryReady)
+                    {
+                        storeSensorData(sensorsAsyncResp, *sensorNames,
+                                        pipeline->inventoryItems, resp);
+                        return;
+                    }
+                    // A service's reply covers every chassis, so only the
+                    // requested sensors are held
+                    for (const auto& object : resp)
+                    {
+                        if (sensorNames->contains(object.first.str))
+                        {
+                            pipeline->heldSensors.emplace_back(object);
+                        }
+                    }
+                },
+                std::move(done));
+        });
+    size_t inventoryReady = graph->add(
+        "inventoryReady", {inventoryData, leds, powerSupplyAttributes},
+        [sensorsAsyncResp, sensorNames, pipeline](StageGraph::Done&& done) {
+            pipeline->inventoryReady = true;
+            storeSensorData(sensorsAsyncResp, *sensorNames,
+                            pipeline->inventoryItems, pipeline->heldSensors);
+            pipeline->heldSensors = {};
+            done();
+        });
+    graph->add("sensorJson", {sensorValues, inventoryReady},
+               [sensorsAsyncResp](StageGraph::Done&& done) {
+                   finishSensorData(sensorsAsyncResp);
+                   done();
+               });
+
+    graph->run([sensorsAsyncResp](const StageGraph& completed) {
+        // Only format the timings when they will be logged
+        if (crow::getBmcwebCurrentLoggingLevel() < crow::LogLevel::Debug)
+        {
+            return;
+        }
+        BMCWEB_LOG_DEBUG("Sensor stages for {} {}: {}",
+                         sensorsAsyncResp->chassisId,
+                         sensorsAsyncResp->chassisSubNode,
+                         completed.formatTimings());
+    });
 }
 
 /**
@@ -12,6 +12,7 @@
 #include "error_messages.hpp"
 #include "generated/enums/resource.hpp"
 #include "generated/enums/update_service.hpp"
+#include "http_body.hpp"
 #include "http_request.hpp"
 #include "http_response.hpp"
 #include "io_context_singleton.hpp"
@@ -34,6 +35,8 @@
 
 #include <boost/asio/error.hpp>
 #include <boost/asio/steady_timer.hpp>
+#include <boost/beast/core/file_base.hpp>
+#include <boost/beast/core/file_posix.hpp>
 #include <boost/beast/http/fields.hpp>
 #include <boost/beast/http/status.hpp>
 #include <boost/beast/http/verb.hpp>
@@ -63,6 +66,7 @@
 #include <optional>
 #include <string>
 #include <string_view>
+#include <system_error>
 #include <unordered_map>
 #include <utility>
 #include <variant>
@@ -91,6 +95,9 @@ struct MemoryFileDescriptor
         fd(memfd_create(filename.c_str(), 0))
     {}
 
+    // Takes ownership of an already open descriptor
+    explicit MemoryFileDescriptor(int fdIn) : fd(fdIn) {}
+
     MemoryFileDescriptor(const MemoryFileDescriptor&) = default;
     MemoryFileDescriptor(MemoryFileDescriptor&& other) noexcept : fd(other.fd)
     {
@@ -643,6 +650,54 @@ inline void uploadImageFile(crow::Response& res, std::string_view body)
     }
 }
 
+inline void uploadImageFile(crow::Response& res,
+                            const boost::beast::file_posix& image)
+{
+    std::filesystem::path filepath("/tmp/images/" + bmcweb::getRandomUUID());
+
+    BMCWEB_LOG_DEBUG("Copying image to {}", filepath.string());
+    boost::beast::file_posix out;
+    boost::system::error_code ec;
+    out.open(filepath.c_str(), boost::beast::file_mode::write, ec);
+    if (ec)
+    {
+        BMCWEB_LOG_ERROR("Failed to open {} {}", filepath.string(),
+                         ec.message());
+        messages::internalError(res);
+        cleanUp();
+        return;
+    }
+    // set the permission of the file to 640
+    std::filesystem::perms permission =
+        std::filesystem::perms::owner_read | std::filesystem::perms::group_read;
+    std::error_code permEc;
+    std::filesystem::permissions(filepath, permission, permEc);
+    if (permEc)
+    {
+        BMCWEB_LOG_ERROR("Failed to set permissions on {} {}",
+                         filepath.string(), permEc.message());
+    }
+    if (permEc || !bmcweb::copyFileContents(image, out.native_handle()))
+    {
+        // Don't leave a truncated image for the software manager
+        std::error_code removeEc;
+        std::filesystem::remove(filepath, removeEc);
+        messages::internalError(res);
+        cleanUp();
+    }
+}
+
+inline void uploadImageFile(crow::Response& res, const crow::Request& req)
+{
+    if (!req.bodyFile().is_open())
+    {
+        uploadImageFile(res, req.body());
+        return;
+    }
+    BMCWEB_LOG_INFO("Received image with SHA-256 {}", req.bodySha256());
+    uploadImageFile(res, req.bodyFile());
+}
+
 // Convert the Request Apply Time to the D-Bus value
 inline bool convertApplyTime(crow::Response& res, const std::string& applyTime,
                              std::string& applyTimeNewVal)
@@ -688,6 +743,8 @@ struct MultiPartUpdateParameters
 {
     std::optional<std::string> applyTime;
     std::string uploadData;
+    // Holds the image instead of uploadData when it was streamed to a file
+    boost::beast::file_posix uploadFile;
     std::vector<std::string> targets;
 };
 
@@ -802,12 +859,19 @@ inline std::optional<MultiPartUpdateParameters>
             }
             else if (param.second == "UpdateFile")
             {
-                multiRet.uploadData = std::move(formpart.content);
+                if (formpart.file.is_open())
+                {
+                    multiRet.uploadFile = std::move(formpart.file);
+                }
+                else
+                {
+                    multiRet.uploadData = std::move(formpart.content);
+                }
             }
         }
     }
 
-    if (multiRet.uploadData.empty())
+    if (multiRet.uploadData.empty() && !multiRet.uploadFile.is_open())
     {
         BMCWEB_LOG_ERROR("Upload data is NULL");
         messages::propertyMissing(asyncResp->res, "UpdateFile");
@@ -924,23 +988,9 @@ inline void handleBMCUpdate(
 
 inline void processUpdateRequest(
     const std::shared_ptr<bmcweb::AsyncResp>& asyncResp,
-    task::Payload&& payload, std::string_view body,
+    task::Payload&& payload, MemoryFileDescriptor&& memfd,
     const std::string& applyTime, std::vector<std::string>& targets)
 {
-    MemoryFileDescriptor memfd("update-image");
-    if (memfd.fd == -1)
-    {
-        BMCWEB_LOG_ERROR("Failed to create image memfd");
-        messages::internalError(asyncResp->res);
-        return;
-    }
-    if (write(memfd.fd, body.data(), body.length()) !=
-        static_cast<ssize_t>(body.length()))
-    {
-        BMCWEB_LOG_ERROR("Failed to write to image memfd");
-        messages::internalError(asyncResp->res);
-        return;
-    }
     if (!memfd.rewind())
     {
         messages::internalError(asyncResp->res);
@@ -975,6 +1025,53 @@ inline void processUpdateRequest(
     }
 }
 
+inline void processUpdateRequest(
+    const std::shared_ptr<bmcweb::AsyncResp>& asyncResp,
+    task::Payload&& payload, std::string_view body,
+    const std::string& applyTime, std::vector<std::string>& targets)
+{
+    MemoryFileDescriptor memfd("update-image");
+    if (memfd.fd == -1)
+    {
+        BMCWEB_LOG_ERROR("Failed to create image memfd");
+        messages::internalError(asyncResp->res);
+        return;
+    }
+    if (write(memfd.fd, body.data(), body.length()) !=
+        static_cast<ssize_t>(body.length()))
+    {
+        BMCWEB_LOG_ERROR("Failed to write to image memfd");
+        messages::internalError(asyncResp->res);
+        return;
+    }
+    processUpdateRequest(asyncResp, std::move(payload), std::move(memfd),
+                         applyTime, targets);
+}
+
+inline void processUpdateRequest(
+    const std::shared_ptr<bmcweb::AsyncResp>& asyncResp,
+    task::Payload&& payload, const crow::Request& req,
+    const std::string& applyTime, std::vector<std::string>& targets)
+{
+    if (!req.bodyFile().is_open())
+    {
+        processUpdateRequest(asyncResp, std::move(payload), req.body(),
+                             applyTime, targets);
+        return;
+    }
+    // The image was already written to a memory file as it arrived
+    BMCWEB_LOG_INFO("Received image with SHA-256 {}", req.bodySha256());
+    MemoryFileDescriptor memfd(dup(req.bodyFile().native_handle()));
+    if (memfd.fd == -1)
+    {
+        BMCWEB_LOG_ERROR("Failed to duplicate image memfd");
+        messages::internalError(asyncResp->res);
+        return;
+    }
+    processUpdateRequest(asyncResp, std::move(payload), std::move(memfd),
+                         applyTime, targets);
+}
+
 inline void updateMultipartContext(
     const std::shared_ptr<bmcweb::AsyncResp>& asyncResp,
     const crow::Request& req, MultipartParser&& parser)
@@ -1000,6 +1097,21 @@ inline void updateMultipartContext(
         }
         task::Payload payload(req);
 
+        if (multipart->uploadFile.is_open())
+        {
+            MemoryFileDescriptor memfd(
+                dup(multipart->uploadFile.native_handle()));
+            if (memfd.fd == -1)
+            {
+                BMCWEB_LOG_ERROR("Failed to duplicate image memfd");
+                messages::internalError(asyncResp->res);
+                return;
+            }
+            processUpdateRequest(asyncResp, std::move(payload),
+                                 std::move(memfd), applyTimeNewVal,
+                                 multipart->targets);
+            return;
+        }
         processUpdateRequest(asyncResp, std::move(payload),
                              multipart->uploadData, applyTimeNewVal,
                              multipart->targets);
@@ -1012,7 +1124,14 @@ inline void updateMultipartContext(
         monitorForSoftwareAvailable(asyncResp, req,
                                     "/redfish/v1/UpdateService");
 
-        uploadImageFile(asyncResp->res, multipart->uploadData);
+        if (multipart->uploadFile.is_open())
+        {
+            uploadImageFile(asyncResp->res, multipart->uploadFile);
+        }
+        else
+        {
+            uploadImageFile(asyncResp->res, multipart->uploadData);
+        }
     }
 }
 
@@ -1029,7 +1148,7 @@ inline void doHTTPUpdate(const std::shared_ptr<bmcweb::AsyncResp>& asyncResp,
         targets.emplace_back(BMCWEB_REDFISH_MANAGER_URI_NAME);
 
         processUpdateRequest(
-            asyncResp, std::move(payload), req.body(),
+            asyncResp, std::move(payload), req,
             "xyz.openbmc_project.Software.ApplyTime.RequestedApplyTimes.Immediate",
             targets);
     }
@@ -1039,7 +1158,7 @@ inline void doHTTPUpdate(const std::shared_ptr<bmcweb::AsyncResp>& asyncResp,
         monitorForSoftwareAvailable(asyncResp, req,
                                     "/redfish/v1/UpdateService");
 
-        uploadImageFile(asyncResp->res, req.body());
+        uploadImageFile(asyncResp->res, req);
     }
 }
 
@@ -1082,7 +1201,17 @@ inline void handleUpdateServiceMultipartUpdatePost(
     {
         MultipartParser parser;
 
-        ParserError ec = parser.parse(req);
+        ParserError ec = ParserError::PARSER_SUCCESS;
+        if (req.streamedMultipart != nullptr)
+        {
+            // Already parsed while the body arrived
+            ec = req.streamedMultipart->finish();
+            parser = std::move(*req.streamedMultipart);
+        }
+        else
+        {
+            ec = parser.parse(req);
+        }
         if (ec != ParserError::PARSER_SUCCESS)
         {
             // handle error
@@ -200,6 +200,31 @@ bool Subscription::sendEventToSubscriber(uint64_t eventId, std::string&& msg)
     return true;
 }
 
+bool Subscription::sendSharedEventToSubscriber(
+    uint64_t eventId, const std::string& msg,
+    crow::sse_socket::SseEvent& sseFrame)
+{
+    if (sseConn == nullptr)
+    {
+        return sendEventToSubscriber(eventId, std::string(msg));
+    }
+
+    persistent_data::EventServiceConfig eventServiceConfig =
+        persistent_data::EventServiceStore::getInstance()
+            .getEventServiceConfig();
+    if (!eventServiceConfig.enabled)
+    {
+        return false;
+    }
+    if (sseFrame == nullptr)
+    {
+        sseFrame =
+            crow::sse_socket::formatSseEvent(std::to_string(eventId), msg);
+    }
+    sseConn->sendSseEvent(sseFrame);
+    return true;
+}
+
 void Subscription::filterAndSendEventLogs(
     uint64_t eventId, const std::vector<EventLogObjectsType>& eventRecords)
 {
@@ -256,43 +281,78 @@ void Subscription::filterAndSendEventLogs(
     sendEventToSubscriber(eventId, std::move(strMsg));
 }
 
-void Subscription::filterAndSendReports(uint64_t eventId,
-                                        const std::string& reportId,
-                                        const telemetry::TimestampReadings& var)
+SharedMetricReport::SharedMetricReport(const std::string& reportIdIn) :
+    reportId(reportIdIn),
+    mrdUri(boost::urls::format(
+               "/redfish/v1/TelemetryService/MetricReportDefinitions/{}",
+               reportIdIn)
+               .buffer())
+{}
+
+void SharedMetricReport::build(const telemetry::TimestampReadings& readings)
 {
-    boost::urls::url mrdUri = boost::urls::format(
-        "/redfish/v1/TelemetryService/MetricReportDefinitions/{}", reportId);
+    if (built)
+    {
+        return;
+    }
+    built = true;
+    filled = telemetry::fillReport(report, reportId, readings);
+    if (!filled)
+    {
+        BMCWEB_LOG_ERROR("Failed to fill the MetricReport for DBus "
+                         "Report with id {}",
+                         reportId);
+    }
+}
 
+SharedMetricReport::Payload& SharedMetricReport::payloadFor(
+    const std::string& context)
+{
+    auto it = payloads.find(context);
+    if (it != payloads.end())
+    {
+        return it->second;
+    }
+
+    Payload& payload = payloads[context];
+    if (context.empty())
+    {
+        payload.msg =
+            report.dump(2, ' ', true, nlohmann::json::error_handler_t::replace);
+        return payload;
+    }
+    // Context is set by user during Event subscription and it must be
+    // set for MetricReport response.
+    nlohmann::json msg = report;
+    msg["Context"] = context;
+    payload.msg =
+        msg.dump(2, ' ', true, nlohmann::json::error_handler_t::replace);
+    return payload;
+}
+
+void Subscription::filterAndSendReports(
+    uint64_t eventId, SharedMetricReport& report,
+    const telemetry::TimestampReadings& readings)
+{
     // Empty list means no filter. Send everything.
     if (!userSub->metricReportDefinitions.empty())
     {
         if (std::ranges::find(userSub->metricReportDefinitions,
-                              mrdUri.buffer()) ==
+                              report.definitionUri()) ==
             userSub->metricReportDefinitions.end())
         {
             return;
         }
     }
 
-    nlohmann::json msg;
-    if (!telemetry::fillReport(msg, reportId, var))
+    if (!report.valid(readings))
     {
-        BMCWEB_LOG_ERROR("Failed to fill the MetricReport for DBus "
-                         "Report with id {}",
-                         reportId);
         return;
     }
 
-    // Context is set by user during Event subscription and it must be
-    // set for MetricReport response.
-    if (!userSub->customText.empty())
-    {
-        msg["Context"] = userSub->customText;
-    }
-
-    std::string strMsg =
-        msg.dump(2, ' ', true, nlohmann::json::error_handler_t::replace);
-    sendEventToSubscriber(eventId, std::move(strMsg));
+    SharedMetricReport::Payload& payload =
+        report.payloadFor(userSub->customText);
+    sendSharedEventToSubscriber(eventId, payload.msg, payload.sseFrame);
 }
 
 void Subscription::updateRetryConfig(uint32_t retryAttempts,
@@ -619,7 +619,7 @@ def make_privilege_registry() -> None:
             (privilege_list, _) = privilege_dict[key]
             name = get_variable_name_for_privilege_set(privilege_list)
             registry.write(
-                "const std::array<Privileges, {length}> "
+                "constexpr std::array<Privileges, {length}> "
                 "privilegeSet{name} = {key};\n".format(
                     length=len(privilege_list), name=name, key=key
                 )
@@ -636,7 +636,7 @@ def make_privilege_registry() -> None:
                 operation = operation.lower()
 
                 registry.write(
-                    "const static auto& {}{} = privilegeSet{};\n".format(
+                    "static constexpr const auto& {}{} = privilegeSet{};\n".format(
                         operation, entity, privilege_dict[privilege_string][1]
                     )
                 )
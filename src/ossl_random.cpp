@@ -14,20 +14,94 @@ extern "C"
 #include <openssl/rand.h>
 }
 
+#include <pthread.h>
+
 #include <boost/uuid/basic_random_generator.hpp>
 #include <boost/uuid/uuid_io.hpp>
 
 #include <array>
-#include <random>
+#include <atomic>
 #include <string>
 
 namespace bmcweb
 {
+
+namespace
+{
+
+// Bumped in the child after fork(), so a child never reuses random bytes its
+// parent buffered
+std::atomic<unsigned> forkGeneration = 0;
+
+unsigned getForkGeneration()
+{
+    [[maybe_unused]] static const bool registered = []() {
+        if (pthread_atfork(nullptr, nullptr, []() { forkGeneration++; }) != 0)
+        {
+            BMCWEB_LOG_WARNING("Failed to register fork handler");
+            return false;
+        }
+        return true;
+    }();
+    return forkGeneration;
+}
+
+// Random bytes are drawn from OpenSSL's DRBG in blocks, and IDs are cut out
+// of the block, so that creating a session costs one RAND_bytes() call every
+// few sessions instead of one per character.  Consumed bytes are wiped so
+// that tokens which were handed out can't be recovered from the buffer.
+class RandomBytePool
+{
+  public:
+    RandomBytePool() = default;
+    RandomBytePool(const RandomBytePool&) = delete;
+    RandomBytePool(RandomBytePool&&) = delete;
+    RandomBytePool& operator=(const RandomBytePool&) = delete;
+    RandomBytePool& operator=(RandomBytePool&&) = delete;
+
+    ~RandomBytePool()
+    {
+        OPENSSL_cleanse(buffer.data(), buffer.size());
+    }
+
+    // Returns false if OpenSSL couldn't provide random data
+    bool next(uint8_t& out)
+    {
+        if (pos == buffer.size() || generation != getForkGeneration())
+        {
+            if (RAND_bytes(buffer.data(), static_cast<int>(buffer.size())) !=
+                1)
+            {
+                pos = buffer.size();
+                return false;
+            }
+            generation = getForkGeneration();
+            pos = 0;
+        }
+        out = buffer[pos];
+        buffer[pos] = 0;
+        pos++;
+        return true;
+    }
+
+  private:
+    std::array<uint8_t, 1024> buffer{};
+    size_t pos = buffer.size();
+    unsigned generation = 0;
+};
+
+RandomBytePool& getRandomBytePool()
+{
+    thread_local RandomBytePool pool;
+    return pool;
+}
+
+} // namespace
+
 uint8_t OpenSSLGenerator::operator()()
 {
     uint8_t index = 0;
-    int rc = RAND_bytes(&index, sizeof(index));
-    if (rc != opensslSuccess)
+    if (!getRandomBytePool().next(index))
     {
         BMCWEB_LOG_ERROR("Cannot get random number");
         err = true;
@@ -52,20 +126,26 @@ std::string getRandomIdOfLength(size_t length)
         'Q', 'R', 'S', 'T', 'U', 'V', 'W', 'X', 'Y', 'Z', 'a', 'b', 'c',
         'd', 'e', 'f', 'g', 'h', 'i', 'j', 'k', 'l', 'm', 'n', 'o', 'p',
         'q', 'r', 's', 't', 'u', 'v', 'w', 'x', 'y', 'z'};
+    // Bytes at or above the largest multiple of 62 are thrown away so that
+    // every character is equally likely
+    constexpr uint8_t rejectFrom = (256 / alphanum.size()) * alphanum.size();
 
     std::string token;
     token.resize(length, '0');
-    std::uniform_int_distribution<size_t> dist(0, alphanum.size() - 1);
-
-    bmcweb::OpenSSLGenerator gen;
 
+    RandomBytePool& pool = getRandomBytePool();
     for (char& tokenChar : token)
     {
-        tokenChar = alphanum[dist(gen)];
-        if (gen.error())
+        uint8_t byte = 0;
+        do
         {
-            return "";
-        }
+            if (!pool.next(byte))
+            {
+                BMCWEB_LOG_ERROR("Cannot get random number");
+                return "";
+            }
+        } while (byte >= rejectFrom);
+        tokenChar = alphanum[byte % alphanum.size()];
     }
     return token;
 }
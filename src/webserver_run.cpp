@@ -129,6 +129,7 @@ int run()
     }
 
     bmcweb::registerUserRemovedSignal();
+    bmcweb::registerUserPropertiesChangedSignal();
 
     bmcweb::ServiceWatchdog watchdog;
 
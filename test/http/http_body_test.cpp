@@ -3,14 +3,22 @@
 #include "file_test_utilities.hpp"
 #include "http_body.hpp"
 
+#include <unistd.h>
+
+#include <boost/asio/buffer.hpp>
 #include <boost/beast/core/file_base.hpp>
+#include <boost/beast/core/file_posix.hpp>
+#include <boost/beast/http/parser.hpp>
 #include <boost/system/error_code.hpp>
 
 #include <array>
 #include <cstddef>
 #include <cstdio>
+#include <fstream>
+#include <iterator>
 #include <span>
 #include <string>
+#include <string_view>
 #include <utility>
 
 #include <gmock/gmock.h>
@@ -133,5 +141,68 @@ TEST(HttpFileBodyValueType, SetFd)
     EXPECT_EQ(value.payloadSize(), 16);
 }
 
+TEST(HttpHttpBodyValueType, IsSendableFile)
+{
+    HttpBody::value_type value;
+    EXPECT_FALSE(value.isSendableFile());
+
+    TemporaryFileHandle temporaryFile("teststring");
+    boost::system::error_code ec;
+    value.open(temporaryFile.stringPath.c_str(),
+               boost::beast::file_mode::read, ec);
+    ASSERT_FALSE(ec);
+    EXPECT_TRUE(value.isSendableFile());
+
+    // Encoded bodies have to pass through the writer
+    value.encodingType = EncodingType::Base64;
+    EXPECT_FALSE(value.isSendableFile());
+
+    std::array<int, 2> pipeFds{};
+    ASSERT_EQ(pipe(pipeFds.data()), 0);
+    HttpBody::value_type piped;
+    piped.setFd(pipeFds[0], ec);
+    close(pipeFds[1]);
+    EXPECT_FALSE(piped.isSendableFile());
+}
+
+TEST(HttpBodyReader, SpoolsToMemfd)
+{
+    boost::beast::http::request_parser<HttpBody> parser;
+    boost::system::error_code ec;
+    std::string_view header =
+        "POST /upload/image HTTP/1.1\r\nContent-Length: 10\r\n\r\n";
+    parser.put(boost::asio::buffer(header), ec);
+    ASSERT_FALSE(ec);
+    ASSERT_TRUE(parser.is_header_done());
+
+    parser.get().body().spoolToMemfd(ec);
+    ASSERT_FALSE(ec);
+
+    std::string_view body = "teststring";
+    parser.put(boost::asio::buffer(body.substr(0, 4)), ec);
+    ASSERT_FALSE(ec);
+    parser.put(boost::asio::buffer(body.substr(4)), ec);
+    ASSERT_FALSE(ec);
+    ASSERT_TRUE(parser.is_done());
+
+    HttpBody::value_type& value = parser.get().body();
+    EXPECT_TRUE(value.str().empty());
+    EXPECT_EQ(value.payloadSize(), 10);
+    EXPECT_EQ(value.sha256(),
+              "3c8727e019a42b444667a587b6001251becadabbb36bfed8087a92c18882d111");
+
+    TemporaryFileHandle copy("");
+    boost::beast::file_posix out;
+    out.open(copy.stringPath.c_str(), boost::beast::file_mode::write, ec);
+    ASSERT_FALSE(ec);
+    ASSERT_TRUE(copyFileContents(value.file(), out.native_handle()));
+    out.close(ec);
+
+    std::ifstream in(copy.stringPath);
+    std::string copied{std::istreambuf_iterator<char>(in),
+                       std::istreambuf_iterator<char>()};
+    EXPECT_EQ(copied, "teststring");
+}
+
 } // namespace
 } // namespace bmcweb
@@ -102,4 +102,20 @@ TEST(http_connection, RequestPropogates)
     EXPECT_TRUE(clock.wascalled);
 }
 
+TEST(http_connection, StreamedUploadTargets)
+{
+    using boost::beast::http::verb;
+    EXPECT_TRUE(
+        isStreamedUploadTarget(verb::post, "/redfish/v1/UpdateService/update"));
+    EXPECT_TRUE(isStreamedUploadTarget(verb::post,
+                                       "/redfish/v1/UpdateService/update/"));
+    EXPECT_TRUE(isStreamedUploadTarget(verb::put, "/upload/image/foo"));
+    EXPECT_TRUE(isStreamedUploadTarget(verb::post, "/upload/image?x=1"));
+    EXPECT_FALSE(
+        isStreamedUploadTarget(verb::get, "/redfish/v1/UpdateService/update"));
+    EXPECT_FALSE(isStreamedUploadTarget(
+        verb::post, "/redfish/v1/UpdateService/update-multipart"));
+    EXPECT_FALSE(isStreamedUploadTarget(verb::post, "/upload/imagefoo"));
+}
+
 } // namespace crow
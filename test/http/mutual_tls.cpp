@@ -176,6 +176,45 @@ TEST(MutualTLS, MissingCert)
     ASSERT_THAT(session, IsNull());
 }
 
+TEST(MutualTLS, ReconnectSharesSession)
+{
+    OSSLX509 x509;
+    x509.setSubjectName();
+    X509_EXTENSION* ex = X509V3_EXT_conf_nid(nullptr, nullptr,
+                                             NID_ext_key_usage, "clientAuth");
+    ASSERT_THAT(ex, NotNull());
+    ASSERT_EQ(X509_add_ext(x509.get(), ex, -1), 1);
+    X509_EXTENSION_free(ex);
+    x509.sign();
+
+    OSSLX509StoreCTX x509Store;
+    X509_STORE_CTX_set_current_cert(x509Store.get(), x509.get());
+
+    boost::asio::ip::address ip;
+    boost::asio::ssl::verify_context ctx(x509Store.get());
+    std::shared_ptr<persistent_data::UserSession> first =
+        verifyMtlsUser(ip, ctx);
+    ASSERT_THAT(first, NotNull());
+    std::shared_ptr<persistent_data::UserSession> second =
+        verifyMtlsUser(ip, ctx);
+    EXPECT_EQ(first, second);
+
+    persistent_data::SessionStore& store =
+        persistent_data::SessionStore::getInstance();
+    releaseMtlsSession(first);
+    EXPECT_EQ(store.getSessionByUid(first->uniqueId), first);
+    releaseMtlsSession(second);
+    EXPECT_THAT(store.getSessionByUid(first->uniqueId), IsNull());
+
+    // Once every connection is gone a new session is made for the same user
+    std::shared_ptr<persistent_data::UserSession> third =
+        verifyMtlsUser(ip, ctx);
+    ASSERT_THAT(third, NotNull());
+    EXPECT_NE(third, first);
+    EXPECT_EQ(third->username, "user");
+    releaseMtlsSession(third);
+}
+
 TEST(GetCommonNameFromCert, EmptyCommonName)
 {
     OSSLX509 x509;
@@ -115,6 +115,129 @@ TEST(ServerSentEvent, SseWorks)
         }
     }
 }
+
+TEST(ServerSentEvent, FormatSseEvent)
+{
+    SseEvent event = formatSseEvent("1", "line1\nline2");
+    ASSERT_NE(event, nullptr);
+    EXPECT_EQ(*event, "id: 1\ndata: line1\ndata: line2\n\n");
+
+    event = formatSseEvent("", "noid");
+    ASSERT_NE(event, nullptr);
+    EXPECT_EQ(*event, "data: noid\n\n");
+}
+
+TEST(ServerSentEvent, SlowConsumerDropsOldest)
+{
+    boost::asio::io_context io;
+    TestStream stream(io);
+    TestStream out(io);
+    stream.connect(out);
+
+    Request req;
+
+    bool openCalled = false;
+    auto openHandler =
+        [&openCalled](Connection&, const Request& /*handedReq*/) {
+            openCalled = true;
+        };
+    bool closeCalled = false;
+    auto closeHandler = [&closeCalled](Connection&) { closeCalled = true; };
+
+    BufferPolicy policy;
+    policy.maxQueuedBytes = 64;
+    policy.onOverflow = SlowConsumerPolicy::DropOldest;
+
+    std::shared_ptr<ConnectionImpl<TestStream>> conn =
+        std::make_shared<ConnectionImpl<TestStream>>(
+            std::move(stream), openHandler, closeHandler, policy);
+    conn->start(req);
+
+    constexpr std::string_view header = "HTTP/1.1 200 OK\r\n"
+                                        "Content-Type: text/event-stream\r\n"
+                                        "\r\n";
+    while (out.str().size() != header.size() || !openCalled)
+    {
+        io.run_for(std::chrono::milliseconds(1));
+    }
+    std::string headerContent;
+    headerContent.resize(header.size());
+    boost::asio::read(out, boost::asio::buffer(headerContent));
+    EXPECT_EQ(headerContent, header);
+
+    // Each frame is 24 bytes.  The first one goes straight into the write in
+    // flight, the ones that follow have to share the remaining budget.
+    SseEvent first = formatSseEvent("1", "aaaaaaaaaa");
+    conn->sendSseEvent(first);
+    conn->sendSseEvent("2", "aaaaaaaaaa");
+    conn->sendSseEvent("3", "aaaaaaaaaa");
+    conn->sendSseEvent("4", "aaaaaaaaaa");
+
+    ConnectionStats stats = conn->getStats();
+    EXPECT_EQ(stats.queuedMessages, 2U);
+    EXPECT_EQ(stats.queuedBytes, 48U);
+    EXPECT_EQ(stats.droppedMessages, 2U);
+
+    constexpr std::string_view expected = "id: 1\ndata: aaaaaaaaaa\n\n"
+                                          "id: 4\ndata: aaaaaaaaaa\n\n";
+    while (out.str().size() < expected.size())
+    {
+        io.run_for(std::chrono::milliseconds(1));
+    }
+    std::string eventContent;
+    eventContent.resize(expected.size());
+    boost::asio::read(out, boost::asio::buffer(eventContent));
+    EXPECT_EQ(eventContent, expected);
+
+    stats = conn->getStats();
+    EXPECT_EQ(stats.queuedMessages, 0U);
+    EXPECT_EQ(stats.sentMessages, 2U);
+    EXPECT_EQ(stats.sentBytes, expected.size());
+    EXPECT_FALSE(closeCalled);
+
+    out.close();
+    while (!closeCalled)
+    {
+        io.run_for(std::chrono::milliseconds(1));
+    }
+}
+
+TEST(ServerSentEvent, SlowConsumerCloses)
+{
+    boost::asio::io_context io;
+    TestStream stream(io);
+    TestStream out(io);
+    stream.connect(out);
+
+    Request req;
+
+    bool openCalled = false;
+    auto openHandler =
+        [&openCalled](Connection&, const Request& /*handedReq*/) {
+            openCalled = true;
+        };
+    bool closeCalled = false;
+    auto closeHandler = [&closeCalled](Connection&) { closeCalled = true; };
+
+    BufferPolicy policy;
+    policy.maxQueuedBytes = 64;
+    policy.onOverflow = SlowConsumerPolicy::Close;
+
+    std::shared_ptr<ConnectionImpl<TestStream>> conn =
+        std::make_shared<ConnectionImpl<TestStream>>(
+            std::move(stream), openHandler, closeHandler, policy);
+    conn->start(req);
+    while (!openCalled)
+    {
+        io.run_for(std::chrono::milliseconds(1));
+    }
+
+    conn->sendSseEvent("1", "aaaaaaaaaa");
+    conn->sendSseEvent("2", "aaaaaaaaaa");
+    EXPECT_FALSE(closeCalled);
+    conn->sendSseEvent("3", "aaaaaaaaaa");
+    EXPECT_TRUE(closeCalled);
+}
 } // namespace
 
 } // namespace sse_socket
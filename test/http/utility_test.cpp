@@ -107,6 +107,34 @@ TEST(Utility, Base64EncodeDecodeString)
     EXPECT_EQ(data, decoded);
 }
 
+TEST(Utility, Base64EncodeDecodeAllBytes)
+{
+    std::string data;
+    for (size_t repeat = 0; repeat < 3; repeat++)
+    {
+        for (int value = 0; value < 256; value++)
+        {
+            data += static_cast<char>(value);
+        }
+    }
+    std::string encoded = base64encode(data);
+    EXPECT_EQ(encoded.size(), Base64Encoder::encodedSize(data.size()));
+    EXPECT_TRUE(encoded.starts_with("AAECAwQFBgcICQoLDA0ODxAREhMUFRYX"));
+    std::string decoded;
+    EXPECT_TRUE(base64Decode(encoded, decoded));
+    EXPECT_EQ(data, decoded);
+}
+
+TEST(Utility, Base64DecodeInvalidInMiddle)
+{
+    std::string result;
+    EXPECT_FALSE(base64Decode("dXNlcm40b*U6cGFzc3cwcmQ=", result));
+    EXPECT_FALSE(base64Decode<true>("dXNlcm40b+U6cGFzc3cwcmQ", result));
+    // Padding ends the input, as it always has
+    EXPECT_TRUE(base64Decode("dXNlcm4=bWU6", result));
+    EXPECT_EQ(result, "usern");
+}
+
 TEST(Utility, readUrlSegments)
 {
     boost::system::result<boost::urls::url_view> parsed =
@@ -0,0 +1,203 @@
+// SPDX-License-Identifier: Apache-2.0
+// SPDX-FileCopyrightText: Copyright OpenBMC Authors
+#include "http/websocket.hpp"
+#include "http/websocket_impl.hpp"
+#include "http_request.hpp"
+#include "test_stream.hpp"
+
+#include <boost/asio/buffer.hpp>
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/read.hpp>
+#include <boost/beast/http/field.hpp>
+#include <boost/beast/http/verb.hpp>
+#include <boost/url/url_view.hpp>
+
+#include <chrono>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "gtest/gtest.h"
+namespace crow
+{
+namespace websocket
+{
+
+namespace
+{
+
+// Completes the upgrade and discards the handshake response, so only
+// websocket frames are left to read from out
+std::shared_ptr<ConnectionImpl<TestStream>> openConnection(
+    boost::asio::io_context& io, TestStream& out)
+{
+    TestStream stream(io);
+    stream.connect(out);
+
+    Request req;
+    req.req.method(boost::beast::http::verb::get);
+    req.req.target("/websocket");
+    req.addHeader(boost::beast::http::field::host, "localhost");
+    req.addHeader(boost::beast::http::field::upgrade, "websocket");
+    req.addHeader(boost::beast::http::field::connection, "upgrade");
+    req.addHeader(boost::beast::http::field::sec_websocket_key,
+                  "dGhlIHNhbXBsZSBub25jZQ==");
+    req.addHeader(boost::beast::http::field::sec_websocket_version, "13");
+
+    bool openCalled = false;
+    std::shared_ptr<ConnectionImpl<TestStream>> conn =
+        std::make_shared<ConnectionImpl<TestStream>>(
+            boost::urls::url_view("/websocket"), nullptr, std::move(stream),
+            [&openCalled](Connection&) { openCalled = true; }, nullptr,
+            nullptr, nullptr, nullptr);
+    conn->start(req);
+    while (!openCalled)
+    {
+        io.run_for(std::chrono::milliseconds(1));
+    }
+    std::string response;
+    response.resize(out.str().size());
+    boost::asio::read(out, boost::asio::buffer(response));
+    EXPECT_TRUE(response.starts_with("HTTP/1.1 101"));
+    return conn;
+}
+
+// An unmasked server frame with a payload of under 126 bytes
+std::string frame(unsigned char opcode, std::string_view payload)
+{
+    std::string out;
+    out += static_cast<char>(0x80 | opcode);
+    out += static_cast<char>(payload.size());
+    out += payload;
+    return out;
+}
+
+std::string readFrames(boost::asio::io_context& io, TestStream& out,
+                       size_t size)
+{
+    while (out.str().size() < size)
+    {
+        io.run_for(std::chrono::milliseconds(1));
+    }
+    std::string content;
+    content.resize(size);
+    boost::asio::read(out, boost::asio::buffer(content));
+    return content;
+}
+
+TEST(Websocket, SlowConsumerDropsOldest)
+{
+    boost::asio::io_context io;
+    TestStream out(io);
+    std::shared_ptr<ConnectionImpl<TestStream>> conn = openConnection(io, out);
+
+    WriteBufferPolicy policy;
+    policy.maxQueuedBytes = 64;
+    policy.highWaterBytes = 64;
+    policy.onOverflow = SlowConsumerPolicy::DropOldest;
+    conn->setWriteBufferPolicy(policy);
+
+    // The first message goes straight into the write in flight, so it is
+    // never the one dropped even though it is the oldest.  It is shorter than
+    // the others so the bytes left queued show which messages were kept.
+    std::string first(20, '1');
+    std::string fourth(30, '4');
+    conn->sendText(first);
+    conn->sendText(std::string(30, '2'));
+    conn->sendText(std::string(30, '3'));
+    conn->sendText(fourth);
+
+    ConnectionStats stats = conn->getStats();
+    EXPECT_EQ(stats.queuedMessages, 2U);
+    EXPECT_EQ(stats.queuedBytes, 50U);
+    EXPECT_EQ(stats.droppedMessages, 2U);
+
+    std::string expected = frame(0x1, first) + frame(0x1, fourth);
+    EXPECT_EQ(readFrames(io, out, expected.size()), expected);
+
+    stats = conn->getStats();
+    EXPECT_EQ(stats.queuedMessages, 0U);
+    EXPECT_EQ(stats.sentMessages, 2U);
+    EXPECT_EQ(stats.droppedMessages, 2U);
+}
+
+TEST(Websocket, SlowConsumerCloses)
+{
+    boost::asio::io_context io;
+    TestStream out(io);
+    std::shared_ptr<ConnectionImpl<TestStream>> conn = openConnection(io, out);
+
+    WriteBufferPolicy policy;
+    policy.maxQueuedBytes = 64;
+    policy.highWaterBytes = 64;
+    policy.onOverflow = SlowConsumerPolicy::Close;
+    conn->setWriteBufferPolicy(policy);
+
+    std::string first(30, 'a');
+    conn->sendBinary(first);
+    conn->sendBinary(std::string(30, 'b'));
+    EXPECT_EQ(conn->getStats().droppedMessages, 0U);
+    conn->sendBinary(std::string(30, 'c'));
+
+    // Only the message being written survives the overflow
+    ConnectionStats stats = conn->getStats();
+    EXPECT_EQ(stats.queuedMessages, 1U);
+    EXPECT_EQ(stats.queuedBytes, 30U);
+    EXPECT_EQ(stats.droppedMessages, 2U);
+
+    // Nothing more is queued once the connection is closing
+    conn->sendBinary("d");
+    EXPECT_EQ(conn->getStats().queuedMessages, 1U);
+
+    std::string reason = "Write buffer overflow";
+    std::string expected =
+        frame(0x2, first) + frame(0x8, "\x03\xe8" + reason);
+    EXPECT_EQ(readFrames(io, out, expected.size()), expected);
+    EXPECT_EQ(conn->getStats().sentMessages, 1U);
+}
+
+TEST(Websocket, BackpressureHasHysteresis)
+{
+    boost::asio::io_context io;
+    TestStream out(io);
+    std::shared_ptr<ConnectionImpl<TestStream>> conn = openConnection(io, out);
+
+    WriteBufferPolicy policy;
+    policy.maxQueuedBytes = 1000;
+    policy.highWaterBytes = 100;
+    conn->setWriteBufferPolicy(policy);
+    std::vector<bool> signals;
+    conn->setBackpressureHandler(
+        [&signals](bool congested) { signals.push_back(congested); });
+
+    std::string message(30, 'x');
+    for (size_t i = 0; i < 3; i++)
+    {
+        conn->sendText(message);
+    }
+    // 90 bytes queued is still under the high-water mark
+    EXPECT_TRUE(signals.empty());
+    conn->sendText(message);
+    EXPECT_EQ(signals, std::vector<bool>{true});
+    EXPECT_EQ(conn->getStats().backpressureEvents, 1U);
+
+    // Released at half the high-water mark, not as soon as the queue drops
+    // back under it
+    for (size_t sent = 1; sent <= 4; sent++)
+    {
+        while (conn->getStats().sentMessages < sent)
+        {
+            io.poll_one();
+        }
+        size_t queued = conn->getStats().queuedBytes;
+        EXPECT_EQ(signals.size(), queued > 50 ? 1U : 2U) << queued;
+    }
+    EXPECT_EQ(signals, (std::vector<bool>{true, false}));
+    EXPECT_EQ(conn->getStats().backpressureEvents, 1U);
+}
+} // namespace
+
+} // namespace websocket
+} // namespace crow
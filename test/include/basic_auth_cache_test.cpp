@@ -0,0 +1,88 @@
+// SPDX-License-Identifier: Apache-2.0
+// SPDX-FileCopyrightText: Copyright OpenBMC Authors
+#include "basic_auth_cache.hpp"
+
+#include <security/_pam_types.h>
+
+#include <chrono>
+#include <cstdint>
+#include <optional>
+
+#include <gtest/gtest.h>
+
+namespace bmcweb
+{
+namespace
+{
+
+TEST(BasicAuthCache, RemembersAcceptedPasswordOnly)
+{
+    BasicAuthCache cache(std::chrono::seconds(30));
+    EXPECT_EQ(cache.lookup("admin", "0penBmc"), std::nullopt);
+
+    cache.store("admin", "0penBmc", PAM_SUCCESS, cache.generation());
+    EXPECT_EQ(cache.lookup("admin", "0penBmc"), PAM_SUCCESS);
+    EXPECT_EQ(cache.lookup("admin", "0penBmc1"), std::nullopt);
+    EXPECT_EQ(cache.lookup("operator", "0penBmc"), std::nullopt);
+
+    // Failures are never cached, and they drop what was remembered
+    cache.store("admin", "wrong", PAM_AUTH_ERR, cache.generation());
+    EXPECT_EQ(cache.lookup("admin", "wrong"), std::nullopt);
+    EXPECT_EQ(cache.lookup("admin", "0penBmc"), std::nullopt);
+}
+
+TEST(BasicAuthCache, Invalidate)
+{
+    BasicAuthCache cache(std::chrono::seconds(30));
+    cache.store("admin", "0penBmc", PAM_SUCCESS, cache.generation());
+    cache.store("operator", "0penBmc", PAM_NEW_AUTHTOK_REQD,
+                cache.generation());
+    cache.invalidate("admin");
+    EXPECT_EQ(cache.lookup("admin", "0penBmc"), std::nullopt);
+    EXPECT_EQ(cache.lookup("operator", "0penBmc"), PAM_NEW_AUTHTOK_REQD);
+}
+
+TEST(BasicAuthCache, DisabledAndExpired)
+{
+    BasicAuthCache disabled(std::chrono::seconds(0));
+    disabled.store("admin", "0penBmc", PAM_SUCCESS, disabled.generation());
+    EXPECT_EQ(disabled.size(), 0);
+    EXPECT_EQ(disabled.lookup("admin", "0penBmc"), std::nullopt);
+
+    BasicAuthCache cache(std::chrono::seconds(1));
+    std::chrono::steady_clock::time_point start =
+        std::chrono::steady_clock::now();
+    cache.store("admin", "0penBmc", PAM_SUCCESS, cache.generation(), start);
+    EXPECT_EQ(cache.lookup("admin", "0penBmc",
+                           start + std::chrono::milliseconds(999)),
+              PAM_SUCCESS);
+    EXPECT_EQ(cache.lookup("admin", "0penBmc", start + std::chrono::seconds(1)),
+              std::nullopt);
+    EXPECT_EQ(cache.size(), 0);
+}
+
+TEST(BasicAuthCache, DropsResultsFromBeforeUserChange)
+{
+    BasicAuthCache cache(std::chrono::seconds(30));
+    uint64_t started = cache.generation();
+    // The password changes while PAM is still checking the old one
+    cache.invalidate("admin");
+    cache.store("admin", "old", PAM_SUCCESS, started);
+    EXPECT_EQ(cache.lookup("admin", "old"), std::nullopt);
+
+    cache.store("admin", "new", PAM_SUCCESS, cache.generation());
+    EXPECT_EQ(cache.lookup("admin", "new"), PAM_SUCCESS);
+}
+
+TEST(BasicAuthCache, Bounded)
+{
+    BasicAuthCache cache(std::chrono::seconds(30), 2);
+    cache.store("a", "pass", PAM_SUCCESS, cache.generation());
+    cache.store("b", "pass", PAM_SUCCESS, cache.generation());
+    cache.store("c", "pass", PAM_SUCCESS, cache.generation());
+    EXPECT_EQ(cache.size(), 2);
+    EXPECT_EQ(cache.lookup("c", "pass"), PAM_SUCCESS);
+}
+
+} // namespace
+} // namespace bmcweb
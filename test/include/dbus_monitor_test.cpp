@@ -0,0 +1,109 @@
+// SPDX-License-Identifier: Apache-2.0
+// SPDX-FileCopyrightText: Copyright OpenBMC Authors
+#include "dbus_monitor.hpp"
+#include "websocket.hpp"
+
+#include <boost/url/url_view.hpp>
+#include <nlohmann/json.hpp>
+
+#include <functional>
+#include <string>
+#include <string_view>
+
+#include <gtest/gtest.h>
+
+namespace crow
+{
+namespace dbus_monitor
+{
+namespace
+{
+
+// Subscriptions only track connections by address
+struct FakeConnection : websocket::Connection
+{
+    void sendBinary(std::string_view /*msg*/) override {}
+    void sendEx(websocket::MessageType /*type*/, std::string_view /*msg*/,
+                std::function<void()>&& /*onDone*/) override
+    {}
+    void sendText(std::string_view /*msg*/) override {}
+    void close(std::string_view /*msg*/) override {}
+    void deferRead() override {}
+    void resumeRead() override {}
+    void setBackpressureHandler(
+        std::function<void(bool)>&& /*handler*/) override
+    {}
+    void setWriteBufferPolicy(
+        const websocket::WriteBufferPolicy& /*policy*/) override
+    {}
+    websocket::ConnectionStats getStats() const override
+    {
+        return {};
+    }
+    boost::urls::url_view url() override
+    {
+        return {};
+    }
+};
+
+nlohmann::json::object_t propertiesChanged(std::string_view path,
+                                           std::string_view interface,
+                                           nlohmann::json properties)
+{
+    nlohmann::json::object_t update;
+    update["event"] = "PropertiesChanged";
+    update["path"] = path;
+    update["interface"] = interface;
+    update["properties"] = std::move(properties);
+    return update;
+}
+
+TEST(DbusMonitor, PendingUpdatesKeepLatestValue)
+{
+    SharedMatch shared;
+    addPendingUpdate(shared, propertiesChanged("/xyz/sensor", "a.Value",
+                                               {{"Value", 1}, {"Unit", "C"}}));
+    addPendingUpdate(shared, propertiesChanged("/xyz/sensor", "a.Value",
+                                               {{"Value", 2}}));
+    addPendingUpdate(shared, propertiesChanged("/xyz/sensor", "a.Threshold",
+                                               {{"Value", 3}}));
+    addPendingUpdate(shared, propertiesChanged("/xyz/other", "a.Value",
+                                               {{"Value", 4}}));
+
+    // One update per path and interface, each property at its latest value
+    ASSERT_EQ(shared.pending.size(), 3U);
+    EXPECT_EQ(shared.pending[0]["properties"],
+              nlohmann::json({{"Value", 2}, {"Unit", "C"}}));
+    EXPECT_EQ(shared.pending[1]["interface"], "a.Threshold");
+    EXPECT_EQ(shared.pending[1]["properties"], nlohmann::json({{"Value", 3}}));
+    EXPECT_EQ(shared.pending[2]["path"], "/xyz/other");
+    EXPECT_EQ(shared.pending[2]["properties"], nlohmann::json({{"Value", 4}}));
+}
+
+TEST(DbusMonitor, MatchRemovedWithLastSubscriber)
+{
+    const std::string rule = "type='signal',path_namespace='/xyz'";
+    FakeConnection first;
+    FakeConnection second;
+    DbusWebsocketSession firstSession;
+    DbusWebsocketSession secondSession;
+
+    // Only the first subscriber needs the match registered with D-Bus
+    EXPECT_NE(addSubscriber(first, firstSession, rule), nullptr);
+    EXPECT_EQ(addSubscriber(second, secondSession, rule), nullptr);
+    // Subscribing twice to the same rule is a no-op
+    EXPECT_EQ(addSubscriber(first, firstSession, rule), nullptr);
+    ASSERT_TRUE(matches.contains(rule));
+    EXPECT_EQ(matches.find(rule)->second.subscribers.size(), 2U);
+
+    unsubscribe(first, firstSession);
+    ASSERT_TRUE(matches.contains(rule));
+    EXPECT_EQ(matches.find(rule)->second.subscribers.size(), 1U);
+
+    unsubscribe(second, secondSession);
+    EXPECT_FALSE(matches.contains(rule));
+}
+
+} // namespace
+} // namespace dbus_monitor
+} // namespace crow
@@ -0,0 +1,161 @@
+// SPDX-License-Identifier: Apache-2.0
+// SPDX-FileCopyrightText: Copyright OpenBMC Authors
+#include "io_context_singleton.hpp"
+#include "kvm_websocket.hpp"
+#include "websocket.hpp"
+
+#include <boost/asio/buffer.hpp>
+#include <boost/asio/ip/address.hpp>
+#include <boost/asio/ip/tcp.hpp>
+#include <boost/asio/write.hpp>
+#include <boost/url/url_view.hpp>
+
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace crow
+{
+namespace obmc_kvm
+{
+namespace
+{
+
+TEST(KvmFramePool, ExhaustedReturnsNull)
+{
+    KvmFramePool pool(2);
+    std::shared_ptr<KvmFramePool::FrameBuffer> first = pool.acquire();
+    std::shared_ptr<KvmFramePool::FrameBuffer> second = pool.acquire();
+    ASSERT_NE(first, nullptr);
+    ASSERT_NE(second, nullptr);
+    EXPECT_NE(first.get(), second.get());
+    EXPECT_EQ(pool.acquire(), nullptr);
+    EXPECT_EQ(pool.allocated(), 2U);
+}
+
+TEST(KvmFramePool, ReleasedBufferIsReused)
+{
+    KvmFramePool pool(1);
+    std::shared_ptr<KvmFramePool::FrameBuffer> lease = pool.acquire();
+    ASSERT_NE(lease, nullptr);
+    KvmFramePool::FrameBuffer* buffer = lease.get();
+    lease->commit(1);
+    lease.reset();
+
+    // The same memory comes back, emptied, without growing the pool
+    lease = pool.acquire();
+    EXPECT_EQ(lease.get(), buffer);
+    EXPECT_EQ(lease->size(), 0U);
+    EXPECT_EQ(pool.allocated(), 1U);
+}
+
+TEST(KvmFramePool, DroppedSendHandlerWakesWaiter)
+{
+    KvmFramePool pool(1);
+    std::shared_ptr<KvmFramePool::FrameBuffer> lease = pool.acquire();
+    ASSERT_NE(lease, nullptr);
+
+    bool woken = false;
+    pool.whenReleased([&woken]() { woken = true; });
+
+    // A websocket that goes away destroys its pending write handlers
+    // without calling them, which must still return the buffer
+    std::function<void()> sendHandler = [buffer(std::move(lease))]() {};
+    EXPECT_EQ(pool.acquire(), nullptr);
+    sendHandler = nullptr;
+
+    getIoContext().restart();
+    getIoContext().poll();
+    EXPECT_TRUE(woken);
+    EXPECT_NE(pool.acquire(), nullptr);
+}
+
+// Keeps each frame as a view of the pool buffer it was sent from, and holds
+// on to the write handlers so a test decides when each write completes
+struct FakeConnection : websocket::Connection
+{
+    std::vector<std::string_view> frames;
+    std::vector<std::function<void()>> onDone;
+
+    void sendBinary(std::string_view /*msg*/) override {}
+    void sendEx(websocket::MessageType /*type*/, std::string_view msg,
+                std::function<void()>&& onDoneIn) override
+    {
+        frames.emplace_back(msg);
+        onDone.emplace_back(std::move(onDoneIn));
+    }
+    void sendText(std::string_view /*msg*/) override {}
+    void close(std::string_view /*msg*/) override {}
+    void deferRead() override {}
+    void resumeRead() override {}
+    void setBackpressureHandler(
+        std::function<void(bool)>&& /*handler*/) override
+    {}
+    void setWriteBufferPolicy(
+        const websocket::WriteBufferPolicy& /*policy*/) override
+    {}
+    websocket::ConnectionStats getStats() const override
+    {
+        return {};
+    }
+    boost::urls::url_view url() override
+    {
+        return {};
+    }
+};
+
+TEST(KvmSession, ReadsIntoNextBufferWhileSending)
+{
+    boost::asio::io_context& io = getIoContext();
+    io.restart();
+    boost::asio::ip::tcp::acceptor acceptor(
+        io, {boost::asio::ip::make_address("127.0.0.1"), 0});
+    boost::asio::ip::tcp::socket client(io);
+    client.connect(acceptor.local_endpoint());
+    boost::asio::ip::tcp::socket server = acceptor.accept();
+
+    FakeConnection conn;
+    auto session = std::make_shared<KvmSession>(conn, std::move(client));
+    session->start();
+
+    boost::asio::write(server, boost::asio::buffer(std::string_view("first")));
+    while (conn.frames.empty())
+    {
+        io.run_for(std::chrono::milliseconds(1));
+    }
+    EXPECT_EQ(conn.frames[0], "first");
+
+    // Video that arrives while the first frame is being written goes into
+    // another buffer, and is coalesced into a single frame
+    boost::asio::write(server, boost::asio::buffer(std::string_view("ab")));
+    while (session->getStats().socketReads < 2)
+    {
+        io.run_for(std::chrono::milliseconds(1));
+    }
+    boost::asio::write(server, boost::asio::buffer(std::string_view("cd")));
+    while (session->getStats().socketReads < 3)
+    {
+        io.run_for(std::chrono::milliseconds(1));
+    }
+    EXPECT_EQ(conn.frames[0], "first");
+    EXPECT_EQ(conn.frames.size(), 1U);
+
+    conn.onDone[0]();
+    ASSERT_EQ(conn.frames.size(), 2U);
+    EXPECT_EQ(conn.frames[1], "abcd");
+
+    const KvmStats& stats = session->getStats();
+    EXPECT_EQ(stats.framesSent, 2U);
+    EXPECT_EQ(stats.bytesSent, 9U);
+    EXPECT_EQ(stats.socketReads, 3U);
+}
+
+} // namespace
+} // namespace obmc_kvm
+} // namespace crow
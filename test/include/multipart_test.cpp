@@ -5,7 +5,12 @@
 
 #include <boost/beast/http/fields.hpp>
 
+#include <unistd.h>
+
+#include <array>
+#include <cstddef>
 #include <iterator>
+#include <string>
 #include <string_view>
 #include <system_error>
 #include <vector>
@@ -449,4 +454,89 @@ TEST_F(MultipartTest, TestFinalBoundaryIsCorrectlyRecognized)
               "StillData1");
 }
 
+TEST_F(MultipartTest, TestParsesAnyChunking)
+{
+    std::string_view body =
+        "----XX\r\n"
+        "Content-Disposition: form-data; name=\"Test1\"\r\n\r\n"
+        "Data1\r\n"
+        "----XX-abc-\r\n"
+        "StillData1\r\n"
+        "----XX\r\n"
+        "Content-Disposition: form-data; name=\"Test2\"\r\n\r\n"
+        "Data2\r\n"
+        "----XX--\r\n";
+
+    for (size_t chunkSize = 1; chunkSize <= body.size(); chunkSize++)
+    {
+        MultipartParser chunked;
+        ASSERT_EQ(chunked.begin("multipart/form-data; boundary=--XX"),
+                  ParserError::PARSER_SUCCESS);
+        for (size_t offset = 0; offset < body.size(); offset += chunkSize)
+        {
+            chunked.feed(body.substr(offset, chunkSize));
+        }
+        ASSERT_EQ(chunked.finish(), ParserError::PARSER_SUCCESS) << chunkSize;
+        ASSERT_EQ(chunked.mime_fields.size(), 2) << chunkSize;
+        EXPECT_EQ(chunked.mime_fields[0].fields.at("Content-Disposition"),
+                  "form-data; name=\"Test1\"");
+        EXPECT_EQ(chunked.mime_fields[0].content,
+                  "Data1\r\n----XX-abc-\r\nStillData1")
+            << chunkSize;
+        EXPECT_EQ(chunked.mime_fields[1].content, "Data2") << chunkSize;
+    }
+}
+
+TEST_F(MultipartTest, TestSpooledPart)
+{
+    std::string_view body =
+        "----XX\r\n"
+        "Content-Disposition: form-data; name=\"UpdateParameters\"\r\n\r\n"
+        "{}\r\n"
+        "----XX\r\n"
+        "Content-Disposition: form-data; name=\"UpdateFile\"\r\n\r\n"
+        "image\r\ndata\r\n"
+        "----XX--\r\n";
+
+    ASSERT_EQ(parser.begin("multipart/form-data; boundary=--XX"),
+              ParserError::PARSER_SUCCESS);
+    parser.spoolPart("UpdateFile");
+    parser.limitPartSize(2);
+    parser.feed(body.substr(0, 100));
+    parser.feed(body.substr(100));
+    ASSERT_EQ(parser.finish(), ParserError::PARSER_SUCCESS);
+    ASSERT_EQ(parser.mime_fields.size(), 2);
+
+    EXPECT_EQ(MultipartParser::partName(parser.mime_fields[0]),
+              "UpdateParameters");
+    EXPECT_EQ(parser.mime_fields[0].content, "{}");
+    EXPECT_FALSE(parser.mime_fields[0].file.is_open());
+
+    const FormPart& file = parser.mime_fields[1];
+    EXPECT_EQ(MultipartParser::partName(file), "UpdateFile");
+    EXPECT_TRUE(file.content.empty());
+    ASSERT_TRUE(file.file.is_open());
+    std::array<char, 32> buffer{};
+    ssize_t read =
+        pread(file.file.native_handle(), buffer.data(), buffer.size(), 0);
+    ASSERT_GT(read, 0);
+    EXPECT_EQ(std::string_view(buffer.data(), static_cast<size_t>(read)),
+              "image\r\ndata");
+}
+
+TEST_F(MultipartTest, TestPartTooLarge)
+{
+    std::string_view body =
+        "----XX\r\n"
+        "Content-Disposition: form-data; name=\"Test1\"\r\n\r\n"
+        "Data1\r\n"
+        "----XX--\r\n";
+
+    ASSERT_EQ(parser.begin("multipart/form-data; boundary=--XX"),
+              ParserError::PARSER_SUCCESS);
+    parser.limitPartSize(4);
+    EXPECT_EQ(parser.feed(body), ParserError::ERROR_OUT_OF_RANGE);
+    EXPECT_EQ(parser.finish(), ParserError::ERROR_OUT_OF_RANGE);
+}
+
 } // namespace
@@ -0,0 +1,91 @@
+// SPDX-License-Identifier: Apache-2.0
+// SPDX-FileCopyrightText: Copyright OpenBMC Authors
+#include "nbd_send_ring.hpp"
+
+#include <boost/asio/buffer.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+
+#include <gtest/gtest.h>
+
+namespace crow
+{
+namespace
+{
+
+void fill(NbdSendRing& ring, std::string_view data)
+{
+    ASSERT_TRUE(ring.canRead());
+    size_t copied =
+        boost::asio::buffer_copy(ring.prepareRead(), boost::asio::buffer(data));
+    // Only one read may be outstanding
+    EXPECT_FALSE(ring.canRead());
+    ring.commitRead(copied);
+}
+
+TEST(NbdSendRing, StopsReadingWhenFull)
+{
+    // The slots are too large for the stack
+    auto ring = std::make_unique<NbdSendRing>();
+    for (size_t i = 0; i < NbdSendRing::slots; i++)
+    {
+        fill(*ring, std::to_string(i));
+    }
+    EXPECT_FALSE(ring->canRead());
+
+    std::optional<std::string_view> payload = ring->startSend();
+    ASSERT_TRUE(payload);
+    EXPECT_EQ(*payload, "0");
+    // The slot being sent is not free until the send finishes
+    EXPECT_FALSE(ring->canRead());
+    ring->finishSend();
+    EXPECT_TRUE(ring->canRead());
+}
+
+TEST(NbdSendRing, OneSendInFlight)
+{
+    auto ring = std::make_unique<NbdSendRing>();
+    EXPECT_EQ(ring->startSend(), std::nullopt);
+
+    fill(*ring, "first");
+    fill(*ring, "second");
+    std::optional<std::string_view> payload = ring->startSend();
+    ASSERT_TRUE(payload);
+    EXPECT_EQ(*payload, "first");
+    EXPECT_EQ(ring->startSend(), std::nullopt);
+
+    ring->finishSend();
+    payload = ring->startSend();
+    ASSERT_TRUE(payload);
+    EXPECT_EQ(*payload, "second");
+    ring->finishSend();
+    EXPECT_EQ(ring->startSend(), std::nullopt);
+}
+
+TEST(NbdSendRing, WrapsAround)
+{
+    auto ring = std::make_unique<NbdSendRing>();
+    // Reads and sends interleaved, so both positions go round the ring
+    // several times and every slot is reused after it was cleared
+    fill(*ring, "0");
+    for (size_t i = 1; i < 3 * NbdSendRing::slots; i++)
+    {
+        fill(*ring, std::to_string(i));
+        std::optional<std::string_view> payload = ring->startSend();
+        ASSERT_TRUE(payload);
+        EXPECT_EQ(*payload, std::to_string(i - 1));
+        ring->finishSend();
+    }
+    std::optional<std::string_view> payload = ring->startSend();
+    ASSERT_TRUE(payload);
+    EXPECT_EQ(*payload, std::to_string((3 * NbdSendRing::slots) - 1));
+    ring->finishSend();
+    EXPECT_EQ(ring->startSend(), std::nullopt);
+}
+
+} // namespace
+} // namespace crow
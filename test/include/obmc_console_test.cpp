@@ -0,0 +1,160 @@
+// SPDX-License-Identifier: Apache-2.0
+// SPDX-FileCopyrightText: Copyright OpenBMC Authors
+#include "obmc_console.hpp"
+#include "websocket.hpp"
+
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <boost/asio/io_context.hpp>
+#include <boost/url/url_view.hpp>
+
+#include <array>
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace crow
+{
+namespace obmc_console
+{
+namespace
+{
+
+// Records what the console sends and holds on to the write handlers, so a
+// test decides when each write completes
+struct FakeConnection : websocket::Connection
+{
+    std::vector<std::string> sent;
+    std::vector<std::function<void()>> onDone;
+    std::vector<std::string> closedWith;
+    bool reading = false;
+
+    void sendBinary(std::string_view msg) override
+    {
+        sent.emplace_back(msg);
+    }
+    void sendEx(websocket::MessageType /*type*/, std::string_view msg,
+                std::function<void()>&& onDoneIn) override
+    {
+        sent.emplace_back(msg);
+        onDone.emplace_back(std::move(onDoneIn));
+    }
+    void sendText(std::string_view msg) override
+    {
+        sent.emplace_back(msg);
+    }
+    void close(std::string_view msg) override
+    {
+        closedWith.emplace_back(msg);
+    }
+    void deferRead() override
+    {
+        reading = false;
+    }
+    void resumeRead() override
+    {
+        reading = true;
+    }
+    void setBackpressureHandler(
+        std::function<void(bool)>&& /*handler*/) override
+    {}
+    void setWriteBufferPolicy(
+        const websocket::WriteBufferPolicy& /*policy*/) override
+    {}
+    websocket::ConnectionStats getStats() const override
+    {
+        return {};
+    }
+    boost::urls::url_view url() override
+    {
+        return {};
+    }
+};
+
+TEST(ConsoleHandler, BacklogTrimmedToLimit)
+{
+    FakeConnection conn;
+    auto viewer = std::make_shared<ConsoleHandler>(conn);
+
+    viewer->queue("first");
+    ASSERT_EQ(conn.sent.size(), 1U);
+    EXPECT_EQ(conn.sent[0], "first");
+
+    // Nothing more is sent while the first write is in flight, and the
+    // oldest output is dropped once the backlog passes the limit
+    viewer->queue(std::string(viewerBacklogLimit, 'x'));
+    viewer->queue("tail");
+    EXPECT_EQ(conn.sent.size(), 1U);
+
+    conn.onDone[0]();
+    ASSERT_EQ(conn.sent.size(), 2U);
+    EXPECT_EQ(conn.sent[1], std::string(viewerBacklogLimit - 4, 'x') + "tail");
+}
+
+TEST(ConsoleUpstream, ScrollbackSentOnAttach)
+{
+    boost::asio::io_context io;
+    std::array<int, 2> fds{};
+    ASSERT_EQ(socketpair(AF_UNIX, SOCK_STREAM, 0, fds.data()), 0);
+
+    auto upstream = std::make_shared<ConsoleUpstream>(io, "/console/test");
+    FakeConnection early;
+    auto earlyViewer = std::make_shared<ConsoleHandler>(early);
+    upstream->attach(earlyViewer);
+    // Viewers don't read from the websocket until the console is connected
+    EXPECT_FALSE(early.reading);
+    ASSERT_TRUE(upstream->connect(fds[0]));
+    EXPECT_TRUE(early.reading);
+
+    std::string_view output = "login: ";
+    ASSERT_EQ(write(fds[1], output.data(), output.size()),
+              static_cast<ssize_t>(output.size()));
+    while (early.sent.empty())
+    {
+        io.run_for(std::chrono::milliseconds(1));
+    }
+    EXPECT_EQ(early.sent[0], output);
+
+    FakeConnection late;
+    auto lateViewer = std::make_shared<ConsoleHandler>(late);
+    upstream->attach(lateViewer);
+    EXPECT_TRUE(late.reading);
+    ASSERT_EQ(late.sent.size(), 1U);
+    EXPECT_EQ(late.sent[0], output);
+
+    close(fds[1]);
+}
+
+TEST(ConsoleUpstream, FailClosesEveryViewer)
+{
+    boost::asio::io_context io;
+    auto upstream = std::make_shared<ConsoleUpstream>(io, "/console/gone");
+    getConsoleUpstreamMap().emplace("/console/gone", upstream);
+
+    FakeConnection first;
+    FakeConnection second;
+    auto firstViewer = std::make_shared<ConsoleHandler>(first);
+    auto secondViewer = std::make_shared<ConsoleHandler>(second);
+    upstream->attach(firstViewer);
+    upstream->attach(secondViewer);
+
+    upstream->fail("Console gone");
+    EXPECT_EQ(first.closedWith, std::vector<std::string>{"Console gone"});
+    EXPECT_EQ(second.closedWith, std::vector<std::string>{"Console gone"});
+    EXPECT_EQ(findUpstream("/console/gone"), nullptr);
+
+    // Viewers are forgotten, so a second failure closes nothing twice
+    upstream->fail("Again");
+    EXPECT_EQ(first.closedWith.size(), 1U);
+}
+
+} // namespace
+} // namespace obmc_console
+} // namespace crow
@@ -2,6 +2,9 @@
 // SPDX-FileCopyrightText: Copyright OpenBMC Authors
 #include "ossl_random.hpp"
 
+#include <set>
+#include <string>
+
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
@@ -29,4 +32,24 @@ TEST(Bmcweb, GetRandomIdOfLength)
     EXPECT_THAT(getRandomIdOfLength(0), IsEmpty());
 }
 
+TEST(Bmcweb, GetRandomIdOfLengthUsesEveryCharacter)
+{
+    // Longer than the buffered block, and long enough that every character
+    // shows up
+    std::string id = bmcweb::getRandomIdOfLength(5000);
+    EXPECT_THAT(id, MatchesRegex("^[a-zA-Z0-9]{5000}$"));
+    std::set<char> seen(id.begin(), id.end());
+    EXPECT_EQ(seen.size(), 62);
+}
+
+TEST(Bmcweb, GetRandomIdOfLengthIsUnique)
+{
+    std::set<std::string> ids;
+    for (size_t i = 0; i < 1000; i++)
+    {
+        ids.insert(bmcweb::getRandomIdOfLength(20));
+    }
+    EXPECT_EQ(ids.size(), 1000);
+}
+
 } // namespace
@@ -0,0 +1,97 @@
+// SPDX-License-Identifier: Apache-2.0
+// SPDX-FileCopyrightText: Copyright OpenBMC Authors
+#include "pam_worker_pool.hpp"
+
+#include <security/_pam_types.h>
+
+#include <boost/asio/io_context.hpp>
+
+#include <cstddef>
+#include <latch>
+#include <optional>
+#include <semaphore>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+namespace bmcweb
+{
+namespace
+{
+
+using ::testing::ElementsAre;
+using ::testing::UnorderedElementsAre;
+
+TEST(PamWorkerPool, CallbacksRunOnEventLoop)
+{
+    boost::asio::io_context io;
+    PamWorkerPool pool(io, 2, 8,
+                       [](std::string_view /*user*/, std::string_view password,
+                          const std::optional<std::string>& /*token*/) {
+                           return password == "right" ? PAM_SUCCESS
+                                                      : PAM_AUTH_ERR;
+                       });
+
+    std::thread::id loopThread = std::this_thread::get_id();
+    std::vector<int> results;
+    auto record = [&results, loopThread](int pamrc) {
+        EXPECT_EQ(std::this_thread::get_id(), loopThread);
+        results.push_back(pamrc);
+    };
+    pool.authenticate("user", "right", std::nullopt, record);
+    pool.authenticate("user", "wrong", std::nullopt, record);
+
+    // Nothing may complete inside authenticate()
+    EXPECT_TRUE(results.empty());
+    while (results.size() < 2)
+    {
+        io.run_one();
+    }
+    EXPECT_THAT(results, UnorderedElementsAre(PAM_SUCCESS, PAM_AUTH_ERR));
+    EXPECT_EQ(pool.queueDepth(), 0);
+}
+
+TEST(PamWorkerPool, RejectsWhenQueueFull)
+{
+    boost::asio::io_context io;
+    std::counting_semaphore<2> started(0);
+    std::latch release(1);
+    PamWorkerPool pool(io, 1, 1,
+                       [&started, &release](
+                           std::string_view /*user*/,
+                           std::string_view /*password*/,
+                           const std::optional<std::string>& /*token*/) {
+                           started.release();
+                           release.wait();
+                           return PAM_SUCCESS;
+                       });
+
+    std::vector<int> results;
+    auto record = [&results](int pamrc) { results.push_back(pamrc); };
+
+    // The first request occupies the only worker, the second waits in the
+    // queue and the third has nowhere to go.
+    pool.authenticate("a", "pass", std::nullopt, record);
+    started.acquire();
+    pool.authenticate("b", "pass", std::nullopt, record);
+    pool.authenticate("c", "pass", std::nullopt, record);
+    EXPECT_EQ(pool.queueDepth(), 2);
+
+    io.run_one();
+    ASSERT_THAT(results, ElementsAre(PAM_MAXTRIES));
+
+    release.count_down();
+    while (results.size() < 3)
+    {
+        io.run_one();
+    }
+    EXPECT_THAT(results, ElementsAre(PAM_MAXTRIES, PAM_SUCCESS, PAM_SUCCESS));
+    EXPECT_EQ(pool.peakQueueDepth(), 2);
+}
+
+} // namespace
+} // namespace bmcweb
@@ -0,0 +1,109 @@
+// SPDX-License-Identifier: Apache-2.0
+// SPDX-FileCopyrightText: Copyright OpenBMC Authors
+#include "file_test_utilities.hpp"
+#include "persistent_journal.hpp"
+
+#include <nlohmann/json.hpp>
+
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace persistent_data
+{
+namespace
+{
+
+std::string readFile(const std::string& path)
+{
+    std::ifstream file(path);
+    return {std::istreambuf_iterator<char>(file),
+            std::istreambuf_iterator<char>()};
+}
+
+TEST(WriteFileAtomic, ReplacesContents)
+{
+    TemporaryFileHandle file("old contents");
+    EXPECT_TRUE(writeFileAtomic(file.stringPath, "new contents"));
+    EXPECT_EQ(readFile(file.stringPath), "new contents");
+    EXPECT_FALSE(std::filesystem::exists(file.stringPath + ".tmp"));
+}
+
+TEST(PersistentJournal, AppendFlushRead)
+{
+    TemporaryFileHandle file("");
+    PersistentJournal journal(file.stringPath);
+
+    nlohmann::json::object_t entry;
+    entry["op"] = "add";
+    journal.append(entry);
+    entry["op"] = "remove";
+    journal.append(entry);
+    EXPECT_TRUE(journal.hasPending());
+    EXPECT_EQ(journal.size(), 2);
+
+    // Nothing reaches the disk until flushed
+    EXPECT_EQ(readFile(file.stringPath), "");
+    journal.flush();
+    EXPECT_FALSE(journal.hasPending());
+    EXPECT_EQ(readFile(file.stringPath),
+              "{\"op\":\"add\"}\n{\"op\":\"remove\"}\n");
+
+    PersistentJournal reopened(file.stringPath);
+    std::vector<nlohmann::json::object_t> entries = reopened.read();
+    ASSERT_EQ(entries.size(), 2);
+    EXPECT_EQ(entries[0]["op"], "add");
+    EXPECT_EQ(entries[1]["op"], "remove");
+    EXPECT_EQ(reopened.size(), 2);
+
+    reopened.clear();
+    EXPECT_EQ(reopened.size(), 0);
+    EXPECT_FALSE(std::filesystem::exists(file.stringPath));
+}
+
+TEST(PersistentJournal, IgnoresTornEntry)
+{
+    TemporaryFileHandle file("{\"op\":\"add\"}\n{\"op\":\"rem");
+    PersistentJournal journal(file.stringPath);
+    std::vector<nlohmann::json::object_t> entries = journal.read();
+    ASSERT_EQ(entries.size(), 1);
+    EXPECT_EQ(entries[0]["op"], "add");
+}
+
+TEST(PersistentJournal, AppendAfterTornEntry)
+{
+    TemporaryFileHandle file("{\"op\":\"add\"}\n{\"op\":\"rem");
+    PersistentJournal journal(file.stringPath);
+
+    nlohmann::json::object_t entry;
+    entry["op"] = "remove";
+    journal.append(entry);
+    journal.flush();
+
+    PersistentJournal reopened(file.stringPath);
+    std::vector<nlohmann::json::object_t> entries = reopened.read();
+    ASSERT_EQ(entries.size(), 2);
+    EXPECT_EQ(entries[0]["op"], "add");
+    EXPECT_EQ(entries[1]["op"], "remove");
+}
+
+TEST(WriteFileAtomic, FailureLeavesNoTemporaryFile)
+{
+    std::filesystem::path directory = std::filesystem::temp_directory_path() /
+                                      "bmcweb_write_file_atomic_test";
+    std::filesystem::create_directories(directory);
+    // Renaming a file over a non-empty directory fails
+    std::filesystem::path target = directory / "target";
+    std::filesystem::create_directories(target / "child");
+
+    EXPECT_FALSE(writeFileAtomic(target, "contents"));
+    EXPECT_FALSE(std::filesystem::exists(directory / "target.tmp"));
+    std::filesystem::remove_all(directory);
+}
+
+} // namespace
+} // namespace persistent_data
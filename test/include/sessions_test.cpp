@@ -1,11 +1,20 @@
 #include "sessions.hpp"
 
+#include <boost/asio/ip/address.hpp>
 #include <nlohmann/json.hpp>
 
+#include <chrono>
+#include <memory>
+#include <optional>
+
+#include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
 namespace
 {
+using ::testing::Contains;
+using ::testing::Not;
+
 TEST(AuthConfigMethods, FromJsonHappyPath)
 {
     persistent_data::AuthConfigMethods methods;
@@ -54,4 +63,126 @@ TEST(AuthConfigMethods, FromJsonMTLSCommonNameParseModeOutOfRange)
     EXPECT_EQ(methods.xtoken, true);
     EXPECT_EQ(methods.mTLSCommonNameParsingMode, prevValue);
 }
+
+TEST(SessionStore, InvalidateUserInfo)
+{
+    persistent_data::SessionStore& store =
+        persistent_data::SessionStore::getInstance();
+    std::shared_ptr<persistent_data::UserSession> admin =
+        store.generateUserSession("admin", boost::asio::ip::address(),
+                                  std::nullopt,
+                                  persistent_data::SessionType::Session);
+    std::shared_ptr<persistent_data::UserSession> other =
+        store.generateUserSession("operator", boost::asio::ip::address(),
+                                  std::nullopt,
+                                  persistent_data::SessionType::Session);
+    ASSERT_NE(admin, nullptr);
+    ASSERT_NE(other, nullptr);
+    EXPECT_FALSE(admin->userInfoValid);
+
+    admin->userInfoValid = true;
+    admin->userInfoValidatedAt = std::chrono::steady_clock::now();
+    other->userInfoValid = true;
+    other->userInfoValidatedAt = std::chrono::steady_clock::now();
+    EXPECT_TRUE(admin->isUserInfoCurrent());
+    store.invalidateUserInfo("admin");
+    EXPECT_FALSE(admin->userInfoValid);
+    EXPECT_FALSE(admin->isUserInfoCurrent());
+    EXPECT_TRUE(other->userInfoValid);
+    EXPECT_TRUE(other->isUserInfoCurrent());
+
+    // Nothing signals a password ageing into expiry, so the cached result
+    // is fetched again once it is older than the TTL
+    other->userInfoValidatedAt -= persistent_data::UserSession::userInfoTtl;
+    EXPECT_FALSE(other->isUserInfoCurrent());
+
+    store.removeSession(admin);
+    store.removeSession(other);
+}
+
+TEST(SessionStore, LookupByUid)
+{
+    persistent_data::SessionStore& store =
+        persistent_data::SessionStore::getInstance();
+    std::shared_ptr<persistent_data::UserSession> session =
+        store.generateUserSession("admin", boost::asio::ip::address(),
+                                  std::nullopt,
+                                  persistent_data::SessionType::Session);
+    ASSERT_NE(session, nullptr);
+    EXPECT_EQ(store.getSessionByUid(session->uniqueId), session);
+    EXPECT_THAT(store.getAllUniqueIds(), Contains(session->uniqueId));
+
+    store.removeSession(session);
+    EXPECT_EQ(store.getSessionByUid(session->uniqueId), nullptr);
+    EXPECT_THAT(store.getAllUniqueIds(), Not(Contains(session->uniqueId)));
+}
+
+TEST(SessionStore, IdleSessionsExpire)
+{
+    persistent_data::SessionStore& store =
+        persistent_data::SessionStore::getInstance();
+    std::chrono::seconds timeout(store.getTimeoutInSeconds());
+
+    std::shared_ptr<persistent_data::UserSession> idle =
+        store.generateUserSession("admin", boost::asio::ip::address(),
+                                  std::nullopt,
+                                  persistent_data::SessionType::Session);
+    std::shared_ptr<persistent_data::UserSession> active =
+        store.generateUserSession("admin", boost::asio::ip::address(),
+                                  std::nullopt,
+                                  persistent_data::SessionType::Session);
+    ASSERT_NE(idle, nullptr);
+    ASSERT_NE(active, nullptr);
+
+    // Pretend the sessions were created long ago, but one was used since
+    idle->lastUpdated -= std::chrono::hours(1);
+    active->lastUpdated -= std::chrono::hours(1);
+    store.removeSession(idle);
+    store.removeSession(active);
+    store.addSession(idle);
+    store.addSession(active);
+    // Activity after queuing, as recorded by loginSessionByToken()
+    active->lastUpdated = std::chrono::steady_clock::now();
+
+    store.updateSessionTimeout(std::chrono::minutes(30));
+    store.applySessionTimeouts();
+    EXPECT_EQ(store.getSessionByUid(idle->uniqueId), nullptr);
+    EXPECT_EQ(store.getSessionByUid(active->uniqueId), active);
+
+    store.removeSession(active);
+    store.updateSessionTimeout(timeout);
+}
+
+TEST(SessionStore, ExpiryOutlivesLoginChurn)
+{
+    persistent_data::SessionStore& store =
+        persistent_data::SessionStore::getInstance();
+    std::chrono::seconds timeout(store.getTimeoutInSeconds());
+
+    std::shared_ptr<persistent_data::UserSession> idle =
+        store.generateUserSession("admin", boost::asio::ip::address(),
+                                  std::nullopt,
+                                  persistent_data::SessionType::Session);
+    ASSERT_NE(idle, nullptr);
+    idle->lastUpdated -= std::chrono::hours(1);
+    store.removeSession(idle);
+    store.addSession(idle);
+
+    // Logins and logouts rebuild the expiry queue along the way
+    for (int i = 0; i < 16; i++)
+    {
+        std::shared_ptr<persistent_data::UserSession> shortLived =
+            store.generateUserSession("operator", boost::asio::ip::address(),
+                                      std::nullopt,
+                                      persistent_data::SessionType::Session);
+        ASSERT_NE(shortLived, nullptr);
+        store.removeSession(shortLived);
+    }
+    EXPECT_EQ(store.getSessionByUid(idle->uniqueId), idle);
+
+    store.updateSessionTimeout(std::chrono::minutes(30));
+    store.applySessionTimeouts();
+    EXPECT_EQ(store.getSessionByUid(idle->uniqueId), nullptr);
+    store.updateSessionTimeout(timeout);
+}
 } // namespace
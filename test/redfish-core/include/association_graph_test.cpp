@@ -0,0 +1,101 @@
+// SPDX-License-Identifier: Apache-2.0
+// SPDX-FileCopyrightText: Copyright OpenBMC Authors
+#include "association_graph.hpp"
+#include "dbus_utility.hpp"
+
+#include <sdbusplus/message/native_types.hpp>
+
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace redfish
+{
+namespace
+{
+
+dbus::utility::DBusInterfacesMap association(
+    const std::vector<std::string>& endpoints)
+{
+    dbus::utility::DBusPropertiesMap properties;
+    properties.emplace_back("endpoints", endpoints);
+    dbus::utility::DBusInterfacesMap interfaces;
+    interfaces.emplace_back("xyz.openbmc_project.Association", properties);
+    return interfaces;
+}
+
+TEST(AssociationGraph, IsTracked)
+{
+    EXPECT_TRUE(AssociationGraph::isTracked(
+        "/xyz/openbmc_project/sensors/temperature/cpu0/inventory"));
+    EXPECT_TRUE(AssociationGraph::isTracked(
+        "/xyz/openbmc_project/inventory/system/chassis/fan0/leds"));
+    EXPECT_FALSE(AssociationGraph::isTracked(
+        "/xyz/openbmc_project/sensors/temperature/cpu0/chassis"));
+    EXPECT_FALSE(AssociationGraph::isTracked("inventory"));
+}
+
+TEST(AssociationGraph, LoadKeepsTrackedAssociations)
+{
+    dbus::utility::ManagedObjectType objects;
+    objects.emplace_back(
+        sdbusplus::message::object_path(
+            "/xyz/openbmc_project/sensors/fan_tach/fan0/inventory"),
+        association({"/xyz/openbmc_project/inventory/system/chassis/fan0"}));
+    objects.emplace_back(
+        sdbusplus::message::object_path(
+            "/xyz/openbmc_project/inventory/system/chassis/fan0/leds"),
+        association({"/xyz/openbmc_project/led/groups/fan0"}));
+    objects.emplace_back(
+        sdbusplus::message::object_path(
+            "/xyz/openbmc_project/sensors/fan_tach/fan0/chassis"),
+        association({"/xyz/openbmc_project/inventory/system/chassis"}));
+
+    AssociationGraph graph;
+    graph.load(objects);
+    EXPECT_EQ(graph.size(), 2);
+
+    const std::vector<std::string>* inventory = graph.getEndpoints(
+        "/xyz/openbmc_project/sensors/fan_tach/fan0/inventory");
+    ASSERT_NE(inventory, nullptr);
+    EXPECT_EQ(*inventory, std::vector<std::string>{
+                              "/xyz/openbmc_project/inventory/system/chassis/"
+                              "fan0"});
+    const std::vector<std::string>* leds = graph.getEndpoints(
+        "/xyz/openbmc_project/inventory/system/chassis/fan0/leds");
+    ASSERT_NE(leds, nullptr);
+    EXPECT_EQ(leds->front(), "/xyz/openbmc_project/led/groups/fan0");
+    EXPECT_EQ(graph.getEndpoints(
+                  "/xyz/openbmc_project/sensors/fan_tach/fan0/chassis"),
+              nullptr);
+}
+
+TEST(AssociationGraph, SetEndpointsUpdatesAndRemoves)
+{
+    AssociationGraph graph;
+    std::string path = "/xyz/openbmc_project/sensors/power/psu0/inventory";
+    graph.setEndpoints(path, {"/xyz/openbmc_project/inventory/psu0"});
+    ASSERT_NE(graph.getEndpoints(path), nullptr);
+
+    graph.setEndpoints(path, {"/xyz/openbmc_project/inventory/psu1"});
+    ASSERT_NE(graph.getEndpoints(path), nullptr);
+    EXPECT_EQ(graph.getEndpoints(path)->front(),
+              "/xyz/openbmc_project/inventory/psu1");
+
+    graph.setEndpoints(path, {});
+    EXPECT_EQ(graph.getEndpoints(path), nullptr);
+    EXPECT_EQ(graph.size(), 0);
+}
+
+TEST(AssociationGraph, FindEndpointsIgnoresOtherInterfaces)
+{
+    dbus::utility::DBusPropertiesMap properties;
+    properties.emplace_back("endpoints", std::vector<std::string>{"/a"});
+    dbus::utility::DBusInterfacesMap interfaces;
+    interfaces.emplace_back("xyz.openbmc_project.Other", properties);
+    EXPECT_EQ(AssociationGraph::findEndpoints(interfaces), nullptr);
+}
+
+} // namespace
+} // namespace redfish
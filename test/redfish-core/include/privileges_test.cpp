@@ -1,6 +1,7 @@
 // SPDX-License-Identifier: Apache-2.0
 // SPDX-FileCopyrightText: Copyright OpenBMC Authors
 #include "privileges.hpp"
+#include "registries/privilege_registry.hpp"
 
 #include <boost/beast/http/verb.hpp>
 
@@ -139,5 +140,41 @@ TEST(PrivilegeTest, PrivilegeHostConsoleConstructor)
                 UnorderedElementsAre("OpenBMCHostConsole"));
 }
 
+// The registry is evaluated at compile time
+static_assert(privileges::getManagerAccount[0].isSupersetOf(
+    Privileges{"ConfigureManager"}));
+static_assert(privileges::getManagerAccount.size() == 3);
+
+TEST(PrivilegeTest, CompiledPrivilegesAnyOf)
+{
+    CompiledPrivileges required(privileges::getManagerAccount);
+
+    EXPECT_TRUE(required.isAllowed(Privileges{"ConfigureSelf"}));
+    EXPECT_TRUE(required.isAllowed(Privileges{"Login", "ConfigureUsers"}));
+    EXPECT_FALSE(required.isAllowed(Privileges{"Login"}));
+    EXPECT_FALSE(required.isAllowed(Privileges{}));
+}
+
+TEST(PrivilegeTest, CompiledPrivilegesAllOf)
+{
+    std::array<Privileges, 2> alternatives{
+        Privileges{"Login", "ConfigureComponents"},
+        Privileges{"ConfigureManager"}};
+    CompiledPrivileges required(alternatives);
+
+    EXPECT_TRUE(required.isAllowed(Privileges{"ConfigureManager"}));
+    EXPECT_TRUE(
+        required.isAllowed(Privileges{"Login", "ConfigureComponents"}));
+    EXPECT_FALSE(required.isAllowed(Privileges{"Login"}));
+    EXPECT_FALSE(required.isAllowed(Privileges{"ConfigureComponents"}));
+}
+
+TEST(PrivilegeTest, CompiledPrivilegesNoneRequired)
+{
+    EXPECT_TRUE(CompiledPrivileges().isAllowed(Privileges{}));
+    EXPECT_TRUE(CompiledPrivileges(privileges::privilegeSetLoginOrNoAuth)
+                    .isAllowed(Privileges{}));
+}
+
 } // namespace
 } // namespace redfish
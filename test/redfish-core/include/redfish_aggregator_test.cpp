@@ -5,13 +5,20 @@
 #include "http_response.hpp"
 #include "redfish_aggregator.hpp"
 
+#include <boost/asio/io_context.hpp>
 #include <boost/beast/http/field.hpp>
 #include <boost/beast/http/status.hpp>
+#include <boost/beast/http/verb.hpp>
+#include <boost/url/url.hpp>
 #include <nlohmann/json.hpp>
 
 #include <array>
+#include <chrono>
+#include <cstddef>
+#include <functional>
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include <utility>
 
 #include <gtest/gtest.h>
@@ -157,6 +164,65 @@ TEST(addPrefixToItem, TopLevelCollections)
     }
 }
 
+TEST(addPrefixToItem, KeepsQueryAndFragment)
+{
+    nlohmann::json jsonRequest;
+    jsonRequest["@odata.id"] = "/redfish/v1/Chassis/1/Sensors?$expand=.";
+    addPrefixToItem(jsonRequest["@odata.id"], "asdfjkl");
+    EXPECT_EQ(jsonRequest["@odata.id"],
+              "/redfish/v1/Chassis/asdfjkl_1/Sensors?$expand=.");
+
+    jsonRequest["@odata.id"] = "/redfish/v1/Systems/system#/Boot";
+    addPrefixToItem(jsonRequest["@odata.id"], "asdfjkl");
+    EXPECT_EQ(jsonRequest["@odata.id"],
+              "/redfish/v1/Systems/asdfjkl_system#/Boot");
+
+    // Collection with a query and nothing after it
+    jsonRequest["@odata.id"] = "/redfish/v1/Chassis?$top=2";
+    addPrefixToItem(jsonRequest["@odata.id"], "asdfjkl");
+    EXPECT_EQ(jsonRequest["@odata.id"], "/redfish/v1/Chassis?$top=2");
+}
+
+TEST(addPrefixToItem, NotRedfishURIs)
+{
+    nlohmann::json jsonRequest;
+    constexpr std::array uris{
+        "https://redfish.dmtf.org/registries/Base.1.15.0.json",
+        "/redfish/v10/Chassis/1", "/redfish/v1", "/redfish/v1/",
+        "/redfish/v1/JsonSchemas/Chassis", "redfish/v1/Chassis/1"};
+    for (const auto& uri : uris)
+    {
+        jsonRequest["@odata.id"] = uri;
+        addPrefixToItem(jsonRequest["@odata.id"], "asdfjkl");
+        EXPECT_EQ(jsonRequest["@odata.id"], uri);
+    }
+}
+
+TEST(findSatellitePrefix, LooksUpPrefixBeforeUnderscore)
+{
+    std::unordered_map<std::string, boost::urls::url> satelliteInfo;
+    satelliteInfo.emplace("5B247A", boost::urls::url("http://sat1:80"));
+    satelliteInfo.emplace("rack_2", boost::urls::url("http://sat2:80"));
+
+    const std::string* prefix =
+        RedfishAggregator::findSatellitePrefix("5B247A_chassis", satelliteInfo);
+    ASSERT_NE(prefix, nullptr);
+    EXPECT_EQ(*prefix, "5B247A");
+
+    prefix = RedfishAggregator::findSatellitePrefix("rack_2_system_0",
+                                                    satelliteInfo);
+    ASSERT_NE(prefix, nullptr);
+    EXPECT_EQ(*prefix, "rack_2");
+
+    EXPECT_EQ(RedfishAggregator::findSatellitePrefix("5B247A", satelliteInfo),
+              nullptr);
+    EXPECT_EQ(RedfishAggregator::findSatellitePrefix("rack_3_system",
+                                                     satelliteInfo),
+              nullptr);
+    EXPECT_EQ(RedfishAggregator::findSatellitePrefix("chassis", satelliteInfo),
+              nullptr);
+}
+
 TEST(addPrefixes, ParseJsonObject)
 {
     nlohmann::json parameter;
@@ -460,6 +526,286 @@ TEST(processCollectionResponse, bothExist)
     EXPECT_TRUE(foundSat);
 }
 
+// Stand-in for a satellite BMC reporting a ComputerSystem collection with
+// the given number of members
+void populateSatelliteCollection(crow::Response& resp, size_t members)
+{
+    nlohmann::json::array_t memberArray;
+    for (size_t i = 0; i < members; i++)
+    {
+        nlohmann::json::object_t member;
+        member["@odata.id"] = "/redfish/v1/Systems/system" + std::to_string(i);
+        memberArray.emplace_back(std::move(member));
+    }
+    nlohmann::json jsonResp;
+    jsonResp["@odata.id"] = "/redfish/v1/Systems";
+    jsonResp["Members"] = std::move(memberArray);
+    jsonResp["Members@odata.count"] = members;
+
+    resp.clear();
+    resp.write(
+        jsonResp.dump(2, ' ', true, nlohmann::json::error_handler_t::replace));
+    resp.addHeader("Content-Type", "application/json");
+    resp.result(boost::beast::http::status::ok);
+}
+
+TEST(AggregationFanout, MergesAsSatellitesRespond)
+{
+    boost::asio::io_context io;
+    bool completed = false;
+    nlohmann::json result;
+    auto asyncResp = std::make_shared<bmcweb::AsyncResp>();
+    populateCollectionResponse(asyncResp->res);
+    asyncResp->res.setCompleteRequestHandler(
+        [&completed, &result](crow::Response& res) {
+            completed = true;
+            result = res.jsonValue;
+        });
+
+    auto fanout = std::make_shared<AggregationFanout>(
+        io, std::move(asyncResp), RedfishAggregator::processCollectionResponse,
+        2);
+    fanout->start(std::chrono::seconds(60));
+    std::function<void(crow::Response&)> cb1 = fanout->callbackFor("sat1");
+    std::function<void(crow::Response&)> cb2 = fanout->callbackFor("sat2");
+    fanout.reset();
+
+    crow::Response resp1;
+    populateSatelliteCollection(resp1, 500);
+    cb1(resp1);
+    EXPECT_FALSE(completed);
+
+    crow::Response resp2;
+    populateSatelliteCollection(resp2, 500);
+    cb2(resp2);
+    io.poll();
+    EXPECT_TRUE(completed);
+    EXPECT_EQ(result["Members@odata.count"], 1001);
+    EXPECT_EQ(result["Members"][1]["@odata.id"],
+              "/redfish/v1/Systems/sat1_system0");
+    EXPECT_EQ(result["Members"][1000]["@odata.id"],
+              "/redfish/v1/Systems/sat2_system499");
+}
+
+TEST(AggregationFanout, SlowSatelliteTimesOut)
+{
+    boost::asio::io_context io;
+    bool completed = false;
+    nlohmann::json result;
+    auto asyncResp = std::make_shared<bmcweb::AsyncResp>();
+    populateCollectionResponse(asyncResp->res);
+    asyncResp->res.setCompleteRequestHandler(
+        [&completed, &result](crow::Response& res) {
+            completed = true;
+            result = res.jsonValue;
+        });
+
+    auto fanout = std::make_shared<AggregationFanout>(
+        io, std::move(asyncResp), RedfishAggregator::processCollectionResponse,
+        2);
+    fanout->start(std::chrono::milliseconds(1));
+    std::function<void(crow::Response&)> fast = fanout->callbackFor("fast");
+    std::function<void(crow::Response&)> slow = fanout->callbackFor("slow");
+    fanout.reset();
+
+    crow::Response fastResp;
+    populateSatelliteCollection(fastResp, 1);
+    fast(fastResp);
+    EXPECT_FALSE(completed);
+
+    while (!completed)
+    {
+        io.run_for(std::chrono::milliseconds(1));
+    }
+    EXPECT_EQ(result["Members@odata.count"], 2);
+
+    // A response after the deadline is dropped
+    crow::Response slowResp;
+    populateSatelliteCollection(slowResp, 1);
+    slow(slowResp);
+    EXPECT_EQ(result["Members@odata.count"], 2);
+}
+
+TEST(AggregationFanout, NoSatellitesCompletesImmediately)
+{
+    boost::asio::io_context io;
+    bool completed = false;
+    auto asyncResp = std::make_shared<bmcweb::AsyncResp>();
+    populateCollectionResponse(asyncResp->res);
+    asyncResp->res.setCompleteRequestHandler(
+        [&completed](crow::Response& /*res*/) { completed = true; });
+
+    auto fanout = std::make_shared<AggregationFanout>(
+        io, std::move(asyncResp), RedfishAggregator::processCollectionResponse,
+        0);
+    // Answered without running the timer
+    fanout->start(std::chrono::seconds(60));
+    EXPECT_TRUE(completed);
+}
+
+TEST(SatelliteResponseCache, StoresOnlyRevalidatableResponses)
+{
+    SatelliteResponseCache cache(std::chrono::seconds(0), 4);
+
+    crow::Response noEtag;
+    noEtag.write("{}");
+    noEtag.result(boost::beast::http::status::ok);
+    cache.store("/redfish/v1/Chassis/a", noEtag);
+    EXPECT_EQ(cache.find("/redfish/v1/Chassis/a"), nullptr);
+
+    crow::Response notFound;
+    notFound.addHeader(boost::beast::http::field::etag, "\"1\"");
+    notFound.result(boost::beast::http::status::not_found);
+    cache.store("/redfish/v1/Chassis/a", notFound);
+    EXPECT_EQ(cache.find("/redfish/v1/Chassis/a"), nullptr);
+
+    crow::Response ok;
+    ok.write(R"({"@odata.id": "/redfish/v1/Chassis/a"})");
+    ok.addHeader(boost::beast::http::field::etag, "\"abcd\"");
+    ok.addHeader(boost::beast::http::field::content_type, "application/json");
+    ok.result(boost::beast::http::status::ok);
+    cache.store("/redfish/v1/Chassis/a", ok);
+
+    const SatelliteCacheEntry* entry = cache.find("/redfish/v1/Chassis/a");
+    ASSERT_NE(entry, nullptr);
+    EXPECT_EQ(entry->etag, "\"abcd\"");
+    // A max-age of 0 means every use must be revalidated
+    EXPECT_FALSE(cache.isFresh(*entry));
+    EXPECT_NE(cache.revalidate("/redfish/v1/Chassis/a"), nullptr);
+
+    crow::Response fromCache;
+    entry->toResponse(fromCache);
+    EXPECT_EQ(fromCache.resultInt(), 200);
+    EXPECT_EQ(fromCache.getHeaderValue("Content-Type"), "application/json");
+    EXPECT_EQ(*fromCache.body(), R"({"@odata.id": "/redfish/v1/Chassis/a"})");
+
+    cache.invalidate("/redfish/v1/Chassis/a");
+    EXPECT_EQ(cache.find("/redfish/v1/Chassis/a"), nullptr);
+}
+
+TEST(SatelliteResponseCache, FreshAndBounded)
+{
+    SatelliteResponseCache cache(std::chrono::seconds(3600), 2);
+
+    crow::Response ok;
+    ok.write("{}");
+    ok.addHeader(boost::beast::http::field::etag, "\"1\"");
+    ok.result(boost::beast::http::status::ok);
+
+    cache.store("/redfish/v1/Chassis/a", ok);
+    cache.store("/redfish/v1/Chassis/b", ok);
+    const SatelliteCacheEntry* entry = cache.find("/redfish/v1/Chassis/a");
+    ASSERT_NE(entry, nullptr);
+    EXPECT_TRUE(cache.isFresh(*entry));
+
+    // The least recently validated entry makes room for the new one
+    cache.store("/redfish/v1/Chassis/c", ok);
+    EXPECT_EQ(cache.size(), 2U);
+    EXPECT_EQ(cache.find("/redfish/v1/Chassis/a"), nullptr);
+    EXPECT_NE(cache.find("/redfish/v1/Chassis/c"), nullptr);
+}
+
+TEST(SatelliteResponseCache, KeyedByUser)
+{
+    SatelliteResponseCache cache(std::chrono::seconds(3600), 4);
+
+    crow::Response ok;
+    ok.write("{}");
+    ok.addHeader(boost::beast::http::field::etag, "\"1\"");
+    ok.result(boost::beast::http::status::ok);
+
+    std::string url = "https://sat/redfish/v1/AccountService/Accounts/1";
+    cache.store(SatelliteResponseCache::makeKey(url, "admin",
+                                                "priv-administrator"),
+                ok);
+    EXPECT_NE(cache.find(SatelliteResponseCache::makeKey(
+                  url, "admin", "priv-administrator")),
+              nullptr);
+    EXPECT_EQ(cache.find(SatelliteResponseCache::makeKey(url, "operator",
+                                                         "priv-readonly")),
+              nullptr);
+    EXPECT_EQ(cache.find(SatelliteResponseCache::makeKey(url, "admin",
+                                                         "priv-readonly")),
+              nullptr);
+}
+
+TEST(SatelliteResponseCache, InvalidatesModifiedCollection)
+{
+    EXPECT_EQ(modifiedCollection("/redfish/v1/Systems/system"),
+              "/redfish/v1/Systems");
+    EXPECT_EQ(modifiedCollection(
+                  "/redfish/v1/Systems/system/Actions/ComputerSystem.Reset"),
+              "/redfish/v1/Systems");
+    EXPECT_EQ(modifiedCollection("/redfish/v1/EventService/Subscriptions"),
+              "/redfish/v1/EventService");
+
+    SatelliteResponseCache cache(std::chrono::seconds(3600), 8);
+    crow::Response ok;
+    ok.write("{}");
+    ok.addHeader(boost::beast::http::field::etag, "\"1\"");
+    ok.result(boost::beast::http::status::ok);
+
+    std::string system = SatelliteResponseCache::makeKey(
+        "https://sat/redfish/v1/Systems/system", "admin", "priv-administrator");
+    std::string systems = SatelliteResponseCache::makeKey(
+        "https://sat/redfish/v1/Systems", "operator", "priv-operator");
+    std::string chassis = SatelliteResponseCache::makeKey(
+        "https://sat/redfish/v1/Chassis/a", "admin", "priv-administrator");
+    cache.store(system, ok);
+    cache.store(systems, ok);
+    cache.store(chassis, ok);
+
+    // A reset action drops the system and its collection for every user
+    cache.invalidatePrefix(
+        std::string("https://sat") +
+        std::string(modifiedCollection(
+            "/redfish/v1/Systems/system/Actions/ComputerSystem.Reset")));
+    EXPECT_EQ(cache.find(system), nullptr);
+    EXPECT_EQ(cache.find(systems), nullptr);
+    EXPECT_NE(cache.find(chassis), nullptr);
+}
+
+TEST(SatelliteResponseCache, InvalidatesWholePathSegments)
+{
+    SatelliteResponseCache cache(std::chrono::seconds(3600), 8);
+    crow::Response ok;
+    ok.write("{}");
+    ok.addHeader(boost::beast::http::field::etag, "\"1\"");
+    ok.result(boost::beast::http::status::ok);
+
+    std::string one = SatelliteResponseCache::makeKey(
+        "https://sat/redfish/v1/Systems/1", "admin", "priv-administrator");
+    std::string oneQuery = SatelliteResponseCache::makeKey(
+        "https://sat/redfish/v1/Systems/1?$expand=.", "admin",
+        "priv-administrator");
+    std::string child = SatelliteResponseCache::makeKey(
+        "https://sat/redfish/v1/Systems/1/Processors", "admin",
+        "priv-administrator");
+    std::string ten = SatelliteResponseCache::makeKey(
+        "https://sat/redfish/v1/Systems/10", "admin", "priv-administrator");
+    cache.store(one, ok);
+    cache.store(oneQuery, ok);
+    cache.store(child, ok);
+    cache.store(ten, ok);
+
+    cache.invalidatePrefix("https://sat/redfish/v1/Systems/1");
+    EXPECT_EQ(cache.find(one), nullptr);
+    EXPECT_EQ(cache.find(oneQuery), nullptr);
+    EXPECT_EQ(cache.find(child), nullptr);
+    EXPECT_NE(cache.find(ten), nullptr);
+}
+
+TEST(SatelliteResponseCache, OnlyWritesInvalidate)
+{
+    EXPECT_TRUE(isModifyingMethod(boost::beast::http::verb::post));
+    EXPECT_TRUE(isModifyingMethod(boost::beast::http::verb::put));
+    EXPECT_TRUE(isModifyingMethod(boost::beast::http::verb::patch));
+    EXPECT_TRUE(isModifyingMethod(boost::beast::http::verb::delete_));
+    EXPECT_FALSE(isModifyingMethod(boost::beast::http::verb::get));
+    EXPECT_FALSE(isModifyingMethod(boost::beast::http::verb::head));
+    EXPECT_FALSE(isModifyingMethod(boost::beast::http::verb::options));
+}
+
 TEST(processCollectionResponse, satelliteWrongContentHeader)
 {
     auto asyncResp = std::make_shared<bmcweb::AsyncResp>();
@@ -0,0 +1,54 @@
+// SPDX-License-Identifier: Apache-2.0
+// SPDX-FileCopyrightText: Copyright OpenBMC Authors
+#include "metric_report.hpp"
+#include "subscription.hpp"
+
+#include <nlohmann/json.hpp>
+
+#include <cstdint>
+#include <string>
+#include <tuple>
+#include <utility>
+
+#include <gtest/gtest.h>
+
+namespace redfish
+{
+namespace
+{
+
+telemetry::TimestampReadings makeReadings()
+{
+    telemetry::Readings readings;
+    readings.emplace_back("/redfish/v1/Chassis/chassis/Sensors/fan0", 1234.0,
+                          uint64_t{1000});
+    readings.emplace_back("/redfish/v1/Chassis/chassis/Sensors/fan1", 4321.0,
+                          uint64_t{1000});
+    return {uint64_t{1000}, std::move(readings)};
+}
+
+TEST(SharedMetricReport, PayloadIsSharedPerContext)
+{
+    SharedMetricReport report("Report1");
+    ASSERT_TRUE(report.valid(makeReadings()));
+    EXPECT_EQ(report.definitionUri(),
+              "/redfish/v1/TelemetryService/MetricReportDefinitions/Report1");
+
+    SharedMetricReport::Payload& noContext = report.payloadFor("");
+    SharedMetricReport::Payload& sameNoContext = report.payloadFor("");
+    EXPECT_EQ(&noContext, &sameNoContext);
+
+    nlohmann::json parsed = nlohmann::json::parse(noContext.msg);
+    EXPECT_EQ(parsed["Id"], "Report1");
+    EXPECT_EQ(parsed["MetricValues"].size(), 2U);
+    EXPECT_FALSE(parsed.contains("Context"));
+
+    SharedMetricReport::Payload& withContext = report.payloadFor("collector1");
+    EXPECT_NE(&noContext, &withContext);
+    parsed = nlohmann::json::parse(withContext.msg);
+    EXPECT_EQ(parsed["Context"], "collector1");
+    EXPECT_EQ(parsed["MetricValues"].size(), 2U);
+}
+
+} // namespace
+} // namespace redfish
@@ -0,0 +1,200 @@
+// SPDX-License-Identifier: Apache-2.0
+// SPDX-FileCopyrightText: Copyright OpenBMC Authors
+#include "utils/stage_graph.hpp"
+
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/steady_timer.hpp>
+#include <boost/system/error_code.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace redfish
+{
+namespace
+{
+
+using std::chrono::milliseconds;
+
+// Stands in for D-Bus: every call completes after a fixed delay on the event
+// loop, and the order calls complete in is recorded.
+class FakeDbus
+{
+  public:
+    explicit FakeDbus(boost::asio::io_context& ioIn) : io(ioIn) {}
+
+    StageGraph::Stage call(std::string_view name, milliseconds delay)
+    {
+        return [this, name, delay](StageGraph::Done&& done) {
+            auto timer = std::make_shared<boost::asio::steady_timer>(io);
+            timer->expires_after(delay);
+            timer->async_wait([this, name, timer, done{std::move(done)}](
+                                  const boost::system::error_code&) {
+                completed.emplace_back(name);
+                done();
+            });
+        };
+    }
+
+    std::vector<std::string_view> completed;
+
+  private:
+    boost::asio::io_context& io;
+};
+
+size_t indexOf(const std::vector<std::string_view>& names,
+               std::string_view name)
+{
+    for (size_t i = 0; i < names.size(); i++)
+    {
+        if (names[i] == name)
+        {
+            return i;
+        }
+    }
+    return names.size();
+}
+
+StageGraph::Timing timingOf(const StageGraph& graph, std::string_view name)
+{
+    for (const StageGraph::Timing& timing : graph.timings())
+    {
+        if (timing.name == name)
+        {
+            return timing;
+        }
+    }
+    ADD_FAILURE() << "No stage named " << name;
+    return {};
+}
+
+// True if one stage started before the other had finished
+bool overlapped(const StageGraph::Timing& a, const StageGraph::Timing& b)
+{
+    return a.started < b.started + b.elapsed &&
+           b.started < a.started + a.elapsed;
+}
+
+TEST(StageGraph, SensorPipelineRunsIndependentStagesConcurrently)
+{
+    boost::asio::io_context io;
+    FakeDbus dbus(io);
+    constexpr milliseconds callLatency(20);
+
+    // A hand copy of the stages and dependencies that processSensorList in
+    // sensors.hpp builds, with fake D-Bus calls in place of the real ones.
+    // sensors.hpp can't be built into a unit test, so this doesn't follow
+    // changes to the real graph and has to be updated with it.
+    auto graph = std::make_shared<StageGraph>();
+    size_t associations =
+        graph->add("associations", {}, [](StageGraph::Done&& done) {
+            // Served from memory
+            done();
+        });
+    size_t inventoryConnections =
+        graph->add("inventoryConnections", {associations},
+                   dbus.call("inventoryConnections", callLatency));
+    size_t inventoryData = graph->add("inventoryData", {inventoryConnections},
+                                      dbus.call("inventoryData", callLatency));
+    size_t leds =
+        graph->add("leds", {associations}, dbus.call("leds", callLatency));
+    size_t powerSupply =
+        graph->add("powerSupplyAttributes", {inventoryData},
+                   dbus.call("powerSupplyAttributes", callLatency));
+    size_t connections =
+        graph->add("connections", {}, dbus.call("connections", callLatency));
+    size_t sensorValues = graph->add("sensorValues", {connections},
+                                     dbus.call("sensorValues", callLatency));
+    size_t inventoryReady =
+        graph->add("inventoryReady", {inventoryData, leds, powerSupply},
+                   [](StageGraph::Done&& done) { done(); });
+    graph->add("sensorJson", {sensorValues, inventoryReady},
+               dbus.call("sensorJson", milliseconds(0)));
+
+    std::optional<StageGraph::Clock::duration> elapsed;
+    std::string breakdown;
+    graph->run([&elapsed, &breakdown](const StageGraph& done) {
+        elapsed = done.elapsed();
+        breakdown = done.formatTimings();
+    });
+    std::weak_ptr<StageGraph> weak = graph;
+    io.run();
+
+    ASSERT_TRUE(elapsed);
+    const std::vector<std::string_view>& order = dbus.completed;
+    ASSERT_EQ(order.size(), 7);
+    EXPECT_LT(indexOf(order, "connections"), indexOf(order, "sensorValues"));
+    EXPECT_LT(indexOf(order, "inventoryData"),
+              indexOf(order, "powerSupplyAttributes"));
+    EXPECT_EQ(order.back(), "sensorJson");
+
+    // Independent stages overlap, where running every stage in turn would
+    // leave no two stages running at once
+    EXPECT_TRUE(overlapped(timingOf(*graph, "connections"),
+                           timingOf(*graph, "inventoryConnections")));
+    EXPECT_TRUE(overlapped(timingOf(*graph, "leds"),
+                           timingOf(*graph, "inventoryConnections")));
+    EXPECT_TRUE(overlapped(timingOf(*graph, "sensorValues"),
+                           timingOf(*graph, "inventoryData")));
+    // The longest chain is three calls
+    EXPECT_GE(*elapsed, 3 * callLatency);
+    EXPECT_NE(breakdown.find("inventoryData="), std::string::npos);
+    EXPECT_NE(breakdown.find("total="), std::string::npos);
+
+    graph.reset();
+    EXPECT_TRUE(weak.expired());
+}
+
+TEST(StageGraph, SynchronousStagesCompleteInsideRun)
+{
+    auto graph = std::make_shared<StageGraph>();
+    std::vector<std::string_view> order;
+    auto record = [&order](std::string_view name) {
+        return [&order, name](StageGraph::Done&& done) {
+            order.emplace_back(name);
+            done();
+        };
+    };
+    size_t a = graph->add("a", {}, record("a"));
+    size_t b = graph->add("b", {}, record("b"));
+    graph->add("c", {a, b}, record("c"));
+
+    bool completed = false;
+    graph->run([&completed](const StageGraph&) { completed = true; });
+    EXPECT_TRUE(completed);
+    EXPECT_EQ(order, (std::vector<std::string_view>{"a", "b", "c"}));
+    EXPECT_EQ(graph->timings().size(), 3);
+}
+
+TEST(StageGraph, FailedStageAbandonsGraph)
+{
+    boost::asio::io_context io;
+    FakeDbus dbus(io);
+    auto graph = std::make_shared<StageGraph>();
+    size_t fails = graph->add("fails", {}, [](StageGraph::Done&&) {
+        // Reports its own error and never finishes
+    });
+    graph->add("after", {fails}, dbus.call("after", milliseconds(0)));
+    graph->add("other", {}, dbus.call("other", milliseconds(0)));
+
+    bool completed = false;
+    std::weak_ptr<StageGraph> weak = graph;
+    graph->run([&completed](const StageGraph&) { completed = true; });
+    graph.reset();
+    io.run();
+
+    EXPECT_FALSE(completed);
+    EXPECT_EQ(dbus.completed, std::vector<std::string_view>{"other"});
+    EXPECT_TRUE(weak.expired());
+}
+
+} // namespace
+} // namespace redfish